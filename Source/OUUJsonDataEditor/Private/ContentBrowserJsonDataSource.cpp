@@ -165,6 +165,8 @@ bool UContentBrowserJsonFileDataSource::BulkMoveItems(
 	TArrayView<const FContentBrowserItemData> InItems,
 	const FName InDestPath)
 {
+	// Submit the source control operations of all items at once
+	OUU::JsonData::Runtime::FScopedSourceControlBatch SourceControlBatch;
 	bool bAllMoved = true;
 	for (auto& Item : InItems)
 	{
@@ -226,6 +228,8 @@ bool UContentBrowserJsonFileDataSource::BulkCopyItems(
 	TArrayView<const FContentBrowserItemData> _Items,
 	const FName _DestPath)
 {
+	// Submit the source control operations of all items at once
+	OUU::JsonData::Runtime::FScopedSourceControlBatch SourceControlBatch;
 	bool bAllCopied = true;
 	for (auto& Item : _Items)
 	{
@@ -291,6 +295,8 @@ bool UContentBrowserJsonFileDataSource::BulkDuplicateItems(
 	TArrayView<const FContentBrowserItemData> _Items,
 	TArray<FContentBrowserItemData>& _OutNewItems)
 {
+	// Submit the source control operations of all items at once
+	OUU::JsonData::Runtime::FScopedSourceControlBatch SourceControlBatch;
 	bool bAllDuplicated = true;
 	for (auto& Item : _Items)
 	{
@@ -337,6 +343,8 @@ bool UContentBrowserJsonFileDataSource::DeleteItem(const FContentBrowserItemData
 
 bool UContentBrowserJsonFileDataSource::BulkDeleteItems(TArrayView<const FContentBrowserItemData> InItems)
 {
+	// Submit the source control operations of all items at once
+	OUU::JsonData::Runtime::FScopedSourceControlBatch SourceControlBatch;
 	bool bAllDeleted = true;
 	for (auto& Item : InItems)
 	{
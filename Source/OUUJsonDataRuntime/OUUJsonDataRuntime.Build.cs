@@ -41,8 +41,21 @@ public class OUUJsonDataRuntime : OUUJsonDataModuleRules
 			"Json",
 			"Projects",
 			"GameplayTags",
+			"PakFile",
 		});
 
+		// - Json source file watcher (editor and development builds)
+		if (Target.bBuildDeveloperTools)
+		{
+			PrivateDependencyModuleNames.Add("DirectoryWatcher");
+			PrivateDefinitions.Add("WITH_JSON_DATA_SOURCE_WATCHER=1");
+		}
+		else
+		{
+			PrivateDefinitions.Add("WITH_JSON_DATA_SOURCE_WATCHER=0");
+		}
+		// --
+
 		// - Editor only dependencies
 		if (Target.bBuildEditor)
 		{
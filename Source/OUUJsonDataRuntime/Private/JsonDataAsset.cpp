@@ -6,11 +6,23 @@
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "AssetRegistry/IAssetRegistry.h"
 #include "Engine.h"
+#include "HAL/FileManager.h"
 #include "HAL/PlatformFile.h"
+#include "JsonDataAssetConsoleVariables.h"
+#include "JsonDataAssetDiffReimport.h"
 #include "JsonDataAssetGlobals.h"
+#include "JsonDataAssetLoading.h"
+#include "JsonDataAssetMemory.h"
+#include "JsonDataAssetPrefetch.h"
+#include "JsonDataAssetResidency.h"
 #include "JsonDataAssetSubsystem.h"
+#include "JsonDataAssetTrace.h"
+#include "JsonDataBundle.h"
+#include "JsonDataCompactBinary.h"
 #include "JsonDataCustomVersions.h"
+#include "JsonDataSourceControlQueue.h"
 #include "JsonLibrary.h"
+#include "JsonLibraryImportPlan.h"
 #include "JsonObjectConverter.h"
 #include "LogJsonDataAsset.h"
 #include "Misc/FileHelper.h"
@@ -22,7 +34,6 @@
 #if WITH_EDITOR
 	#include "Editor.h"
 	#include "FileHelpers.h"
-	#include "SourceControlHelpers.h"
 	#include "AssetViewUtils.h"
 	#include "AssetToolsModule.h"
 	#include "Misc/DataValidation.h"
@@ -30,6 +41,107 @@
 
 namespace OUU::JsonData::Runtime::Private
 {
+	// Name of the top level json field that contains the property data.
+	const FString DataFieldName = TEXT("Data");
+
+	// Property filters for exporting the property data.
+	// No requirements. We had Edit here before which prevented hidden properties that aren't editable in UI
+	constexpr int64 ExportCheckFlags = 0;
+	constexpr int64 ExportSkipFlags = CPF_Transient;
+
+	FOUUJsonLibraryObjectFilter GetExportSubObjectFilter()
+	{
+		FOUUJsonLibraryObjectFilter Filter;
+		Filter.SubObjectDepthLimit = 0;
+		return Filter;
+	}
+
+	// UTF-8 byte order mark that FFileHelper::SaveStringToFile writes with EEncodingOptions::ForceUTF8
+	constexpr uint8 Utf8ByteOrderMark[] = {0xEF, 0xBB, 0xBF};
+
+	enum class EJsonFieldVisitResult
+	{
+		Continue,
+		Stop,
+		Error
+	};
+
+	/**
+	 * Iterate the top level fields of a json string without building a json object.
+	 * The visitor is called after the first token of each field value was read and must consume the entire value.
+	 * @returns false if the json is malformed or the visitor returned an error.
+	 */
+	bool VisitTopLevelJsonFields(
+		const FString& JsonString,
+		TFunctionRef<EJsonFieldVisitResult(TJsonReader<>&, EJsonNotation)> Visitor)
+	{
+		const TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(JsonString);
+		EJsonNotation Notation;
+		if (!JsonReader->ReadNext(OUT Notation) || Notation != EJsonNotation::ObjectStart)
+		{
+			UE_LOG(LogJsonDataAsset, Error, TEXT("Json string does not start with an object"));
+			return false;
+		}
+
+		while (JsonReader->ReadNext(OUT Notation) && Notation != EJsonNotation::Error)
+		{
+			if (Notation == EJsonNotation::ObjectEnd)
+			{
+				return true;
+			}
+
+			switch (Visitor(*JsonReader, Notation))
+			{
+			case EJsonFieldVisitResult::Continue: break;
+			case EJsonFieldVisitResult::Stop: return true;
+			case EJsonFieldVisitResult::Error: return false;
+			}
+		}
+
+		UE_LOG(LogJsonDataAsset, Error, TEXT("Failed to read json: %s"), *JsonReader->GetErrorMessage());
+		return false;
+	}
+
+	// Find the 'Class' field value without parsing the rest of the file. The class is usually the first field.
+	FString PeekJsonClassName(const FString& JsonString)
+	{
+		FString ClassName;
+		VisitTopLevelJsonFields(JsonString, [&ClassName](TJsonReader<>& JsonReader, EJsonNotation Notation) {
+			if (Notation == EJsonNotation::String && JsonReader.GetIdentifier() == TEXT("Class"))
+			{
+				ClassName = JsonReader.GetValueAsString();
+				return EJsonFieldVisitResult::Stop;
+			}
+			return UOUUJsonLibrary::SkipJsonReaderValue(JsonReader, Notation) ? EJsonFieldVisitResult::Continue
+																			   : EJsonFieldVisitResult::Error;
+		});
+		return ClassName;
+	}
+
+	// Parse all top level fields except for 'Data' into a json object. Data is skipped without building json values.
+	TSharedPtr<FJsonObject> ParseJsonHeader(const FString& JsonString)
+	{
+		auto HeaderObject = MakeShared<FJsonObject>();
+		const bool bSuccess =
+			VisitTopLevelJsonFields(JsonString, [&HeaderObject](TJsonReader<>& JsonReader, EJsonNotation Notation) {
+				if (JsonReader.GetIdentifier() == DataFieldName)
+				{
+					return UOUUJsonLibrary::SkipJsonReaderValue(JsonReader, Notation) ? EJsonFieldVisitResult::Continue
+																					   : EJsonFieldVisitResult::Error;
+				}
+
+				FString FieldName = JsonReader.GetIdentifier();
+				const auto FieldValue = UOUUJsonLibrary::JsonReaderToJsonValue(JsonReader, Notation);
+				if (FieldValue.IsValid() == false)
+				{
+					return EJsonFieldVisitResult::Error;
+				}
+				HeaderObject->SetField(FieldName, FieldValue);
+				return EJsonFieldVisitResult::Continue;
+			});
+		return bSuccess ? TSharedPtr<FJsonObject>(HeaderObject) : nullptr;
+	}
+
 	void Delete(const FString& PackagePath)
 	{
 		auto FullPath = OUU::JsonData::Runtime::PackageToSourceFull(PackagePath, EJsonDataAccessMode::Write);
@@ -37,11 +149,12 @@ namespace OUU::JsonData::Runtime::Private
 		{
 			IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
 			PlatformFile.DeleteFile(*FullPath);
+			PlatformFile.DeleteFile(*GetCompactBinaryFilePath(FullPath));
 		}
 		else
 		{
 #if WITH_EDITOR
-			USourceControlHelpers::MarkFileForDelete(FullPath);
+			FJsonDataSourceControlQueue::Get().QueueDelete(FullPath);
 #else
 			UE_LOG(
 				LogJsonDataAsset,
@@ -51,6 +164,220 @@ namespace OUU::JsonData::Runtime::Private
 #endif
 		}
 	}
+
+	void FJsonFileLoadResult::ReportError() const
+	{
+		if (ErrorMessage.IsEmpty())
+		{
+			return;
+		}
+
+		FMessageLog(JSON_DATA_MESSAGELOG_CATEGORY)
+			.AddMessage(FTokenizedMessage::Create(ErrorSeverity)
+							->AddToken(FUObjectToken::Create(nullptr))
+							->AddToken(FTextToken::Create(FText::FromString(ErrorMessage))));
+	}
+
+	bool ReadJsonFile(
+		const FString& LoadPath,
+		FString& OutJsonString,
+		FJsonFileLoadResult& OutResult,
+		FMD5Hash* OutContentHash)
+	{
+		LLM_SCOPE_BYTAG(JsonData_Parse);
+		UE_JSON_DATA_TRACE_PHASE(ReadFile);
+
+		OutResult.LoadPath = LoadPath;
+
+		if (!FPaths::FileExists(LoadPath))
+		{
+			OutResult.ErrorSeverity = EMessageSeverity::Warning;
+			OutResult.ErrorMessage = FString::Printf(TEXT("File %s does not exist"), *LoadPath);
+			return false;
+		}
+
+		if (!LoadPath.EndsWith(TEXT(".json")))
+		{
+			OutResult.ErrorSeverity = EMessageSeverity::Warning;
+			OutResult.ErrorMessage = FString::Printf(TEXT("Path %s does not end in '.json'"), *LoadPath);
+			return false;
+		}
+
+		TArray<uint8> Buffer;
+		if (FFileHelper::LoadFileToArray(OUT Buffer, *LoadPath) == false)
+		{
+			OutResult.ErrorMessage = FString::Printf(TEXT("Failed to load %s"), *LoadPath);
+			return false;
+		}
+		UE_JSON_DATA_TRACE_FILE_READ(LoadPath, Buffer.Num());
+		if (OutContentHash)
+		{
+			FMD5 MD5;
+			MD5.Update(Buffer.GetData(), Buffer.Num());
+			OutContentHash->Set(MD5);
+		}
+		FFileHelper::BufferToString(OUT OutJsonString, Buffer.GetData(), Buffer.Num());
+
+		UE_LOG(LogJsonDataAsset, Verbose, TEXT("Loaded %s"), *LoadPath);
+		return true;
+	}
+
+	bool ReadCompactBinaryFile(const FString& LoadPath, FJsonFileLoadResult& OutResult)
+	{
+		if (OUU::JsonData::Runtime::ShouldReadFromCookedContent() == false)
+		{
+			return false;
+		}
+
+		DECLARE_SCOPE_CYCLE_COUNTER(TEXT("ReadCompactBinaryFile"), STAT_ReadCompactBinaryFile, STATGROUP_OUUJsonData);
+		LLM_SCOPE_BYTAG(JsonData_Parse);
+
+		const FString BinaryFilePath = GetCompactBinaryFilePath(LoadPath);
+		TArray<uint8> Buffer;
+		FMemoryView CompactBinaryView;
+		{
+			UE_JSON_DATA_TRACE_PHASE(ReadFile);
+			CompactBinaryView = LoadUpToDateCompactBinaryFile(LoadPath, OUT Buffer);
+			if (CompactBinaryView.IsEmpty())
+			{
+				return false;
+			}
+		}
+		UE_JSON_DATA_TRACE_FILE_READ(BinaryFilePath, Buffer.Num());
+
+		OutResult.LoadPath = LoadPath;
+		{
+			UE_JSON_DATA_TRACE_PHASE(Parse);
+			OutResult.JsonObject = CompactBinaryToJsonObject(CompactBinaryView);
+		}
+		if (OutResult.JsonObject.IsValid() == false)
+		{
+			UE_LOG(
+				LogJsonDataAsset,
+				Warning,
+				TEXT("Compact binary file %s is invalid. Falling back to json file."),
+				*BinaryFilePath);
+			return false;
+		}
+
+		UE_LOG(LogJsonDataAsset, Verbose, TEXT("Loaded %s"), *BinaryFilePath);
+		return true;
+	}
+
+	bool ReadBundledJsonFile(const FString& LoadPath, FJsonFileLoadResult& OutResult)
+	{
+		if (OUU::JsonData::Runtime::ShouldReadFromCookedContent() == false)
+		{
+			return false;
+		}
+
+		const auto Bundle = FJsonDataBundle::FindForFile(LoadPath);
+		FString RelativePath;
+		if (Bundle.IsValid() == false || Bundle->TryMakeRelativePath(LoadPath, OUT RelativePath) == false)
+		{
+			return false;
+		}
+
+		const auto* Entry = Bundle->FindEntry(RelativePath);
+		if (Entry == nullptr || Entry->bOverriddenByLooseFile)
+		{
+			return false;
+		}
+
+		DECLARE_SCOPE_CYCLE_COUNTER(TEXT("ReadBundledJsonFile"), STAT_ReadBundledJsonFile, STATGROUP_OUUJsonData);
+		LLM_SCOPE_BYTAG(JsonData_Parse);
+
+		OutResult.LoadPath = LoadPath;
+		const FMemoryView EntryData = Bundle->GetEntryData(*Entry);
+		UE_JSON_DATA_TRACE_FILE_READ(LoadPath, EntryData.GetSize());
+		UE_JSON_DATA_TRACE_PHASE(Parse);
+		switch (Entry->Format)
+		{
+		case EJsonDataBundleEntryFormat::CompactBinary:
+		{
+			OutResult.JsonObject = CompactBinaryToJsonObject(EntryData);
+			break;
+		}
+		case EJsonDataBundleEntryFormat::Json:
+		{
+			FString JsonString;
+			FFileHelper::BufferToString(
+				OUT JsonString,
+				static_cast<const uint8*>(EntryData.GetData()),
+				static_cast<int32>(EntryData.GetSize()));
+			const TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(JsonString);
+			FJsonSerializer::Deserialize(JsonReader, OUT OutResult.JsonObject);
+			break;
+		}
+		}
+
+		if (OutResult.IsValid() == false)
+		{
+			OutResult.ErrorMessage = FString::Printf(TEXT("Failed to read %s from json data bundle"), *LoadPath);
+		}
+		return true;
+	}
+
+	FJsonFileLoadResult ReadAndParseJsonFile(const FString& LoadPath, FMD5Hash* OutContentHash)
+	{
+		DECLARE_SCOPE_CYCLE_COUNTER(TEXT("ReadAndParseJsonFile"), STAT_ReadAndParseJsonFile, STATGROUP_OUUJsonData);
+		LLM_SCOPE_BYTAG(JsonData_Parse);
+
+		FJsonFileLoadResult Result;
+		if (ReadBundledJsonFile(LoadPath, OUT Result) || ReadCompactBinaryFile(LoadPath, OUT Result))
+		{
+			return Result;
+		}
+
+		FString JsonString;
+		if (ReadJsonFile(LoadPath, OUT JsonString, OUT Result, OutContentHash) == false)
+		{
+			return Result;
+		}
+
+		UE_JSON_DATA_TRACE_PHASE(Parse);
+		TSharedPtr<FJsonObject> JsonObject;
+		TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(JsonString);
+		if (!FJsonSerializer::Deserialize(JsonReader, JsonObject) || !JsonObject.IsValid())
+		{
+			UE_LOG(LogJsonDataAsset, Error, TEXT("LoadJsonDataAsset - Unable to parse json=[%s]"), *JsonString);
+			Result.ErrorMessage = FString::Printf(
+				TEXT("Failed to parse json for %s. See output log above for more information"),
+				*LoadPath);
+			return Result;
+		}
+
+		Result.JsonObject = JsonObject;
+		return Result;
+	}
+
+	// Check whether the file already contains the exact bytes that FFileHelper::SaveStringToFile would write for the
+	// json string with EEncodingOptions::ForceUTF8.
+	bool IsJsonFileUpToDate(const FString& FilePath, const FString& JsonString)
+	{
+		const FTCHARToUTF8 Utf8String(*JsonString, JsonString.Len());
+		const int64 ExpectedSize = sizeof(Utf8ByteOrderMark) + Utf8String.Length();
+
+		// Check the size first, so most changed files don't have to be read.
+		if (IFileManager::Get().FileSize(*FilePath) != ExpectedSize)
+		{
+			return false;
+		}
+
+		TArray64<uint8> FileBytes;
+		if (FFileHelper::LoadFileToArray(OUT FileBytes, *FilePath, FILEREAD_Silent) == false
+			|| FileBytes.Num() != ExpectedSize)
+		{
+			return false;
+		}
+
+		return FMemory::Memcmp(FileBytes.GetData(), Utf8ByteOrderMark, sizeof(Utf8ByteOrderMark)) == 0
+			&& FMemory::Memcmp(
+				   FileBytes.GetData() + sizeof(Utf8ByteOrderMark),
+				   Utf8String.Get(),
+				   Utf8String.Length())
+			== 0;
+	}
 } // namespace OUU::JsonData::Runtime::Private
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -68,13 +395,171 @@ bool UJsonDataAsset::IsFileBasedJsonAsset() const
 bool UJsonDataAsset::ImportJson(TSharedPtr<FJsonObject> JsonObject, bool bCheckClassMatches)
 {
 	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UJsonDataAsset::ImportJson"), STAT_ImportJson, STATGROUP_OUUJsonData);
+	// Covers instanced subobjects that are created by the import.
+	LLM_SCOPE_BYTAG(JsonData_Objects);
 
 	// ---
 	// Header information
 	// ---
+	FEngineVersion EngineVersion;
+	FJsonDataCustomVersions CustomVersions;
+	if (!ImportJsonHeader(*JsonObject, bCheckClassMatches, OUT EngineVersion, OUT CustomVersions))
+	{
+		return false;
+	}
+
+	// ---
+	// Property data
+	// ---
+
+	auto Data = JsonObject->GetObjectField(OUU::JsonData::Runtime::Private::DataFieldName);
+	if (!Data.IsValid())
+	{
+		UE_JSON_DATA_MESSAGELOG(Error, this, TEXT("Json file does not contain a 'Data' field"));
+		return false;
+	}
+
+	// Hash the json values, so the next reimport only has to import the properties that changed.
+	using OUU::JsonData::Runtime::Private::FJsonDataAssetDiffReimport;
+	auto& DiffReimport = FJsonDataAssetDiffReimport::Get();
+	const bool bTrackImportedProperties = FJsonDataAssetDiffReimport::IsEnabled();
+	FJsonDataAssetDiffReimport::FImportHashes ImportHashes;
+	if (bTrackImportedProperties)
+	{
+		ImportHashes = FJsonDataAssetDiffReimport::HashJson(GetClass(), *JsonObject, *Data);
+	}
+
+	TSharedPtr<FJsonObject> ChangedData;
+	{
+		UE_JSON_DATA_TRACE_PHASE(ResetToDefaults);
+		TArray<FProperty*> ChangedProperties;
+		if (bTrackImportedProperties
+			&& DiffReimport.FindChangedProperties(*this, ImportHashes, *Data, OUT ChangedProperties, OUT ChangedData))
+		{
+			const UObject* CDO = GetClass()->GetDefaultObject();
+			for (const auto* Property : ChangedProperties)
+			{
+				Property->CopyCompleteValue_InContainer(this, CDO);
+			}
+		}
+		else
+		{
+			ResetToClassDefaults();
+			ChangedData = Data;
+		}
+	}
+
+	// The previous hashes are only valid until the object was (partially) modified by the import below.
+	DiffReimport.ResetImportHashes(*this);
+
+	FArchive VersionLoadingArchive;
+	VersionLoadingArchive.SetIsLoading(true);
+	VersionLoadingArchive.SetIsPersistent(true);
+	VersionLoadingArchive.SetCustomVersions(CustomVersions.ToCustomVersionContainer());
+
+	{
+		UE_JSON_DATA_TRACE_PHASE(ImportProperties);
+		UE_JSON_DATA_TRACE_IMPORTED_PROPERTIES(ChangedData->Values.Num());
+		if (!UOUUJsonLibrary::JsonObjectToUStruct(
+				ChangedData.ToSharedRef(),
+				GetClass(),
+				this,
+				VersionLoadingArchive,
+				0,
+				0))
+		{
+			UE_JSON_DATA_MESSAGELOG(Error, this, TEXT("Failed to import json 'Data' field into UObject properties"));
+			return false;
+		}
+	}
+
+	if (bTrackImportedProperties)
+	{
+		DiffReimport.SetImportHashes(*this, MoveTemp(ImportHashes));
+	}
+
+	// Always pass the complete data, also after partial imports.
+	UE_JSON_DATA_TRACE_PHASE(PostLoadJsonData);
+	return PostLoadJsonData(EngineVersion, VersionLoadingArchive, Data.ToSharedRef());
+}
+
+bool UJsonDataAsset::ImportJsonStreamed(
+	const TSharedRef<FJsonObject>& HeaderObject,
+	const FString& JsonString,
+	bool bCheckClassMatches)
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(
+		TEXT("UJsonDataAsset::ImportJsonStreamed"),
+		STAT_ImportJsonStreamed,
+		STATGROUP_OUUJsonData);
+	LLM_SCOPE_BYTAG(JsonData_Objects);
+
+	FEngineVersion EngineVersion;
+	FJsonDataCustomVersions CustomVersions;
+	if (!ImportJsonHeader(*HeaderObject, bCheckClassMatches, OUT EngineVersion, OUT CustomVersions))
+	{
+		return false;
+	}
+
+	// Streamed data is never hashed, so the next reimport has to import all properties.
+	OUU::JsonData::Runtime::Private::FJsonDataAssetDiffReimport::Get().ResetImportHashes(*this);
+
+	FArchive VersionLoadingArchive;
+	VersionLoadingArchive.SetIsLoading(true);
+	VersionLoadingArchive.SetIsPersistent(true);
+	VersionLoadingArchive.SetCustomVersions(CustomVersions.ToCustomVersionContainer());
+
+	bool bFoundData = false;
+	bool bImportedData = false;
+	OUU::JsonData::Runtime::Private::VisitTopLevelJsonFields(
+		JsonString,
+		[&](TJsonReader<>& JsonReader, EJsonNotation Notation) {
+			using OUU::JsonData::Runtime::Private::EJsonFieldVisitResult;
+			if (Notation != EJsonNotation::ObjectStart
+				|| JsonReader.GetIdentifier() != OUU::JsonData::Runtime::Private::DataFieldName)
+			{
+				return UOUUJsonLibrary::SkipJsonReaderValue(JsonReader, Notation) ? EJsonFieldVisitResult::Continue
+																				   : EJsonFieldVisitResult::Error;
+			}
+
+			bFoundData = true;
+			{
+				UE_JSON_DATA_TRACE_PHASE(ResetToDefaults);
+				ResetToClassDefaults();
+			}
+			// The properties are read directly from the json string, so no property count is traced.
+			UE_JSON_DATA_TRACE_PHASE(ImportProperties);
+			bImportedData = UOUUJsonLibrary::JsonReaderToUStruct(JsonReader, GetClass(), this, VersionLoadingArchive);
+			return EJsonFieldVisitResult::Stop;
+		});
+
+	if (bFoundData == false)
+	{
+		UE_JSON_DATA_MESSAGELOG(Error, this, TEXT("Json file does not contain a 'Data' field"));
+		return false;
+	}
+
+	if (bImportedData == false)
+	{
+		UE_JSON_DATA_MESSAGELOG(Error, this, TEXT("Failed to import json 'Data' field into UObject properties"));
+		return false;
+	}
+
+	// Classes that support streaming import must not rely on the json object in PostLoadJsonData.
+	UE_JSON_DATA_TRACE_PHASE(PostLoadJsonData);
+	return PostLoadJsonData(EngineVersion, VersionLoadingArchive, MakeShared<FJsonObject>());
+}
+
+bool UJsonDataAsset::ImportJsonHeader(
+	const FJsonObject& JsonObject,
+	bool bCheckClassMatches,
+	FEngineVersion& OutEngineVersion,
+	FJsonDataCustomVersions& OutCustomVersions)
+{
 	if (bCheckClassMatches)
 	{
-		FString ClassName = JsonObject->GetStringField(TEXT("Class"));
+		UE_JSON_DATA_TRACE_PHASE(ResolveClass);
+		FString ClassName = JsonObject.GetStringField(TEXT("Class"));
 		// Better search for the class instead of mandating a perfect string match
 		auto* JsonClass = ResolveObjectPath<UClass>(ClassName, false);
 
@@ -96,26 +581,25 @@ bool UJsonDataAsset::ImportJson(TSharedPtr<FJsonObject> JsonObject, bool bCheckC
 		}
 	}
 
-	FEngineVersion EngineVersion;
-	if (JsonObject->HasField(TEXT("EngineVersion")))
+	if (JsonObject.HasField(TEXT("EngineVersion")))
 	{
-		const FString JsonVersionString = JsonObject->GetStringField(TEXT("EngineVersion"));
-		const bool bIsLicenseeVersion = JsonObject->GetBoolField(TEXT("IsLicenseeVersion"));
-		if (!FEngineVersion::Parse(JsonVersionString, OUT EngineVersion))
+		const FString JsonVersionString = JsonObject.GetStringField(TEXT("EngineVersion"));
+		const bool bIsLicenseeVersion = JsonObject.GetBoolField(TEXT("IsLicenseeVersion"));
+		if (!FEngineVersion::Parse(JsonVersionString, OUT OutEngineVersion))
 		{
 			UE_JSON_DATA_MESSAGELOG(Error, this, TEXT("Json file has an invalid 'EngineVersion' field value"));
 			return false;
 		}
 
-		uint32 Changelist = EngineVersion.GetChangelist();
-		EngineVersion.Set(
-			EngineVersion.GetMajor(),
-			EngineVersion.GetMinor(),
-			EngineVersion.GetPatch(),
+		uint32 Changelist = OutEngineVersion.GetChangelist();
+		OutEngineVersion.Set(
+			OutEngineVersion.GetMajor(),
+			OutEngineVersion.GetMinor(),
+			OutEngineVersion.GetPatch(),
 			Changelist | (bIsLicenseeVersion ? (1U << 31) : 0),
-			EngineVersion.GetBranch());
+			OutEngineVersion.GetBranch());
 
-		if (!FEngineVersion::Current().IsCompatibleWith(EngineVersion))
+		if (!FEngineVersion::Current().IsCompatibleWith(OutEngineVersion))
 		{
 			UE_JSON_DATA_MESSAGELOG(
 				Error,
@@ -131,79 +615,56 @@ bool UJsonDataAsset::ImportJson(TSharedPtr<FJsonObject> JsonObject, bool bCheckC
 		}
 	}
 
-	FJsonDataCustomVersions CustomVersions;
 	const TSharedPtr<FJsonObject>* ppCustomVersionsObject = nullptr;
-	if (JsonObject->TryGetObjectField(TEXT("CustomVersions"), ppCustomVersionsObject))
-	{
-		CustomVersions.ReadFromJsonObject(*ppCustomVersionsObject);
-	}
-
-	// ---
-	// Property data
-	// ---
-
-	auto Data = JsonObject->GetObjectField(TEXT("Data"));
-	if (!Data.IsValid())
+	if (JsonObject.TryGetObjectField(TEXT("CustomVersions"), ppCustomVersionsObject))
 	{
-		UE_JSON_DATA_MESSAGELOG(Error, this, TEXT("Json file does not contain a 'Data' field"));
-		return false;
+		OutCustomVersions.ReadFromJsonObject(*ppCustomVersionsObject);
 	}
 
-	// Reset object properties to class defaults
-	{
-		auto* CDO = GetClass()->GetDefaultObject();
-		UEngine::FCopyPropertiesForUnrelatedObjectsParams Options;
-		UEngine::CopyPropertiesForUnrelatedObjects(CDO, this, Options);
-	}
+	return true;
+}
 
-	FArchive VersionLoadingArchive;
-	VersionLoadingArchive.SetIsLoading(true);
-	VersionLoadingArchive.SetIsPersistent(true);
-	VersionLoadingArchive.SetCustomVersions(CustomVersions.ToCustomVersionContainer());
+TSharedRef<FJsonObject> UJsonDataAsset::ExportJsonHeader() const
+{
+	auto Result = MakeShared<FJsonObject>();
+	Result->SetStringField(TEXT("Class"), GetClass()->GetPathName());
+	Result->SetStringField(TEXT("EngineVersion"), FEngineVersion::Current().ToString());
+	Result->SetBoolField(TEXT("IsLicenseeVersion"), FEngineVersion::Current().IsLicenseeVersion());
 
-	if (!UOUUJsonLibrary::JsonObjectToUStruct(Data.ToSharedRef(), GetClass(), this, VersionLoadingArchive, 0, 0))
-	{
-		UE_JSON_DATA_MESSAGELOG(Error, this, TEXT("Failed to import json 'Data' field into UObject properties"));
-		return false;
-	}
+	FJsonDataCustomVersions CustomVersions(GetAdditionalRelevantCustomVersions());
+	CustomVersions.CollectVersions(GetClass(), this);
+	Result->SetObjectField(TEXT("CustomVersions"), CustomVersions.ToJsonObject());
+	return Result;
+}
 
-	return PostLoadJsonData(EngineVersion, VersionLoadingArchive, Data.ToSharedRef());
+void UJsonDataAsset::ResetToClassDefaults()
+{
+	auto* CDO = GetClass()->GetDefaultObject();
+	UEngine::FCopyPropertiesForUnrelatedObjectsParams Options;
+	UEngine::CopyPropertiesForUnrelatedObjects(CDO, this, Options);
 }
 
 TSharedRef<FJsonObject> UJsonDataAsset::ExportJson() const
 {
 	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UJsonDataAsset::ExportJson"), STAT_ExportJson, STATGROUP_OUUJsonData);
 
-	auto Result = MakeShared<FJsonObject>();
-
-	// Header information
-	{
-		Result->SetStringField(TEXT("Class"), GetClass()->GetPathName());
-		Result->SetStringField(TEXT("EngineVersion"), FEngineVersion::Current().ToString());
-		Result->SetBoolField(TEXT("IsLicenseeVersion"), FEngineVersion::Current().IsLicenseeVersion());
-
-		FJsonDataCustomVersions CustomVersions(GetAdditionalRelevantCustomVersions());
-		CustomVersions.CollectVersions(GetClass(), this);
-		Result->SetObjectField(TEXT("CustomVersions"), CustomVersions.ToJsonObject());
-	}
+	auto Result = ExportJsonHeader();
 
 	// Property data
 	{
-		FOUUJsonLibraryObjectFilter Filter;
-		Filter.SubObjectDepthLimit = 0;
-
-		// No requirements. We had Edit here before which prevented hidden properties that aren't editable in UI
-		constexpr int64 CheckFlags = 0;
-		constexpr int64 SkipFlags = CPF_Transient;
-
 		// Data going into the cooked content directory should write all properties into the files to have a baseline
 		// for modders. Data going into the regular editor saves should perform delta serialization to support
 		// propagation of values from base class defaults.
 		const bool bOnlyModifiedProperties = OUU::JsonData::Runtime::ShouldWriteToCookedContent() == false;
 
 		Result->SetObjectField(
-			TEXT("Data"),
-			UOUUJsonLibrary::UObjectToJsonObject(this, Filter, CheckFlags, SkipFlags, bOnlyModifiedProperties));
+			OUU::JsonData::Runtime::Private::DataFieldName,
+			UOUUJsonLibrary::UObjectToJsonObject(
+				this,
+				OUU::JsonData::Runtime::Private::GetExportSubObjectFilter(),
+				OUU::JsonData::Runtime::Private::ExportCheckFlags,
+				OUU::JsonData::Runtime::Private::ExportSkipFlags,
+				bOnlyModifiedProperties));
 	}
 
 	return Result;
@@ -268,6 +729,22 @@ bool UJsonDataAsset::ExportJsonFile() const
 
 	const FString SavePath = GetJsonFilePathAbs(EJsonDataAccessMode::Write);
 
+	// The file is about to contain the current object state instead of the last imported data.
+	OUU::JsonData::Runtime::Private::FJsonDataAssetDiffReimport::Get().ResetImportHashes(*this);
+
+	if (OUU::JsonData::Runtime::ShouldWriteToCookedContent()
+		&& OUU::JsonData::Runtime::Private::CVar_StreamingExport.GetValueOnAnyThread()
+		&& OUU::JsonData::Runtime::Private::CVar_CookCompactBinary.GetValueOnAnyThread() == false)
+	{
+		if (ExportJsonFileStreamed(SavePath) == false)
+		{
+			return false;
+		}
+		UJsonDataAssetSubsystem::Get().NotifySourceFileWritten(SavePath);
+		OUU::JsonData::Runtime::Private::DeleteCompactBinaryFile(SavePath);
+		return true;
+	}
+
 	const TSharedRef<FJsonObject> JsonObject = ExportJson();
 	FString JsonString;
 	const TSharedRef<TJsonWriter<>> JsonWriter = TJsonWriterFactory<>::Create(OUT & JsonString);
@@ -277,10 +754,34 @@ bool UJsonDataAsset::ExportJsonFile() const
 		return false;
 	}
 
+	// Saving unchanged assets must neither touch the file nor source control.
+	if (OUU::JsonData::Runtime::Private::IsJsonFileUpToDate(SavePath, JsonString))
+	{
+		UE_LOG(LogJsonDataAsset, Verbose, TEXT("ExportJsonFile - Skipped unchanged %s"), *SavePath);
+		if (OUU::JsonData::Runtime::ShouldWriteToCookedContent())
+		{
+			OUU::JsonData::Runtime::Private::UpdateCompactBinaryFile(*JsonObject, SavePath);
+		}
+		return true;
+	}
+
 #if WITH_EDITOR
-	if (OUU::JsonData::Runtime::ShouldWriteToCookedContent() == false)
+	if (OUU::JsonData::Runtime::ShouldWriteToCookedContent() == false
+		&& IFileManager::Get().IsReadOnly(*SavePath))
 	{
-		USourceControlHelpers::CheckOutFile(SavePath, true);
+		// Source controlled files must be checked out before they are modified. Only new files and files that are
+		// already checked out are left to the queued source control operations.
+		if (OUU::JsonData::Runtime::Private::FJsonDataSourceControlQueue::Get().CheckOutBeforeWrite(SavePath) == false)
+		{
+			UE_JSON_DATA_MESSAGELOG(Error, this, TEXT("failed to check out file %s"), *SavePath);
+			return false;
+		}
+
+		// Files that are read-only without being source controlled (or without source control) are overwritten.
+		if (IFileManager::Get().IsReadOnly(*SavePath))
+		{
+			FPlatformFileManager::Get().GetPlatformFile().SetReadOnly(*SavePath, false);
+		}
 	}
 #endif
 
@@ -290,16 +791,74 @@ bool UJsonDataAsset::ExportJsonFile() const
 		return false;
 	}
 	UE_LOG(LogJsonDataAsset, Log, TEXT("ExportJsonFile - Saved %s"), *SavePath);
+	UJsonDataAssetSubsystem::Get().NotifySourceFileWritten(SavePath);
+
+	if (OUU::JsonData::Runtime::ShouldWriteToCookedContent())
+	{
+		OUU::JsonData::Runtime::Private::UpdateCompactBinaryFile(*JsonObject, SavePath);
+	}
 
 #if WITH_EDITOR
 	if (OUU::JsonData::Runtime::ShouldWriteToCookedContent() == false)
 	{
-		if (USourceControlHelpers::CheckOutOrAddFile(SavePath) == false)
+		OUU::JsonData::Runtime::Private::FJsonDataSourceControlQueue::Get().QueueCheckOutOrAdd(SavePath);
+	}
+#endif
+	return true;
+}
+
+bool UJsonDataAsset::ExportJsonFileStreamed(const FString& SavePath) const
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(
+		TEXT("UJsonDataAsset::ExportJsonFileStreamed"),
+		STAT_ExportJsonFileStreamed,
+		STATGROUP_OUUJsonData);
+
+	bool bSuccess = false;
+	{
+		const TUniquePtr<FArchive> FileWriter(IFileManager::Get().CreateFileWriter(*SavePath));
+		if (FileWriter.IsValid() == false)
+		{
+			UE_JSON_DATA_MESSAGELOG(Error, this, TEXT("Failed to open file %s for writing"), *SavePath);
+			return false;
+		}
+
+		// Write the same byte order mark as the DOM export, so both exports produce identical files.
+		FileWriter->Serialize(
+			const_cast<uint8*>(OUU::JsonData::Runtime::Private::Utf8ByteOrderMark),
+			sizeof(OUU::JsonData::Runtime::Private::Utf8ByteOrderMark));
+
+		const TSharedRef<TJsonWriter<UTF8CHAR>> JsonWriter = TJsonWriterFactory<UTF8CHAR>::Create(FileWriter.Get());
+		JsonWriter->WriteObjectStart();
+		for (const auto& HeaderField : ExportJsonHeader()->Values)
+		{
+			UOUUJsonLibrary::JsonValueToJsonWriter(HeaderField.Value, *JsonWriter, HeaderField.Key);
+		}
+		// Streaming exports always write all properties, which is what we want for cooked content anyways.
+		bSuccess = UOUUJsonLibrary::UObjectToJsonWriter(
+			this,
+			*JsonWriter,
+			OUU::JsonData::Runtime::Private::DataFieldName,
+			OUU::JsonData::Runtime::Private::GetExportSubObjectFilter(),
+			OUU::JsonData::Runtime::Private::ExportCheckFlags,
+			OUU::JsonData::Runtime::Private::ExportSkipFlags);
+		if (bSuccess)
 		{
-			UE_JSON_DATA_MESSAGELOG(Error, this, TEXT("failed to check out or add file"));
+			JsonWriter->WriteObjectEnd();
 		}
+		bSuccess &= JsonWriter->Close();
+		bSuccess &= FileWriter->Close();
 	}
-#endif
+
+	if (bSuccess == false)
+	{
+		// Don't leave incomplete json files behind
+		IFileManager::Get().Delete(*SavePath);
+		UE_JSON_DATA_MESSAGELOG(Error, this, TEXT("Failed to write json file %s"), *SavePath);
+		return false;
+	}
+
+	UE_LOG(LogJsonDataAsset, Log, TEXT("ExportJsonFile - Saved %s (streamed)"), *SavePath);
 	return true;
 }
 
@@ -333,6 +892,11 @@ TSet<FGuid> UJsonDataAsset::GetAdditionalRelevantCustomVersions() const
 	return {};
 }
 
+bool UJsonDataAsset::SupportsStreamingImport() const
+{
+	return false;
+}
+
 UJsonDataAsset* UJsonDataAsset::LoadJsonDataAsset_Internal(FJsonDataAssetPath Path, UJsonDataAsset* ExistingDataAsset)
 {
 	if (Path.IsNull())
@@ -345,45 +909,126 @@ UJsonDataAsset* UJsonDataAsset::LoadJsonDataAsset_Internal(FJsonDataAssetPath Pa
 		STAT_LoadJsonInternal,
 		STATGROUP_OUUJsonData);
 
-	const FString InPackagePath = Path.GetPackagePath();
-	const FString LoadPath = OUU::JsonData::Runtime::PackageToSourceFull(InPackagePath, EJsonDataAccessMode::Read);
+	const FString PackagePath = Path.GetPackagePath();
+	// The only trace scope of synchronous loads. Callers of ImportJsonDataAsset_Internal open their own.
+	UE_JSON_DATA_TRACE_ASSET_LOAD(PackagePath);
 
-	if (!FPaths::FileExists(LoadPath))
-	{
-		UE_JSON_DATA_MESSAGELOG(Warning, nullptr, TEXT("File %s does not exist"), *LoadPath);
-		return nullptr;
-	}
+	const FString LoadPath = OUU::JsonData::Runtime::PackageToSourceFull(PackagePath, EJsonDataAccessMode::Read);
 
-	if (!LoadPath.EndsWith(TEXT(".json")))
+	// Files that were prefetched with their dependency closure were already parsed on a worker thread.
+	// Reloads of existing assets always read the file again and just drop the prefetched result.
 	{
-		UE_JSON_DATA_MESSAGELOG(Warning, nullptr, TEXT("Path %s does not end in '.json'"), *LoadPath);
-		return nullptr;
+		OUU::JsonData::Runtime::Private::FJsonFileLoadResult LoadResult;
+		if (OUU::JsonData::Runtime::Private::FJsonDataPrefetchCache::Get().TakePrefetchResult(LoadPath, OUT LoadResult)
+			&& ExistingDataAsset == nullptr)
+		{
+			if (LoadResult.IsValid() == false)
+			{
+				LoadResult.ReportError();
+				return nullptr;
+			}
+			return ImportJsonDataAsset_Internal(Path, nullptr, LoadPath, LoadResult.JsonObject.ToSharedRef());
+		}
 	}
 
-	FString JsonString;
-	if (FFileHelper::LoadFileToString(JsonString, *LoadPath))
+	// Bundled entries and compact binary files are decoded into a json object directly. Only loose json files are
+	// streamed.
 	{
-		UE_LOG(LogJsonDataAsset, Verbose, TEXT("Loaded %s"), *LoadPath);
+		OUU::JsonData::Runtime::Private::FJsonFileLoadResult LoadResult;
+		if (OUU::JsonData::Runtime::Private::ReadBundledJsonFile(LoadPath, OUT LoadResult)
+			|| OUU::JsonData::Runtime::Private::ReadCompactBinaryFile(LoadPath, OUT LoadResult))
+		{
+			if (LoadResult.IsValid() == false)
+			{
+				LoadResult.ReportError();
+				return nullptr;
+			}
+			return ImportJsonDataAsset_Internal(Path, ExistingDataAsset, LoadPath, LoadResult.JsonObject.ToSharedRef());
+		}
 	}
-	else
+
+	if (OUU::JsonData::Runtime::Private::CVar_StreamingImport.GetValueOnGameThread())
 	{
-		UE_JSON_DATA_MESSAGELOG(Error, nullptr, TEXT("Failed to load %s"), *LoadPath);
-		return nullptr;
+		OUU::JsonData::Runtime::Private::FJsonFileLoadResult LoadResult;
+		FString JsonString;
+		if (OUU::JsonData::Runtime::Private::ReadJsonFile(LoadPath, OUT JsonString, OUT LoadResult) == false)
+		{
+			LoadResult.ReportError();
+			return nullptr;
+		}
+
+		// Only stream if the target class supports it. Otherwise we need the full json object for PostLoadJsonData.
+		// Reimports of existing objects need the json object to only import the properties that changed.
+		const UClass* TargetClass = nullptr;
+		{
+			UE_JSON_DATA_TRACE_PHASE(ResolveClass);
+			TargetClass = IsValid(ExistingDataAsset)
+				? ExistingDataAsset->GetClass()
+				: ResolveObjectPath<UClass>(OUU::JsonData::Runtime::Private::PeekJsonClassName(JsonString), true);
+		}
+		const bool bDiffReimport = IsValid(ExistingDataAsset)
+			&& OUU::JsonData::Runtime::Private::FJsonDataAssetDiffReimport::IsEnabled();
+		const bool bStreamData = TargetClass && TargetClass->IsChildOf<UJsonDataAsset>()
+			&& TargetClass->GetDefaultObject<UJsonDataAsset>()->SupportsStreamingImport() && bDiffReimport == false;
+
+		TSharedPtr<FJsonObject> JsonObject;
+		{
+			LLM_SCOPE_BYTAG(JsonData_Parse);
+			UE_JSON_DATA_TRACE_PHASE(Parse);
+			if (bStreamData)
+			{
+				JsonObject = OUU::JsonData::Runtime::Private::ParseJsonHeader(JsonString);
+			}
+			else
+			{
+				const TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(JsonString);
+				FJsonSerializer::Deserialize(JsonReader, OUT JsonObject);
+			}
+		}
+
+		if (JsonObject.IsValid() == false)
+		{
+			UE_JSON_DATA_MESSAGELOG(
+				Error,
+				nullptr,
+				TEXT("Failed to parse json for %s. See output log above for more information"),
+				*LoadPath);
+			return nullptr;
+		}
+
+		return ImportJsonDataAsset_Internal(
+			Path,
+			ExistingDataAsset,
+			LoadPath,
+			JsonObject.ToSharedRef(),
+			bStreamData ? &JsonString : nullptr);
 	}
 
-	TSharedPtr<FJsonObject> JsonObject;
-	TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(JsonString);
-	if (!FJsonSerializer::Deserialize(JsonReader, JsonObject) || !JsonObject.IsValid())
+	const auto LoadResult = OUU::JsonData::Runtime::Private::ReadAndParseJsonFile(LoadPath);
+	if (LoadResult.IsValid() == false)
 	{
-		UE_LOG(LogJsonDataAsset, Error, TEXT("LoadJsonDataAsset - Unable to parse json=[%s]"), *JsonString);
-		UE_JSON_DATA_MESSAGELOG(
-			Error,
-			nullptr,
-			TEXT("Failed to parse json for %s. See output log above for more information"),
-			*LoadPath);
+		LoadResult.ReportError();
 		return nullptr;
 	}
 
+	return ImportJsonDataAsset_Internal(Path, ExistingDataAsset, LoadPath, LoadResult.JsonObject.ToSharedRef());
+}
+
+UJsonDataAsset* UJsonDataAsset::ImportJsonDataAsset_Internal(
+	const FJsonDataAssetPath& Path,
+	UJsonDataAsset* ExistingDataAsset,
+	const FString& LoadPath,
+	const TSharedRef<FJsonObject>& JsonObject,
+	const FString* StreamingJsonString /* = nullptr */)
+{
+	check(IsInGameThread());
+
+	DECLARE_SCOPE_CYCLE_COUNTER(
+		TEXT("UJsonDataAsset::ImportJsonDataAsset_Internal"),
+		STAT_ImportJsonInternal,
+		STATGROUP_OUUJsonData);
+
+	const FString InPackagePath = Path.GetPackagePath();
 	const FString ObjectName = OUU::JsonData::Runtime::PackageToObjectName(InPackagePath);
 	FString PackageFilename;
 
@@ -404,8 +1049,12 @@ UJsonDataAsset* UJsonDataAsset::LoadJsonDataAsset_Internal(FJsonDataAssetPath Pa
 	else
 	{
 		FString ClassName = JsonObject->GetStringField(TEXT("Class"));
-		// Need to use TryLoad() instead of ResolveObject() so blueprint classes can be loaded.
-		auto* pClass = ResolveObjectPath<UClass>(ClassName, true);
+		UClass* pClass = nullptr;
+		{
+			UE_JSON_DATA_TRACE_PHASE(ResolveClass);
+			// Need to use TryLoad() instead of ResolveObject() so blueprint classes can be loaded.
+			pClass = ResolveObjectPath<UClass>(ClassName, true);
+		}
 		if (!pClass)
 		{
 			UE_JSON_DATA_MESSAGELOG(
@@ -429,6 +1078,7 @@ UJsonDataAsset* UJsonDataAsset::LoadJsonDataAsset_Internal(FJsonDataAssetPath Pa
 			return nullptr;
 		}
 
+		LLM_SCOPE_BYTAG(JsonData_Objects);
 		UPackage* GeneratedPackage = CreatePackage(*InPackagePath);
 		ExistingOrGeneratedAsset =
 			NewObject<UJsonDataAsset>(GeneratedPackage, pClass, *ObjectName, RF_Public | RF_Standalone);
@@ -437,17 +1087,44 @@ UJsonDataAsset* UJsonDataAsset::LoadJsonDataAsset_Internal(FJsonDataAssetPath Pa
 	}
 
 	checkf(IsValid(ExistingOrGeneratedAsset), TEXT("The json asset is expected to be valid at this point"));
-	if (!ExistingOrGeneratedAsset->ImportJson(JsonObject, bCheckClassMatches))
+	if (StreamingJsonString && ExistingOrGeneratedAsset->SupportsStreamingImport())
 	{
-		return nullptr;
+		if (!ExistingOrGeneratedAsset->ImportJsonStreamed(JsonObject, *StreamingJsonString, bCheckClassMatches))
+		{
+			return nullptr;
+		}
+	}
+	else
+	{
+		TSharedPtr<FJsonObject> FullJsonObject = JsonObject;
+		if (StreamingJsonString)
+		{
+			// We only have the header information, but the existing object can't be streamed into.
+			LLM_SCOPE_BYTAG(JsonData_Parse);
+			UE_JSON_DATA_TRACE_PHASE(Parse);
+			const TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(*StreamingJsonString);
+			if (!FJsonSerializer::Deserialize(JsonReader, OUT FullJsonObject) || !FullJsonObject.IsValid())
+			{
+				UE_JSON_DATA_MESSAGELOG(Error, nullptr, TEXT("Failed to parse json for %s"), *LoadPath);
+				return nullptr;
+			}
+		}
+
+		if (!ExistingOrGeneratedAsset->ImportJson(FullJsonObject, bCheckClassMatches))
+		{
+			return nullptr;
+		}
 	}
 
 	if (!IsValid(ExistingDataAsset))
 	{
 		// Notify the asset registry
+		UE_JSON_DATA_TRACE_PHASE(NotifyAssetRegistry);
 		FAssetRegistryModule::AssetCreated(ExistingOrGeneratedAsset);
 	}
 
+	OUU::JsonData::Runtime::Private::FJsonDataAssetResidencyManager::Get().NotifyImported(*ExistingOrGeneratedAsset);
+
 	return ExistingOrGeneratedAsset;
 }
 
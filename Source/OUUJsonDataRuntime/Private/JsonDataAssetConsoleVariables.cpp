@@ -2,6 +2,8 @@
 
 #include "JsonDataAssetConsoleVariables.h"
 
+#include "Async/TaskGraphInterfaces.h"
+#include "JsonDataAssetMemory.h"
 #include "JsonDataAssetSubsystem.h"
 
 namespace OUU::JsonData::Runtime::Private
@@ -44,6 +46,85 @@ namespace OUU::JsonData::Runtime::Private
 		TEXT("If true, files with invalid extensions inside the Data/ folder will be ignored during 'import all "
 			 "assets' calls."));
 
+	TAutoConsoleVariable<bool> CVar_StreamingImport(
+		TEXT("ouu.JsonData.StreamingImport"),
+		true,
+		TEXT("If true, synchronous loads of json data assets whose class supports it (see "
+			 "UJsonDataAsset::SupportsStreamingImport) and UOUUJsonLibrary::JsonStringToUObject stream the property "
+			 "data directly from the json tokens into the object instead of building a json object first."));
+
+	TAutoConsoleVariable<bool> CVar_StreamingExport(
+		TEXT("ouu.JsonData.StreamingExport"),
+		true,
+		TEXT("If true, json data assets that are exported into the cooked content directory write the json tokens "
+			 "directly into the file instead of building a json object first. Not used if "
+			 "ouu.JsonData.CookCompactBinary is enabled, because the binary files are created from the json object."));
+
+	TAutoConsoleVariable<bool> CVar_CookCompactBinary(
+		TEXT("ouu.JsonData.CookCompactBinary"),
+		false,
+		TEXT("If true, the cook writes a compact binary file next to each cooked json file. At runtime the binary "
+			 "files are loaded instead of the json files, unless the content of the json file changed (e.g. because "
+			 "it was modded)."));
+
+	TAutoConsoleVariable<bool> CVar_CookBundle(
+		TEXT("ouu.JsonData.CookBundle"),
+		false,
+		TEXT("If true, the cook packs all cooked json files of a root into a single bundle file with a sorted index "
+			 "and removes the loose files. Loose json files that are placed next to the bundle after packaging "
+			 "override the bundled entries."));
+
+	TAutoConsoleVariable<int32> CVar_WatchSourceFiles(
+		TEXT("ouu.JsonData.WatchSourceFiles"),
+		1,
+		TEXT("Watch json source directories for changes and reimport changed files automatically. 0 = never, 1 = in "
+			 "the editor, 2 = in the editor and in development game builds. Only evaluated on startup."),
+		ECVF_ReadOnly);
+
+	TAutoConsoleVariable<bool> CVar_DiffReimport(
+		TEXT("ouu.JsonData.DiffReimport"),
+		false,
+		TEXT("If true, reimporting an already loaded json asset only imports the properties whose json values changed "
+			 "since the last import. Other properties are not reset to class defaults, see "
+			 "UJsonDataAsset::PostLoadJsonData."));
+
+	// Numeric values
+
+	TAutoConsoleVariable<int32> CVar_ImportWorkerCount(
+		TEXT("ouu.JsonData.ImportWorkerCount"),
+		0,
+		TEXT("Max number of threads that read and parse json files in parallel during 'import all assets' calls "
+			 "(including the thread that waits for them). 0 = use all task graph worker threads, 1 = parse all files "
+			 "on a single thread."));
+
+	int32 GetNumImportWorkers()
+	{
+		const int32 WorkerCount = CVar_ImportWorkerCount.GetValueOnAnyThread();
+		if (WorkerCount > 0)
+		{
+			return WorkerCount;
+		}
+		return FMath::Max(1, FTaskGraphInterface::Get().GetNumWorkerThreads());
+	}
+
+	TAutoConsoleVariable<float> CVar_PrefetchLifetime(
+		TEXT("ouu.JsonData.PrefetchLifetime"),
+		30.f,
+		TEXT("Number of seconds that json files prefetched via PrefetchDependencyClosure are kept in memory if they "
+			 "are not loaded."));
+
+	TAutoConsoleVariable<int32> CVar_ResidencyBudgetMB(
+		TEXT("ouu.JsonData.ResidencyBudgetMB"),
+		0,
+		TEXT("Memory budget for loaded json data assets in MB (not used in the editor). If exceeded, the least "
+			 "recently accessed assets become garbage collectable and are reloaded on their next access. "
+			 "0 = keep all loaded assets in memory."));
+
+	TAutoConsoleVariable<float> CVar_SourceWatcherDebounce(
+		TEXT("ouu.JsonData.SourceWatcherDebounce"),
+		0.1f,
+		TEXT("Number of seconds without further json source file changes after which changed files are reimported."));
+
 	// Config strings
 
 	FString GDataSource_Uncooked = TEXT("Data/");
@@ -75,4 +156,18 @@ namespace OUU::JsonData::Runtime::Private
 			}
 			GEngine->GetEngineSubsystem<UJsonDataAssetSubsystem>()->ImportAllAssets(bOnlyMissing);
 		}));
+
+	FAutoConsoleCommand CCommand_DumpMemory(
+		TEXT("ouu.JsonData.DumpMemory"),
+		TEXT("List the resident memory of all loaded json data assets by class and the largest assets sorted by size. "
+			 "Optional parameter [int]: Max number of listed assets (default: 50, 0 lists all)"),
+		FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateLambda(
+			[](const TArray<FString>& Args, FOutputDevice& Ar) -> void {
+				int32 MaxListedAssets = 50;
+				if (Args.Num() > 0)
+				{
+					LexFromString(MaxListedAssets, *Args[0]);
+				}
+				DumpJsonDataAssetMemory(Ar, MaxListedAssets);
+			}));
 } // namespace OUU::JsonData::Runtime::Private
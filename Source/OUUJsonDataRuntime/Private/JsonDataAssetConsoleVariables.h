@@ -18,6 +18,21 @@ namespace OUU::JsonData::Runtime::Private
 	extern TAutoConsoleVariable<bool> CVar_IgnoreLoadErrorsDuringStartupImport;
 	extern TAutoConsoleVariable<bool> CVar_UseFastNetSerialization;
 	extern TAutoConsoleVariable<bool> CVar_IgnoreInvalidExtensions;
+	extern TAutoConsoleVariable<bool> CVar_StreamingImport;
+	extern TAutoConsoleVariable<bool> CVar_StreamingExport;
+	extern TAutoConsoleVariable<bool> CVar_CookCompactBinary;
+	extern TAutoConsoleVariable<bool> CVar_CookBundle;
+	extern TAutoConsoleVariable<int32> CVar_WatchSourceFiles;
+	extern TAutoConsoleVariable<bool> CVar_DiffReimport;
+
+	// Numeric values
+	extern TAutoConsoleVariable<int32> CVar_ImportWorkerCount;
+	extern TAutoConsoleVariable<float> CVar_PrefetchLifetime;
+	extern TAutoConsoleVariable<int32> CVar_ResidencyBudgetMB;
+	extern TAutoConsoleVariable<float> CVar_SourceWatcherDebounce;
+
+	// Returns the number of worker threads to use for parsing json files during ImportAllAssets (at least 1).
+	int32 GetNumImportWorkers();
 
 	// Config strings
 	extern FString GDataSource_Uncooked;
@@ -25,4 +40,5 @@ namespace OUU::JsonData::Runtime::Private
 
 	// Console commands
 	extern FAutoConsoleCommand CCommand_ReimportAllAssets;
+	extern FAutoConsoleCommand CCommand_DumpMemory;
 } // namespace OUU::JsonData::Runtime::Private
@@ -0,0 +1,224 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#include "JsonDataAssetDiffReimport.h"
+
+#include "Dom/JsonObject.h"
+#include "Hash/CityHash.h"
+#include "JsonDataAsset.h"
+#include "JsonDataAssetConsoleVariables.h"
+#include "JsonLibraryImportPlan.h"
+#include "LogJsonDataAsset.h"
+
+namespace OUU::JsonData::Runtime::Private
+{
+	namespace DiffReimport
+	{
+		// Name of the top level json field that contains the property data.
+		const FString DataFieldName = TEXT("Data");
+
+		uint64 HashString(const FString& String, uint64 Seed)
+		{
+			return CityHash64WithSeed(reinterpret_cast<const char*>(*String), String.Len() * sizeof(TCHAR), Seed);
+		}
+
+		// Structural hash of a json value including all nested values.
+		uint64 HashJsonValue(const FJsonValue& Value, uint64 Seed)
+		{
+			uint64 Hash = CityHash64WithSeed(reinterpret_cast<const char*>(&Value.Type), sizeof(Value.Type), Seed);
+			switch (Value.Type)
+			{
+			case EJson::String:
+			{
+				return HashString(Value.AsString(), Hash);
+			}
+			case EJson::Number:
+			{
+				const double Number = Value.AsNumber();
+				return CityHash64WithSeed(reinterpret_cast<const char*>(&Number), sizeof(Number), Hash);
+			}
+			case EJson::Boolean:
+			{
+				const bool bValue = Value.AsBool();
+				return CityHash64WithSeed(reinterpret_cast<const char*>(&bValue), sizeof(bValue), Hash);
+			}
+			case EJson::Array:
+				for (const auto& Element : Value.AsArray())
+				{
+					Hash = Element.IsValid() ? HashJsonValue(*Element, Hash) : CityHash64WithSeed(nullptr, 0, Hash);
+				}
+				return Hash;
+			case EJson::Object:
+				for (const auto& Entry : Value.AsObject()->Values)
+				{
+					Hash = HashString(Entry.Key, Hash);
+					Hash = Entry.Value.IsValid() ? HashJsonValue(*Entry.Value, Hash) : Hash;
+				}
+				return Hash;
+			default:
+				return Hash;
+			}
+		}
+	} // namespace DiffReimport
+
+	FJsonDataAssetDiffReimport& FJsonDataAssetDiffReimport::Get()
+	{
+		static FJsonDataAssetDiffReimport Instance;
+		return Instance;
+	}
+
+	void FJsonDataAssetDiffReimport::Startup()
+	{
+		PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddRaw(
+			this,
+			&FJsonDataAssetDiffReimport::HandlePostGarbageCollect);
+	}
+
+	void FJsonDataAssetDiffReimport::Shutdown()
+	{
+		FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+		HashesByAsset.Empty();
+	}
+
+	bool FJsonDataAssetDiffReimport::IsEnabled()
+	{
+		// Only the editor tracks unsaved modifications of assets (see FindChangedProperties).
+		return GIsEditor && CVar_DiffReimport.GetValueOnGameThread();
+	}
+
+	FJsonDataAssetDiffReimport::FImportHashes FJsonDataAssetDiffReimport::HashJson(
+		const UClass* Class,
+		const FJsonObject& JsonObject,
+		const FJsonObject& Data)
+	{
+		FImportHashes Result;
+		for (const auto& Entry : JsonObject.Values)
+		{
+			if (Entry.Key == DiffReimport::DataFieldName || Entry.Value.IsValid() == false)
+				continue;
+
+			Result.HeaderHash = DiffReimport::HashString(Entry.Key, Result.HeaderHash);
+			Result.HeaderHash = DiffReimport::HashJsonValue(*Entry.Value, Result.HeaderHash);
+		}
+
+		auto& ImportPlanCache = FJsonImportPlanCache::Get();
+		Result.PropertyHashes.Reserve(Data.Values.Num());
+		for (const auto& Entry : Data.Values)
+		{
+			if (Entry.Value.IsValid() == false)
+				continue;
+
+			// The key is part of the hash, so renamed keys (e.g. redirected property names) count as changes.
+			const auto PropertyPlan = ImportPlanCache.FindPropertyPlan(Class, Entry.Key);
+			uint64& Hash = PropertyPlan.Property ? Result.PropertyHashes.FindOrAdd(PropertyPlan.Property->GetFName())
+												 : Result.UnmappedFieldsHash;
+			Hash = DiffReimport::HashString(Entry.Key, Hash);
+			Hash = DiffReimport::HashJsonValue(*Entry.Value, Hash);
+		}
+		return Result;
+	}
+
+	bool FJsonDataAssetDiffReimport::FindChangedProperties(
+		const UJsonDataAsset& Asset,
+		const FImportHashes& Hashes,
+		const FJsonObject& Data,
+		TArray<FProperty*>& OutChangedProperties,
+		TSharedPtr<FJsonObject>& OutChangedData) const
+	{
+		const auto* ImportedHashes = HashesByAsset.Find(FObjectKey(&Asset));
+		if (ImportedHashes == nullptr || ImportedHashes->HeaderHash != Hashes.HeaderHash)
+			return false;
+
+		// Unmapped fields are not imported into any property, so we can't tell which properties depend on them.
+		if (ImportedHashes->UnmappedFieldsHash != Hashes.UnmappedFieldsHash)
+			return false;
+
+		// Unsaved modifications of the object are not covered by the hashes.
+		if (Asset.GetPackage()->IsDirty())
+			return false;
+
+		const UClass* Class = Asset.GetClass();
+		TArray<FName, TInlineAllocator<16>> ChangedPropertyNames;
+		for (const auto& Entry : Hashes.PropertyHashes)
+		{
+			const uint64* pImportedHash = ImportedHashes->PropertyHashes.Find(Entry.Key);
+			if (pImportedHash == nullptr || *pImportedHash != Entry.Value)
+			{
+				ChangedPropertyNames.Add(Entry.Key);
+			}
+		}
+		for (const auto& Entry : ImportedHashes->PropertyHashes)
+		{
+			if (Hashes.PropertyHashes.Contains(Entry.Key) == false)
+			{
+				// Removed from the json file: Needs to be reset to the class default.
+				ChangedPropertyNames.Add(Entry.Key);
+			}
+		}
+
+		OutChangedProperties.Reset();
+		for (const FName& PropertyName : ChangedPropertyNames)
+		{
+			auto* Property = FindFProperty<FProperty>(Class, PropertyName);
+			if (Property == nullptr)
+			{
+				// The property was removed from the class since the last import.
+				return false;
+			}
+
+			// Copying instanced sub-objects from the CDO would share them between objects. Only a full reset creates
+			// new instances.
+			if (Property->ContainsInstancedObjectProperty())
+				return false;
+
+			OutChangedProperties.Add(Property);
+		}
+
+		auto& ImportPlanCache = FJsonImportPlanCache::Get();
+		auto ChangedData = MakeShared<FJsonObject>();
+		for (const auto& Entry : Data.Values)
+		{
+			const auto PropertyPlan = ImportPlanCache.FindPropertyPlan(Class, Entry.Key);
+			if (PropertyPlan.Property && OutChangedProperties.Contains(PropertyPlan.Property))
+			{
+				ChangedData->Values.Add(Entry.Key, Entry.Value);
+			}
+		}
+
+		UE_LOG(
+			LogJsonDataAsset,
+			Verbose,
+			TEXT("%s - Reimporting %i of %i properties"),
+			*Asset.GetPathName(),
+			OutChangedProperties.Num(),
+			Hashes.PropertyHashes.Num());
+
+		OutChangedData = ChangedData;
+		return true;
+	}
+
+	void FJsonDataAssetDiffReimport::SetImportHashes(const UJsonDataAsset& Asset, FImportHashes&& Hashes)
+	{
+		HashesByAsset.Add(FObjectKey(&Asset), MoveTemp(Hashes));
+	}
+
+	void FJsonDataAssetDiffReimport::ResetImportHashes(const UJsonDataAsset& Asset)
+	{
+		HashesByAsset.Remove(FObjectKey(&Asset));
+	}
+
+	void FJsonDataAssetDiffReimport::ResetAllImportHashes()
+	{
+		HashesByAsset.Empty();
+	}
+
+	void FJsonDataAssetDiffReimport::HandlePostGarbageCollect()
+	{
+		for (auto It = HashesByAsset.CreateIterator(); It; ++It)
+		{
+			if (It->Key.ResolveObjectPtr() == nullptr)
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+} // namespace OUU::JsonData::Runtime::Private
@@ -0,0 +1,73 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "UObject/ObjectKey.h"
+
+class FJsonObject;
+class UJsonDataAsset;
+
+// Not in Public/ folder, because they should only be used directly by the system internal code.
+// Exported for the specs in OUUJsonDataTests.
+namespace OUU::JsonData::Runtime::Private
+{
+	/**
+	 * Hashes of the json values that were last imported into json data assets, so reimports only have to import the
+	 * properties whose json values changed (ouu.JsonData.DiffReimport).
+	 * Only tracked in the editor: Game builds can't tell whether game code modified an asset since its last import, so
+	 * they always reimport all properties and don't need to keep any hashes.
+	 * Hashes are dropped whenever an asset may differ from its last import: When its json file is written, when it's
+	 * imported without a json object and for all assets when PIE starts.
+	 * Game thread only.
+	 */
+	class OUUJSONDATARUNTIME_API FJsonDataAssetDiffReimport
+	{
+	public:
+		struct FImportHashes
+		{
+			// Class, engine and custom versions
+			uint64 HeaderHash = 0;
+			// Combined hash of all json fields that don't belong to a property (e.g. legacy fields that are handled in
+			// PostLoadJsonData).
+			uint64 UnmappedFieldsHash = 0;
+			TMap<FName, uint64> PropertyHashes;
+		};
+
+		static FJsonDataAssetDiffReimport& Get();
+
+		// Register for garbage collection delegates. Called by the runtime module.
+		void Startup();
+		void Shutdown();
+
+		static bool IsEnabled();
+
+		// Hash the header and the 'Data' fields of a json object by the properties they are imported into.
+		static FImportHashes HashJson(const UClass* Class, const FJsonObject& JsonObject, const FJsonObject& Data);
+
+		/**
+		 * Find the properties whose json values changed since the last import of the asset.
+		 * @param OutChangedProperties: Properties that need to be reset to class defaults (changed and removed ones).
+		 * @param OutChangedData: The subset of Data that needs to be imported.
+		 * @returns false if all properties have to be reset and imported instead.
+		 */
+		bool FindChangedProperties(
+			const UJsonDataAsset& Asset,
+			const FImportHashes& Hashes,
+			const FJsonObject& Data,
+			TArray<FProperty*>& OutChangedProperties,
+			TSharedPtr<FJsonObject>& OutChangedData) const;
+
+		void SetImportHashes(const UJsonDataAsset& Asset, FImportHashes&& Hashes);
+		void ResetImportHashes(const UJsonDataAsset& Asset);
+		void ResetAllImportHashes();
+
+	private:
+		TMap<FObjectKey, FImportHashes> HashesByAsset;
+
+		FDelegateHandle PostGarbageCollectHandle;
+
+		void HandlePostGarbageCollect();
+	};
+} // namespace OUU::JsonData::Runtime::Private
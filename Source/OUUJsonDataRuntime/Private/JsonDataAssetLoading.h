@@ -0,0 +1,68 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Dom/JsonObject.h"
+#include "Logging/TokenizedMessage.h"
+#include "Misc/SecureHash.h"
+
+// Loading utilities shared between synchronous and asynchronous json data asset loading.
+// Not in Public/ folder, because they should only be used directly by the system internal code.
+namespace OUU::JsonData::Runtime::Private
+{
+	/**
+	 * Result of reading and parsing a json source file.
+	 * May be produced on any thread, but must be consumed on the game thread.
+	 */
+	struct FJsonFileLoadResult
+	{
+		FString LoadPath;
+		TSharedPtr<FJsonObject> JsonObject;
+
+		// Message that should be reported via message log once we're back on the game thread.
+		// Only set if loading failed.
+		EMessageSeverity::Type ErrorSeverity = EMessageSeverity::Error;
+		FString ErrorMessage;
+
+		bool IsValid() const { return JsonObject.IsValid(); }
+
+		// Report the error message (if any) to the json data message log. Game thread only.
+		void ReportError() const;
+	};
+
+	/**
+	 * Read a json source file from disk without parsing it. Thread-safe.
+	 * @param OutContentHash If set, receives the hash of the file content (same as FMD5Hash::HashFile).
+	 * @returns false if the file could not be read. OutResult contains the error message in that case.
+	 */
+	bool ReadJsonFile(
+		const FString& LoadPath,
+		FString& OutJsonString,
+		FJsonFileLoadResult& OutResult,
+		FMD5Hash* OutContentHash = nullptr);
+
+	/**
+	 * Read the compact binary counterpart of a cooked json file into a json object. Thread-safe.
+	 * @returns false if there is no up to date binary file and the json file has to be loaded instead.
+	 */
+	bool ReadCompactBinaryFile(const FString& LoadPath, FJsonFileLoadResult& OutResult);
+
+	/**
+	 * Read a cooked json file from the json data bundle of its source root. Thread-safe.
+	 * @returns false if the file is not bundled or if it's overridden by a loose file. If true, OutResult may still
+	 * contain an error if the bundled data is invalid.
+	 */
+	bool ReadBundledJsonFile(const FString& LoadPath, FJsonFileLoadResult& OutResult);
+
+	/**
+	 * Read a json source file from disk and parse it into a json object.
+	 * Prefers bundled entries and the compact binary counterpart of cooked json files if available.
+	 * Thread-safe: This does not touch any UObjects or the json data subsystem, so the source path must be
+	 * resolved by the caller (e.g. via PackageToSourceFull) before dispatching this to a worker thread.
+	 * @param OutContentHash If set, receives the hash of the json file content. Stays invalid if the data was not read
+	 * from the json file (bundles and compact binary files).
+	 */
+	FJsonFileLoadResult ReadAndParseJsonFile(const FString& LoadPath, FMD5Hash* OutContentHash = nullptr);
+} // namespace OUU::JsonData::Runtime::Private
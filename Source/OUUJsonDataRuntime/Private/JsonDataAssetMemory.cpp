@@ -0,0 +1,105 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#include "JsonDataAssetMemory.h"
+
+#include "JsonDataAsset.h"
+#include "UObject/UObjectHash.h"
+#include "UObject/UObjectIterator.h"
+
+LLM_DEFINE_TAG(JsonData);
+LLM_DEFINE_TAG(JsonData_Parse);
+LLM_DEFINE_TAG(JsonData_Objects);
+
+namespace OUU::JsonData::Runtime::Private
+{
+	namespace Memory
+	{
+		struct FAssetMemory
+		{
+			const UJsonDataAsset* Asset = nullptr;
+			int64 ResidentBytes = 0;
+			int32 NumSubobjects = 0;
+		};
+
+		struct FClassMemory
+		{
+			const UClass* Class = nullptr;
+			int64 ResidentBytes = 0;
+			int32 NumAssets = 0;
+		};
+
+		// Estimated total size including all subobjects, because EstimatedTotal recurses into them.
+		int64 GetResourceSize(UObject& Object)
+		{
+			FResourceSizeEx ResourceSize(EResourceSizeMode::EstimatedTotal);
+			Object.GetResourceSizeEx(ResourceSize);
+			return static_cast<int64>(ResourceSize.GetTotalMemoryBytes());
+		}
+
+		double ToKB(int64 Bytes) { return static_cast<double>(Bytes) / 1024.0; }
+	} // namespace Memory
+
+	void DumpJsonDataAssetMemory(FOutputDevice& Ar, int32 MaxListedAssets)
+	{
+		check(IsInGameThread());
+
+		TArray<Memory::FAssetMemory> Assets;
+		TMap<const UClass*, Memory::FClassMemory> ClassesByClass;
+		int64 TotalBytes = 0;
+
+		TArray<UObject*> Subobjects;
+		for (TObjectIterator<UJsonDataAsset> It(RF_ClassDefaultObject); It; ++It)
+		{
+			auto* Asset = *It;
+			if (IsValid(Asset) == false || Asset->IsFileBasedJsonAsset() == false)
+				continue;
+
+			auto& AssetMemory = Assets.AddDefaulted_GetRef();
+			AssetMemory.Asset = Asset;
+			AssetMemory.ResidentBytes = Memory::GetResourceSize(*Asset);
+
+			// Instanced subobjects are already included in the resource size, they are only counted here.
+			Subobjects.Reset();
+			GetObjectsWithOuter(Asset, OUT Subobjects, true);
+			AssetMemory.NumSubobjects = Subobjects.Num();
+
+			auto& ClassMemory = ClassesByClass.FindOrAdd(Asset->GetClass());
+			ClassMemory.Class = Asset->GetClass();
+			ClassMemory.ResidentBytes += AssetMemory.ResidentBytes;
+			ClassMemory.NumAssets += 1;
+			TotalBytes += AssetMemory.ResidentBytes;
+		}
+
+		TArray<Memory::FClassMemory> Classes;
+		ClassesByClass.GenerateValueArray(OUT Classes);
+		Classes.Sort([](const auto& A, const auto& B) { return A.ResidentBytes > B.ResidentBytes; });
+		Assets.Sort([](const auto& A, const auto& B) { return A.ResidentBytes > B.ResidentBytes; });
+
+		Ar.Logf(TEXT("Loaded json data assets: %i (%.1f KB)"), Assets.Num(), Memory::ToKB(TotalBytes));
+
+		Ar.Logf(TEXT("%12s %12s %8s  %s"), TEXT("Total KB"), TEXT("Avg KB"), TEXT("Assets"), TEXT("Class"));
+		for (const auto& ClassMemory : Classes)
+		{
+			Ar.Logf(
+				TEXT("%12.1f %12.1f %8i  %s"),
+				Memory::ToKB(ClassMemory.ResidentBytes),
+				Memory::ToKB(ClassMemory.ResidentBytes) / ClassMemory.NumAssets,
+				ClassMemory.NumAssets,
+				*ClassMemory.Class->GetPathName());
+		}
+
+		const int32 NumListedAssets = MaxListedAssets > 0 ? FMath::Min(MaxListedAssets, Assets.Num()) : Assets.Num();
+		Ar.Logf(TEXT("Largest %i json data assets:"), NumListedAssets);
+		Ar.Logf(TEXT("%12s %10s  %-40s %s"), TEXT("KB"), TEXT("Subobjects"), TEXT("Class"), TEXT("Asset"));
+		for (int32 i = 0; i < NumListedAssets; ++i)
+		{
+			const auto& AssetMemory = Assets[i];
+			Ar.Logf(
+				TEXT("%12.1f %10i  %-40s %s"),
+				Memory::ToKB(AssetMemory.ResidentBytes),
+				AssetMemory.NumSubobjects,
+				*AssetMemory.Asset->GetClass()->GetName(),
+				*AssetMemory.Asset->GetPathName());
+		}
+	}
+} // namespace OUU::JsonData::Runtime::Private
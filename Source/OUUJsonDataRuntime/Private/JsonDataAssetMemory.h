@@ -0,0 +1,25 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "HAL/LowLevelMemTracker.h"
+
+// Memory tracking of json data assets.
+// Not in Public/ folder, because they should only be used directly by the system internal code.
+
+// Json file buffers and parsed json objects (DOM).
+LLM_DECLARE_TAG(JsonData_Parse);
+// Generated json data asset objects and their instanced subobjects.
+LLM_DECLARE_TAG(JsonData_Objects);
+
+namespace OUU::JsonData::Runtime::Private
+{
+	/**
+	 * Write a report of all loaded json data assets to the output device: Totals per class and the largest assets
+	 * sorted by resident size. The resident size of an asset is the estimated total resource size (see
+	 * UObject::GetResourceSizeEx) of the asset and all of its subobjects. Game thread only.
+	 */
+	void DumpJsonDataAssetMemory(FOutputDevice& Ar, int32 MaxListedAssets);
+} // namespace OUU::JsonData::Runtime::Private
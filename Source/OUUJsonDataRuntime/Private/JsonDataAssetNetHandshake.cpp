@@ -0,0 +1,65 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#include "JsonDataAssetNetHandshake.h"
+
+#include "Engine/NetConnection.h"
+#include "GameFramework/Actor.h"
+#include "JsonDataAssetSubsystem.h"
+
+UJsonDataAssetNetHandshakeComponent::UJsonDataAssetNetHandshakeComponent()
+{
+	SetIsReplicatedByDefault(true);
+}
+
+void UJsonDataAssetNetHandshakeComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// The client starts the handshake as soon as the component was replicated to it.
+	if (GetNetMode() == NM_Client)
+	{
+		ServerReceivePathIndexChecksums(GetLocalChecksums());
+	}
+}
+
+void UJsonDataAssetNetHandshakeComponent::ServerReceivePathIndexChecksums_Implementation(
+	const TArray<FJsonDataAssetPathIndexChecksum>& ClientChecksums)
+{
+	StoreRemoteChecksums(ClientChecksums);
+	ClientReceivePathIndexChecksums(GetLocalChecksums());
+}
+
+void UJsonDataAssetNetHandshakeComponent::ClientReceivePathIndexChecksums_Implementation(
+	const TArray<FJsonDataAssetPathIndexChecksum>& ServerChecksums)
+{
+	StoreRemoteChecksums(ServerChecksums);
+}
+
+TArray<FJsonDataAssetPathIndexChecksum> UJsonDataAssetNetHandshakeComponent::GetLocalChecksums()
+{
+	TArray<FJsonDataAssetPathIndexChecksum> Result;
+	for (const auto& Entry : UJsonDataAssetSubsystem::Get().GetPathIndexChecksums())
+	{
+		auto& Checksum = Result.AddDefaulted_GetRef();
+		Checksum.RootName = Entry.Key;
+		Checksum.Checksum = Entry.Value;
+	}
+	return Result;
+}
+
+void UJsonDataAssetNetHandshakeComponent::StoreRemoteChecksums(
+	const TArray<FJsonDataAssetPathIndexChecksum>& RemoteChecksums) const
+{
+	UNetConnection* Connection = GetOwner()->GetNetConnection();
+	if (Connection == nullptr)
+	{
+		return;
+	}
+
+	TMap<FName, uint32> ChecksumsByRoot;
+	for (const auto& Entry : RemoteChecksums)
+	{
+		ChecksumsByRoot.Add(Entry.RootName, Entry.Checksum);
+	}
+	UJsonDataAssetSubsystem::Get().SetRemotePathIndexChecksums(Connection, ChecksumsByRoot);
+}
@@ -4,6 +4,7 @@
 
 #include "JsonDataAsset.h"
 #include "JsonDataAssetGlobals.h"
+#include "JsonDataAssetResidency.h"
 #include "JsonDataAssetSubsystem.h"
 #include "OUUJsonDataRuntimeVersion.h"
 
@@ -67,7 +68,24 @@ UJsonDataAsset* FJsonDataAssetPath::LoadSynchronous() const
 	auto* ExistingAsset = Path.Get();
 #endif
 	// If the LoadSynchronous call above failed, we need to create a new package / in-memory object via the internals
-	return ExistingAsset ? ExistingAsset : UJsonDataAsset::LoadJsonDataAsset_Internal(*this, nullptr);
+	if (ExistingAsset == nullptr)
+	{
+		return UJsonDataAsset::LoadJsonDataAsset_Internal(*this, nullptr);
+	}
+	OUU::JsonData::Runtime::Private::FJsonDataAssetResidencyManager::Get().NotifyAccessed(ExistingAsset);
+	return ExistingAsset;
+}
+
+void FJsonDataAssetPath::LoadAsync(FOnJsonDataAssetLoaded Callback, UE::Tasks::ETaskPriority Priority) const
+{
+	if (auto* ExistingAsset = ResolveObject())
+	{
+		OUU::JsonData::Runtime::Private::FJsonDataAssetResidencyManager::Get().NotifyAccessed(ExistingAsset);
+		Callback.ExecuteIfBound(ExistingAsset);
+		return;
+	}
+
+	UJsonDataAssetSubsystem::Get().RequestAsyncLoad(*this, MoveTemp(Callback), Priority);
 }
 
 UJsonDataAsset* FJsonDataAssetPath::ForceReload() const
@@ -161,7 +179,7 @@ bool FJsonDataAssetPath::NetSerialize(FArchive& Ar, UPackageMap* PackageMap, boo
 	// We must write the soft object path instead of the pointer itself since our UJsonDataAsset is marked as not
 	// supported for networking. The serialization of FSoftObjectPtr will fail because of this if the object is
 	// currently loaded, but FSoftObjectPath does not perform this check.
-	UJsonDataAssetSubsystem::NetSerializePath(*this, Ar);
+	UJsonDataAssetSubsystem::NetSerializePath(*this, Ar, PackageMap);
 
 	return true;
 }
@@ -2,6 +2,7 @@
 
 #include "JsonDataAssetPointers.h"
 
+#include "JsonDataAssetResidency.h"
 #include "OUUJsonDataRuntimeVersion.h"
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -15,6 +16,11 @@ UJsonDataAsset* FSoftJsonDataAssetPtr::LoadSynchronous() const
 	return Path.LoadSynchronous();
 }
 
+void FSoftJsonDataAssetPtr::LoadAsync(FOnJsonDataAssetLoaded Callback, UE::Tasks::ETaskPriority Priority) const
+{
+	Path.LoadAsync(MoveTemp(Callback), Priority);
+}
+
 bool FSoftJsonDataAssetPtr::ImportTextItem(
 	const TCHAR*& Buffer,
 	int32 PortFlags,
@@ -101,6 +107,11 @@ FJsonDataAssetPtr::FJsonDataAssetPtr(const UJsonDataAsset* Object) :
 {
 }
 
+void FJsonDataAssetPtr::NotifyAccessed(UJsonDataAsset* Asset)
+{
+	OUU::JsonData::Runtime::Private::FJsonDataAssetResidencyManager::Get().NotifyAccessed(Asset);
+}
+
 #if WITH_EDITOR
 void FJsonDataAssetPtr::NotifyPathChanged()
 {
@@ -0,0 +1,101 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#include "JsonDataAssetPrefetch.h"
+
+#include "JsonDataAssetConsoleVariables.h"
+
+namespace OUU::JsonData::Runtime::Private
+{
+	FJsonDataPrefetchCache& FJsonDataPrefetchCache::Get()
+	{
+		static FJsonDataPrefetchCache Instance;
+		return Instance;
+	}
+
+	void FJsonDataPrefetchCache::Prefetch(const FString& LoadPath, const UE::Tasks::ETaskPriority Priority)
+	{
+		check(IsInGameThread());
+
+		RemoveExpiredEntries();
+
+		if (auto* ExistingEntry = EntriesByLoadPath.Find(LoadPath))
+		{
+			// Prefetching the same closure again should not let the shared dependencies expire.
+			ExistingEntry->PrefetchTime = FPlatformTime::Seconds();
+			return;
+		}
+
+		auto& Entry = EntriesByLoadPath.Add(LoadPath);
+		Entry.PrefetchTime = FPlatformTime::Seconds();
+		Entry.Task = UE::Tasks::Launch(
+			UE_SOURCE_LOCATION,
+			[LoadPath]() { return ReadAndParseJsonFile(LoadPath); },
+			Priority);
+
+		if (ExpiryTickerHandle.IsValid() == false)
+		{
+			// Expiry doesn't need to be exact, so there is no need to check every frame.
+			constexpr float ExpiryTickInterval = 1.f;
+			ExpiryTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+				FTickerDelegate::CreateRaw(this, &FJsonDataPrefetchCache::TickExpiry),
+				ExpiryTickInterval);
+		}
+	}
+
+	UE::Tasks::TTask<FJsonFileLoadResult> FJsonDataPrefetchCache::TakePrefetchTask(const FString& LoadPath)
+	{
+		check(IsInGameThread());
+
+		FEntry Entry;
+		if (EntriesByLoadPath.RemoveAndCopyValue(LoadPath, OUT Entry) == false)
+		{
+			return {};
+		}
+		return Entry.Task;
+	}
+
+	bool FJsonDataPrefetchCache::TakePrefetchResult(const FString& LoadPath, FJsonFileLoadResult& OutResult)
+	{
+		const auto Task = TakePrefetchTask(LoadPath);
+		if (Task.IsValid() == false)
+		{
+			return false;
+		}
+		OutResult = Task.GetResult();
+		return true;
+	}
+
+	void FJsonDataPrefetchCache::Reset()
+	{
+		check(IsInGameThread());
+
+		// Running tasks are not cancelled. They release their results when they complete.
+		EntriesByLoadPath.Empty();
+
+		FTSTicker::GetCoreTicker().RemoveTicker(ExpiryTickerHandle);
+		ExpiryTickerHandle.Reset();
+	}
+
+	void FJsonDataPrefetchCache::RemoveExpiredEntries()
+	{
+		const double ExpiryTime = FPlatformTime::Seconds() - CVar_PrefetchLifetime.GetValueOnGameThread();
+		for (auto It = EntriesByLoadPath.CreateIterator(); It; ++It)
+		{
+			if (It->Value.PrefetchTime < ExpiryTime)
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	bool FJsonDataPrefetchCache::TickExpiry(float DeltaTime)
+	{
+		RemoveExpiredEntries();
+		if (EntriesByLoadPath.Num() > 0)
+			return true;
+
+		// Started again by the next prefetch.
+		ExpiryTickerHandle.Reset();
+		return false;
+	}
+} // namespace OUU::JsonData::Runtime::Private
@@ -0,0 +1,57 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Containers/Ticker.h"
+#include "JsonDataAssetLoading.h"
+#include "Tasks/Task.h"
+
+// Not in Public/ folder, because they should only be used directly by the system internal code.
+namespace OUU::JsonData::Runtime::Private
+{
+	/**
+	 * Json files that were read and parsed ahead of time (see UJsonDataAssetSubsystem::PrefetchDependencyClosure).
+	 * Loads of prefetched files take the parsed json object instead of reading the file again.
+	 * Results that are not taken within ouu.JsonData.PrefetchLifetime seconds are dropped by a ticker that runs while
+	 * the cache is not empty, so prefetching assets that are never loaded doesn't keep their json objects around.
+	 * Game thread only.
+	 */
+	class FJsonDataPrefetchCache
+	{
+	public:
+		static FJsonDataPrefetchCache& Get();
+
+		// Start reading and parsing the file on a worker thread unless it's already prefetched.
+		void Prefetch(const FString& LoadPath, UE::Tasks::ETaskPriority Priority);
+
+		/**
+		 * Remove the prefetch task of the file from the cache.
+		 * @returns an invalid task if the file was not prefetched.
+		 */
+		UE::Tasks::TTask<FJsonFileLoadResult> TakePrefetchTask(const FString& LoadPath);
+
+		/**
+		 * Remove the prefetched result of the file from the cache. Waits for the prefetch task if it's still running.
+		 * @returns false if the file was not prefetched.
+		 */
+		bool TakePrefetchResult(const FString& LoadPath, FJsonFileLoadResult& OutResult);
+
+		// Drop all prefetched results, e.g. because the source files changed.
+		void Reset();
+
+	private:
+		struct FEntry
+		{
+			UE::Tasks::TTask<FJsonFileLoadResult> Task;
+			double PrefetchTime = 0.0;
+		};
+
+		TMap<FString, FEntry> EntriesByLoadPath;
+		FTSTicker::FDelegateHandle ExpiryTickerHandle;
+
+		void RemoveExpiredEntries();
+		bool TickExpiry(float DeltaTime);
+	};
+} // namespace OUU::JsonData::Runtime::Private
@@ -0,0 +1,173 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#include "JsonDataAssetResidency.h"
+
+#include "JsonDataAsset.h"
+#include "JsonDataAssetConsoleVariables.h"
+#include "LogJsonDataAsset.h"
+#include "Serialization/ArchiveCountMem.h"
+
+namespace OUU::JsonData::Runtime::Private
+{
+	FJsonDataAssetResidencyManager& FJsonDataAssetResidencyManager::Get()
+	{
+		static FJsonDataAssetResidencyManager Instance;
+		return Instance;
+	}
+
+	void FJsonDataAssetResidencyManager::Startup()
+	{
+		PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddRaw(
+			this,
+			&FJsonDataAssetResidencyManager::HandlePostGarbageCollect);
+	}
+
+	void FJsonDataAssetResidencyManager::Shutdown()
+	{
+		FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+		EntriesByAsset.Empty();
+		ResidentBytes = 0;
+		EvictedBytes = 0;
+	}
+
+	bool FJsonDataAssetResidencyManager::IsEnabled()
+	{
+		// Editor assets back the content browser and must stay loaded.
+		return GIsEditor == false && CVar_ResidencyBudgetMB.GetValueOnGameThread() > 0;
+	}
+
+	void FJsonDataAssetResidencyManager::NotifyImported(UJsonDataAsset& Asset)
+	{
+		check(IsInGameThread());
+
+		if (IsEnabled() == false)
+			return;
+
+		auto& Entry = EntriesByAsset.FindOrAdd(FObjectKey(&Asset));
+		// Reimported assets are measured again
+		ResidentBytes -= Entry.ResidentBytes;
+		if (Entry.bEvicted)
+		{
+			EvictedBytes -= Entry.ResidentBytes;
+		}
+
+		FArchiveCountMem CountMem(&Asset);
+		Entry.Asset = &Asset;
+		Entry.ResidentBytes = static_cast<int64>(CountMem.GetMax());
+		Entry.LastAccessFrame = GFrameCounter;
+		Entry.bEvicted = false;
+		// Evicted assets may be reimported before they are collected
+		Asset.SetFlags(RF_Standalone);
+		ResidentBytes += Entry.ResidentBytes;
+
+		EvictToBudget();
+	}
+
+	void FJsonDataAssetResidencyManager::NotifyAccessed(UJsonDataAsset* Asset)
+	{
+		// Pointers may be resolved from worker threads, but those accesses are not tracked.
+		if (Asset == nullptr || IsInGameThread() == false || IsEnabled() == false)
+			return;
+
+		auto* Entry = EntriesByAsset.Find(FObjectKey(Asset));
+		if (Entry == nullptr)
+			return;
+
+		Entry->LastAccessFrame = GFrameCounter;
+		if (Entry->bEvicted)
+		{
+			// Not collected yet, so there is no need to reload it. It may be evicted again by the next import.
+			Asset->SetFlags(RF_Standalone);
+			Entry->bEvicted = false;
+			EvictedBytes -= Entry->ResidentBytes;
+		}
+	}
+
+	void FJsonDataAssetResidencyManager::EvictToBudget()
+	{
+		const int64 BudgetBytes = static_cast<int64>(CVar_ResidencyBudgetMB.GetValueOnGameThread()) * 1024 * 1024;
+		if (ResidentBytes - EvictedBytes <= BudgetBytes)
+			return;
+
+		TArray<FEntry*> Candidates;
+		for (auto& It : EntriesByAsset)
+		{
+			// Assets that were accessed this frame may still be referenced from the stack.
+			if (It.Value.bEvicted == false && It.Value.LastAccessFrame != GFrameCounter && It.Value.Asset.IsValid())
+			{
+				Candidates.Add(&It.Value);
+			}
+		}
+		Candidates.Sort([](const FEntry& A, const FEntry& B) { return A.LastAccessFrame < B.LastAccessFrame; });
+
+		int32 NumEvicted = 0;
+		for (auto* Entry : Candidates)
+		{
+			if (ResidentBytes - EvictedBytes <= BudgetBytes)
+				break;
+
+			UJsonDataAsset* Asset = Entry->Asset.Get();
+			if (Asset->IsRooted())
+				continue;
+
+			// Referenced assets survive garbage collection. Only unreferenced ones are collected.
+			Asset->ClearFlags(RF_Standalone);
+			Entry->bEvicted = true;
+			EvictedBytes += Entry->ResidentBytes;
+			NumEvicted += 1;
+		}
+
+		UE_LOG(
+			LogJsonDataAsset,
+			Verbose,
+			TEXT("Evicted %i json data assets to get within residency budget (%lld of %lld bytes resident)"),
+			NumEvicted,
+			ResidentBytes - EvictedBytes,
+			BudgetBytes);
+	}
+
+	void FJsonDataAssetResidencyManager::HandlePostGarbageCollect()
+	{
+		int32 NumCollected = 0;
+		int32 NumSurvived = 0;
+		for (auto It = EntriesByAsset.CreateIterator(); It; ++It)
+		{
+			auto& Entry = It->Value;
+			if (Entry.bEvicted)
+			{
+				EvictedBytes -= Entry.ResidentBytes;
+			}
+
+			// Also covers assets that were destroyed explicitly, e.g. because the source file was deleted
+			UJsonDataAsset* Asset = Entry.Asset.Get();
+			if (Asset == nullptr)
+			{
+				ResidentBytes -= Entry.ResidentBytes;
+				NumCollected += Entry.bEvicted ? 1 : 0;
+				It.RemoveCurrent();
+				continue;
+			}
+
+			if (Entry.bEvicted)
+			{
+				// Still referenced, so the memory was not freed. Track it again, so it can be evicted again once it's
+				// no longer referenced.
+				Asset->SetFlags(RF_Standalone);
+				Entry.bEvicted = false;
+				NumSurvived += 1;
+			}
+		}
+
+		if (NumCollected > 0 || NumSurvived > 0)
+		{
+			UE_LOG(
+				LogJsonDataAsset,
+				Verbose,
+				TEXT("Collected %i evicted json data assets, %i evicted assets are still referenced (%lld bytes "
+					 "resident)"),
+				NumCollected,
+				NumSurvived,
+				ResidentBytes);
+		}
+	}
+} // namespace OUU::JsonData::Runtime::Private
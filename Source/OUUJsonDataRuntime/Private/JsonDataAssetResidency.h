@@ -0,0 +1,61 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "UObject/ObjectKey.h"
+
+class UJsonDataAsset;
+
+// Not in Public/ folder, because they should only be used directly by the system internal code.
+namespace OUU::JsonData::Runtime::Private
+{
+	/**
+	 * Keeps the memory of loaded json data assets within ouu.JsonData.ResidencyBudgetMB (opt-in, disabled in the
+	 * editor).
+	 * Generated assets are created with RF_Standalone, so they are never garbage collected on their own. Once the
+	 * budget is exceeded, the least recently accessed assets lose RF_Standalone. Assets that are not referenced
+	 * anywhere else are collected by the next garbage collection and reloaded from json on the next access.
+	 * Evicted assets that are accessed before they are collected or that survive the garbage collection (because they
+	 * are still referenced) become resident again. Their memory only counts as freed once they are collected.
+	 * Game thread only.
+	 */
+	class FJsonDataAssetResidencyManager
+	{
+	public:
+		static FJsonDataAssetResidencyManager& Get();
+
+		// Register for garbage collection delegates. Called by the runtime module.
+		void Startup();
+		void Shutdown();
+
+		static bool IsEnabled();
+
+		// Track a newly imported or reimported asset and evict cold assets if the budget is exceeded.
+		void NotifyImported(UJsonDataAsset& Asset);
+
+		// Mark an asset as recently used.
+		void NotifyAccessed(UJsonDataAsset* Asset);
+
+	private:
+		struct FEntry
+		{
+			TWeakObjectPtr<UJsonDataAsset> Asset;
+			int64 ResidentBytes = 0;
+			uint64 LastAccessFrame = 0;
+			bool bEvicted = false;
+		};
+
+		TMap<FObjectKey, FEntry> EntriesByAsset;
+		// Sum of the sizes of all tracked assets that are not collected yet.
+		int64 ResidentBytes = 0;
+		// Part of ResidentBytes that belongs to evicted assets, which are freed by the next garbage collection.
+		int64 EvictedBytes = 0;
+
+		FDelegateHandle PostGarbageCollectHandle;
+
+		void EvictToBudget();
+		void HandlePostGarbageCollect();
+	};
+} // namespace OUU::JsonData::Runtime::Private
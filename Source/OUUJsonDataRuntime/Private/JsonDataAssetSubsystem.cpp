@@ -2,15 +2,35 @@
 
 #include "JsonDataAssetSubsystem.h"
 
+#include "Algo/BinarySearch.h"
+#include "Algo/Unique.h"
 #include "AssetRegistry/IAssetRegistry.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "Engine/NetConnection.h"
+#include "Engine/PackageMapClient.h"
 #include "GameDelegates.h"
+#include "GameFramework/GameModeBase.h"
+#include "GameFramework/PlayerController.h"
 #include "Interfaces/IPluginManager.h"
 #include "JsonDataAsset.h"
 #include "JsonDataAssetConsoleVariables.h"
+#include "JsonDataAssetDiffReimport.h"
 #include "JsonDataAssetGlobals.h"
+#include "JsonDataAssetLoading.h"
+#include "JsonDataAssetNetHandshake.h"
+#include "JsonDataAssetPrefetch.h"
+#include "JsonDataAssetTrace.h"
+#include "JsonDataBundle.h"
 #include "JsonDataCacheVersion.h"
+#include "JsonDataImportManifest.h"
+#include "JsonDataMetaDataCacheBinary.h"
+#include "JsonDataSourceControlQueue.h"
+#include "JsonDataSourceWatcher.h"
 #include "JsonLibrary.h"
+#include "JsonLibraryImportPlan.h"
 #include "LogJsonDataAsset.h"
+#include "Misc/ScopeRWLock.h"
 #include "UObject/SavePackage.h"
 
 #if WITH_EDITOR
@@ -189,6 +209,16 @@ namespace OUU::JsonData::Runtime
 #endif
 	}
 
+	FScopedSourceControlBatch::FScopedSourceControlBatch()
+	{
+		OUU::JsonData::Runtime::Private::FJsonDataSourceControlQueue::Get().BeginBatch();
+	}
+
+	FScopedSourceControlBatch::~FScopedSourceControlBatch()
+	{
+		OUU::JsonData::Runtime::Private::FJsonDataSourceControlQueue::Get().EndBatch();
+	}
+
 } // namespace OUU::JsonData::Runtime
 
 bool FJsonDataAssetMetaDataCache::SaveToFile(const FString& FilePath) const
@@ -284,15 +314,30 @@ void UJsonDataAssetSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 	bAutoExportJson = true;
 
 	FCoreDelegates::OnAllModuleLoadingPhasesComplete.AddUObject(this, &UJsonDataAssetSubsystem::PostEngineInit);
+	FGameModeEvents::GameModePostLoginEvent.AddUObject(this, &UJsonDataAssetSubsystem::HandleGameModePostLogin);
 
 #if WITH_EDITOR
 	FEditorDelegates::OnPackageDeleted.AddUObject(this, &UJsonDataAssetSubsystem::HandlePackageDeleted);
 	FEditorDelegates::PreBeginPIE.AddUObject(this, &UJsonDataAssetSubsystem::HandlePreBeginPIE);
 
 	FGameDelegates::Get().GetModifyCookDelegate().AddUObject(this, &UJsonDataAssetSubsystem::ModifyCook);
+
+	auto& AssetRegistry = IAssetRegistry::GetChecked();
+	AssetRegistry.OnAssetAdded().AddUObject(this, &UJsonDataAssetSubsystem::HandleAssetRegistryAssetsChanged);
+	AssetRegistry.OnAssetRemoved().AddUObject(this, &UJsonDataAssetSubsystem::HandleAssetRegistryAssetsChanged);
+	AssetRegistry.OnAssetRenamed().AddUObject(this, &UJsonDataAssetSubsystem::HandleAssetRegistryAssetRenamed);
 #else
 	// In non-editor builds, load Json asset meta data cache file.
-	AssetMetaDataCache.LoadFromFile(GetMetaDataCacheFilePath(EJsonDataAccessMode::Read));
+	// The binary cache is memory mapped, so it's preferred over the json file (written by older cooks).
+	const FString MetaDataCacheFilePath = GetMetaDataCacheFilePath(EJsonDataAccessMode::Read);
+	AssetMetaDataCacheBinary = MakeShared<OUU::JsonData::Runtime::Private::FJsonDataMetaDataCacheBinary>();
+	if (AssetMetaDataCacheBinary->Open(
+			OUU::JsonData::Runtime::Private::FJsonDataMetaDataCacheBinary::GetFilePath(MetaDataCacheFilePath))
+		== false)
+	{
+		AssetMetaDataCacheBinary.Reset();
+		AssetMetaDataCache.LoadFromFile(MetaDataCacheFilePath);
+	}
 #endif
 }
 
@@ -302,13 +347,33 @@ void UJsonDataAssetSubsystem::Deinitialize()
 
 	UnregisterMountPoints(OUU::JsonData::Runtime::GameRootName);
 
+	OUU::JsonData::Runtime::Private::FJsonDataBundle::UnmountAll();
+	AssetMetaDataCacheBinary.Reset();
+
 	bAutoExportJson = false;
 
 	FCoreDelegates::OnPostEngineInit.RemoveAll(this);
+	FGameModeEvents::GameModePostLoginEvent.RemoveAll(this);
+
+	RemotePathIndexStates.Empty();
+	OUU::JsonData::Runtime::Private::FJsonDataPrefetchCache::Get().Reset();
+	SourceWatcher.Reset();
+	WrittenSourceFileTimeStamps.Empty();
 
 #if WITH_EDITOR
 	FEditorDelegates::OnPackageDeleted.RemoveAll(this);
 	FEditorDelegates::PreBeginPIE.RemoveAll(this);
+
+	if (auto* AssetRegistry = IAssetRegistry::Get())
+	{
+		AssetRegistry->OnAssetAdded().RemoveAll(this);
+		AssetRegistry->OnAssetRemoved().RemoveAll(this);
+		AssetRegistry->OnAssetRenamed().RemoveAll(this);
+	}
+
+	FTSTicker::GetCoreTicker().RemoveTicker(RetiredClassIndexTickerHandle);
+	RetiredClassIndexTickerHandle.Reset();
+	RetiredClassIndexPaths.Empty();
 #endif
 }
 
@@ -319,7 +384,7 @@ bool UJsonDataAssetSubsystem::AutoExportJsonEnabled()
 	return GEngine->GetEngineSubsystem<UJsonDataAssetSubsystem>()->bAutoExportJson;
 }
 
-void UJsonDataAssetSubsystem::NetSerializePath(FJsonDataAssetPath& Path, FArchive& Ar)
+void UJsonDataAssetSubsystem::NetSerializePath(FJsonDataAssetPath& Path, FArchive& Ar, UPackageMap* PackageMap)
 {
 	DECLARE_SCOPE_CYCLE_COUNTER(
 		TEXT("UJsonDataAssetSubsystem::NetSerializePath"),
@@ -345,17 +410,25 @@ void UJsonDataAssetSubsystem::NetSerializePath(FJsonDataAssetPath& Path, FArchiv
 		int32 PathIndex = 0;
 		if (bUsesFastSerialization && Ar.IsSaving())
 		{
-			const int32* OptIndex =
-				SubsystemInstance->AllJsonDataAssetsByPath.Find(SoftObjectPath.GetLongPackageFName());
-			if (ensureMsgf(
-					OptIndex,
-					TEXT("Tried to NetSerialize json data asset path '%s' which does not appear to exist."),
-					*SoftObjectPath.ToString()))
+			// The receiving side only relies on the serialized flag, so only the sender needs to know about the remote
+			// path index table.
+			bUsesFastSerialization = SubsystemInstance->CanUseFastNetSerialization(PackageMap);
+		}
+		if (bUsesFastSerialization && Ar.IsSaving())
+		{
+			const FName PackageName = SoftObjectPath.GetLongPackageFName();
+			const int32* OptIndex = SubsystemInstance->AllJsonDataAssetsByPath.Find(PackageName);
+			if (OptIndex)
 			{
 				PathIndex = *OptIndex;
 			}
 			else
 			{
+				// Files that were added while fast net serialization was in use are not in the path index yet.
+				ensureMsgf(
+					SubsystemInstance->DeferredPathIndexChanges.Contains(PackageName),
+					TEXT("Tried to NetSerialize json data asset path '%s' which does not appear to exist."),
+					*SoftObjectPath.ToString());
 				bUsesFastSerialization = false;
 			}
 		}
@@ -414,10 +487,9 @@ void UJsonDataAssetSubsystem::NetSerializePath(FJsonDataAssetPath& Path, FArchiv
 
 			if (Ar.IsLoading())
 			{
-				if (ensureMsgf(
-						PathIndex < SubsystemInstance->AllJsonDataAssetsByIndex.Num(),
-						TEXT("Received out-of range json data asset path index %i!"),
-						PathIndex))
+				// Remote input, so a broken index is only logged instead of ensured.
+				if (Ar.IsError() == false && PathIndex >= 0
+					&& PathIndex < SubsystemInstance->AllJsonDataAssetsByIndex.Num())
 				{
 					const auto& PackagePath = SubsystemInstance->AllJsonDataAssetsByIndex[PathIndex];
 					if (bAssetNameMatchesPackage)
@@ -430,6 +502,11 @@ void UJsonDataAssetSubsystem::NetSerializePath(FJsonDataAssetPath& Path, FArchiv
 				}
 				else
 				{
+					UE_LOG(
+						LogJsonDataAsset,
+						Warning,
+						TEXT("Received out-of range json data asset path index %i!"),
+						PathIndex);
 					SoftObjectPath.Reset();
 				}
 			}
@@ -462,6 +539,9 @@ void UJsonDataAssetSubsystem::ImportAllAssets(bool bOnlyMissing)
 	const bool bIgnoreErrorsDuringImport =
 		OUU::JsonData::Runtime::Private::CVar_IgnoreLoadErrorsDuringStartupImport.GetValueOnAnyThread();
 
+	// Json assets of all roots share the same tags.
+	OUU::JsonData::Runtime::Private::FScopedJsonGameplayTagSession ScopedGameplayTagSession;
+
 	if (bIgnoreErrorsDuringImport)
 	{
 		// We have to ignore references to generated json packages while doing the initial import.
@@ -475,7 +555,10 @@ void UJsonDataAssetSubsystem::ImportAllAssets(bool bOnlyMissing)
 	// Perform the actual import
 	for (auto& RootName : AllRootNames)
 	{
-		ImportAllAssets(RootName, bOnlyMissing);
+		ImportAssetsInDirectory(
+			RootName,
+			OUU::JsonData::Runtime::GetSourceRoot_Full(RootName, EJsonDataAccessMode::Read),
+			bOnlyMissing);
 	}
 
 	if (bIgnoreErrorsDuringImport)
@@ -490,6 +573,33 @@ void UJsonDataAssetSubsystem::ImportAllAssets(bool bOnlyMissing)
 	bIsInitialAssetImportCompleted = true;
 }
 
+void UJsonDataAssetSubsystem::ImportAssetsInFolder(const FString& PackageFolder, bool bOnlyMissing)
+{
+	const FName RootName = GetRootNameForPackagePath(PackageFolder);
+	if (RootName.IsNone())
+	{
+		UE_LOG(
+			LogJsonDataAsset,
+			Warning,
+			TEXT("ImportAssetsInFolder - %s is not inside a json data root"),
+			*PackageFolder);
+		return;
+	}
+
+	if (bJsonDataAssetListBuilt == false)
+	{
+		RescanAllAssets();
+	}
+
+	OUU::JsonData::Runtime::Private::FScopedJsonGameplayTagSession ScopedGameplayTagSession;
+
+	const FString FolderRelativeToRoot = PackageFolder.Replace(*GetVirtualRoot(RootName), TEXT(""));
+	ImportAssetsInDirectory(
+		RootName,
+		OUU::JsonData::Runtime::GetSourceRoot_Full(RootName, EJsonDataAccessMode::Read) / FolderRelativeToRoot,
+		bOnlyMissing);
+}
+
 DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Num Assets"), STAT_JsonDataAsset_NumAssets, STATGROUP_OUUJsonData, );
 DEFINE_STAT(STAT_JsonDataAsset_NumAssets);
 
@@ -498,25 +608,92 @@ void UJsonDataAssetSubsystem::RescanAllAssets()
 	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UJsonDataAssetSubsystem::Rescan"), STAT_Rescan, STATGROUP_OUUJsonData);
 
 	AllJsonDataAssetsByIndex.Empty();
+	// The rescan picks up all files that currently exist.
+	DeferredPathIndexChanges.Empty();
+
+	const bool bReadFromCookedContent = OUU::JsonData::Runtime::ShouldReadFromCookedContent();
+	if (bReadFromCookedContent)
+	{
+		OUU::JsonData::Runtime::Private::FJsonDataBundle::UnmountAll();
+	}
 
 	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
 	for (auto& RootName : AllRootNames)
 	{
 		auto SourceRoot = OUU::JsonData::Runtime::GetSourceRoot_Full(RootName, EJsonDataAccessMode::Read);
+		TArray<FName> RootPackagePaths;
+
+		TSharedPtr<OUU::JsonData::Runtime::Private::FJsonDataBundle> Bundle;
+		if (bReadFromCookedContent)
+		{
+			Bundle = OUU::JsonData::Runtime::Private::FJsonDataBundle::Open(SourceRoot);
+		}
+		if (Bundle.IsValid())
+		{
+			for (const auto& Entry : Bundle->GetEntries())
+			{
+				const auto PackagePath = OUU::JsonData::Runtime::SourceFullToPackage(
+					Bundle->GetSourceRoot() + Entry.RelativePath,
+					EJsonDataAccessMode::Read);
+				RootPackagePaths.Add(FName(PackagePath));
+			}
+		}
+
 		PlatformFile.IterateDirectoryRecursively(*SourceRoot, [&](const TCHAR* FilePath, bool bIsDirectory) -> bool {
-			if (bIsDirectory == false)
+			// Skip other files next to the json files, e.g. compact binary files in cooked content.
+			if (bIsDirectory == false && FPaths::GetExtension(FilePath) == TEXT("json"))
 			{
 				const auto PackagePath =
 					OUU::JsonData::Runtime::SourceFullToPackage(FilePath, EJsonDataAccessMode::Read);
-				AllJsonDataAssetsByIndex.Add(FName(PackagePath));
+				RootPackagePaths.Add(FName(PackagePath));
+
+				FString RelativePath;
+				if (Bundle.IsValid() && Bundle->TryMakeRelativePath(FilePath, OUT RelativePath))
+				{
+					Bundle->MarkOverriddenByLooseFile(RelativePath);
+				}
 			}
 			return true;
 		});
+
+		if (Bundle.IsValid())
+		{
+			// Only publish the bundle after all overrides are flagged, so loads never see it change.
+			OUU::JsonData::Runtime::Private::FJsonDataBundle::Mount(Bundle.ToSharedRef());
+		}
+
+		// Note: We sort using LexicalLess here instead of FastLess, because we need the resulting order to be
+		// deterministic across multiple clients.
+		RootPackagePaths.Sort([](const FName& _A, const FName& _B) { return _A.LexicalLess(_B); });
+		// Loose files that override bundled files are listed twice.
+		RootPackagePaths.SetNum(Algo::Unique(RootPackagePaths));
+
+		AllJsonDataAssetsByIndex.Append(RootPackagePaths);
 	}
 
-	// Note: We sort using LexicalLess here instead of FastLess, because we need the resulting order to be deterministic
-	// across multiple clients.
 	AllJsonDataAssetsByIndex.Sort([](const FName& _A, const FName& _B) { return _A.LexicalLess(_B); });
+	AllJsonDataAssetsByIndex.SetNum(Algo::Unique(AllJsonDataAssetsByIndex));
+
+	UpdatePathIndex();
+}
+
+void UJsonDataAssetSubsystem::UpdatePathIndex()
+{
+	// Remote peers compare these checksums to find out whether they can exchange path indices with us.
+	// The paths of each root are a sorted subsequence of the sorted path list, so they can be hashed in one pass.
+	PathIndexChecksumsByRoot.Empty(AllRootNames.Num());
+	for (const auto& RootName : AllRootNames)
+	{
+		PathIndexChecksumsByRoot.Add(RootName, 0);
+	}
+	for (const FName& PackagePath : AllJsonDataAssetsByIndex)
+	{
+		const FString PackagePathString = PackagePath.ToString();
+		if (auto* Checksum = PathIndexChecksumsByRoot.Find(GetRootNameForPackagePath(PackagePathString)))
+		{
+			*Checksum = FCrc::StrCrc32(*PackagePathString, *Checksum);
+		}
+	}
 
 	const int32 NumPaths = AllJsonDataAssetsByIndex.Num();
 	AllJsonDataAssetsByPath.Empty(NumPaths);
@@ -537,11 +714,177 @@ void UJsonDataAssetSubsystem::RescanAllAssets()
 
 	bJsonDataAssetListBuilt = true;
 
+	// Re-evaluate connections that already completed the handshake against the new path index table.
+	for (auto It = RemotePathIndexStates.CreateIterator(); It; ++It)
+	{
+		if (It->Key.IsValid() == false)
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+		UpdateRemotePathIndexMatch(It->Key);
+	}
+
 	// Use this list to track how many assets there are in total.
-	// If we ever want to support dynamic loading/unloading it has to be reflected here, so this should be ok.
+	// Files that are added or removed at runtime are reflected via the source watcher.
 	SET_DWORD_STAT(STAT_JsonDataAsset_NumAssets, AllJsonDataAssetsByPath.Num());
 }
 
+void UJsonDataAssetSubsystem::NotifySourceFileWritten(const FString& FilePath)
+{
+	if (SourceWatcher.IsValid() == false)
+		return;
+
+	FString FullFilePath = FPaths::ConvertRelativePathToFull(FilePath);
+	FPaths::NormalizeFilename(FullFilePath);
+	WrittenSourceFileTimeStamps.Add(
+		FullFilePath,
+		FPlatformFileManager::Get().GetPlatformFile().GetTimeStamp(*FullFilePath));
+}
+
+void UJsonDataAssetSubsystem::HandleSourceFilesChanged(const TArray<FString>& ChangedFiles)
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(
+		TEXT("UJsonDataAssetSubsystem::HandleSourceFilesChanged"),
+		STAT_HandleSourceFilesChanged,
+		STATGROUP_OUUJsonData);
+
+	check(IsInGameThread());
+
+	// Prefetched results may contain the old file contents.
+	OUU::JsonData::Runtime::Private::FJsonDataPrefetchCache::Get().Reset();
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	OUU::JsonData::Runtime::Private::FScopedJsonGameplayTagSession ScopedGameplayTagSession;
+	TMap<FName, bool> PathIndexChanges;
+	int32 NumReimportedAssets = 0;
+	for (const FString& FilePath : ChangedFiles)
+	{
+		if (FPaths::GetExtension(FilePath) != TEXT("json"))
+			continue;
+
+		if (OUU::JsonData::Runtime::ShouldIgnoreInvalidExtensions() && FPaths::GetBaseFilename(FilePath).Contains("."))
+			continue;
+
+		if (GetRootNameForSourcePath(FilePath) == NAME_None)
+			continue;
+
+		const FDateTime TimeStamp = PlatformFile.GetTimeStamp(*FilePath);
+		FDateTime WrittenTimeStamp;
+		if (WrittenSourceFileTimeStamps.RemoveAndCopyValue(FilePath, OUT WrittenTimeStamp)
+			&& WrittenTimeStamp == TimeStamp)
+		{
+			// Exported by ourselves, so the asset already has the file contents.
+			continue;
+		}
+
+		const FString PackagePath = OUU::JsonData::Runtime::SourceFullToPackage(FilePath, EJsonDataAccessMode::Read);
+		if (TimeStamp == FDateTime::MinValue())
+		{
+			// Loaded assets of deleted files are kept until they are deleted explicitly (e.g. in the content browser).
+			PathIndexChanges.Add(FName(PackagePath), false);
+			continue;
+		}
+		PathIndexChanges.Add(FName(PackagePath), true);
+
+		const auto Path = FJsonDataAssetPath::FromPackagePath(PackagePath);
+		if (Path.ResolveObject())
+		{
+			// ReSharper disable once CppExpressionWithoutSideEffects
+			Path.ForceReload();
+			NumReimportedAssets += 1;
+		}
+		else if (GIsEditor)
+		{
+			// The editor expects all json files to have an asset (e.g. for the content browser).
+			// ReSharper disable once CppExpressionWithoutSideEffects
+			Path.LoadSynchronous();
+			NumReimportedAssets += 1;
+		}
+	}
+
+	ApplyPathIndexChanges(PathIndexChanges);
+
+	UE_LOG(
+		LogJsonDataAsset,
+		Log,
+		TEXT("Reimported %i json data assets after source file changes (%i changed files)"),
+		NumReimportedAssets,
+		ChangedFiles.Num());
+}
+
+void UJsonDataAssetSubsystem::ApplyPathIndexChanges(const TMap<FName, bool>& PathIndexChanges)
+{
+	DeferredPathIndexChanges.Append(PathIndexChanges);
+	if (DeferredPathIndexChanges.Num() == 0)
+		return;
+
+	if (IsFastNetSerializationInUse())
+	{
+		UE_LOG(
+			LogJsonDataAsset,
+			Log,
+			TEXT("Deferred %i path index changes, because connections use fast net serialization. Added json files "
+				 "are net serialized by path until then."),
+			DeferredPathIndexChanges.Num());
+		return;
+	}
+
+	bool bPathIndexChanged = false;
+	for (const auto& Entry : DeferredPathIndexChanges)
+	{
+		bPathIndexChanged |= Entry.Value ? AddToPathIndex(Entry.Key) : RemoveFromPathIndex(Entry.Key);
+	}
+	DeferredPathIndexChanges.Empty();
+
+	if (bPathIndexChanged)
+	{
+		if (OUU::JsonData::Runtime::ShouldReadFromCookedContent())
+		{
+			// Bundles need to know which of their entries are overridden by loose files.
+			RescanAllAssets();
+		}
+		else
+		{
+			UpdatePathIndex();
+		}
+	}
+}
+
+bool UJsonDataAssetSubsystem::IsFastNetSerializationInUse() const
+{
+	for (const auto& Entry : RemotePathIndexStates)
+	{
+		if (Entry.Value.bMatchesLocalPathIndex && Entry.Key.IsValid())
+			return true;
+	}
+	return false;
+}
+
+bool UJsonDataAssetSubsystem::AddToPathIndex(const FName& PackagePath)
+{
+	const int32 Index = Algo::LowerBound(AllJsonDataAssetsByIndex, PackagePath, [](const FName& _A, const FName& _B) {
+		return _A.LexicalLess(_B);
+	});
+	if (AllJsonDataAssetsByIndex.IsValidIndex(Index) && AllJsonDataAssetsByIndex[Index] == PackagePath)
+		return false;
+
+	AllJsonDataAssetsByIndex.Insert(PackagePath, Index);
+	return true;
+}
+
+bool UJsonDataAssetSubsystem::RemoveFromPathIndex(const FName& PackagePath)
+{
+	const int32 Index = Algo::LowerBound(AllJsonDataAssetsByIndex, PackagePath, [](const FName& _A, const FName& _B) {
+		return _A.LexicalLess(_B);
+	});
+	if (AllJsonDataAssetsByIndex.IsValidIndex(Index) == false || AllJsonDataAssetsByIndex[Index] != PackagePath)
+		return false;
+
+	AllJsonDataAssetsByIndex.RemoveAt(Index);
+	return true;
+}
+
 TArray<FJsonDataAssetPath> UJsonDataAssetSubsystem::GetJsonAssetsByClass(
 	TSoftClassPtr<UJsonDataAsset> Class,
 	const bool bSearchSubClasses) const
@@ -551,47 +894,457 @@ TArray<FJsonDataAssetPath> UJsonDataAssetSubsystem::GetJsonAssetsByClass(
 		STAT_GetByClass,
 		STATGROUP_OUUJsonData);
 
-	const auto& AssetRegistry = IAssetRegistry::GetChecked();
 	const FTopLevelAssetPath ClassAssetPath(Class.ToString());
-	TArray<FJsonDataAssetPath> Results;
+	// The paths are copied while the index is locked, so other threads can't invalidate them in the meantime.
+	FWriteScopeLock WriteLock(ClassIndexLock);
+	return TArray<FJsonDataAssetPath>(FindOrAddClassIndexPaths(ClassAssetPath, bSearchSubClasses));
+}
+
+TConstArrayView<FJsonDataAssetPath> UJsonDataAssetSubsystem::GetJsonAssetsByClassView(
+	const FTopLevelAssetPath& ClassPath,
+	const bool bSearchSubClasses) const
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(
+		TEXT("UJsonDataAssetSubsystem::GetAssetsByClassView"),
+		STAT_GetByClassView,
+		STATGROUP_OUUJsonData);
 
+	// The index is only ever reset on the game thread and reset lists are kept alive until the next tick (see
+	// InvalidateClassIndex), so the view stays valid after the lock is released.
+	check(IsInGameThread());
+	FWriteScopeLock WriteLock(ClassIndexLock);
+	return FindOrAddClassIndexPaths(ClassPath, bSearchSubClasses);
+}
+
+TConstArrayView<FJsonDataAssetPath> UJsonDataAssetSubsystem::FindOrAddClassIndexPaths(
+	const FTopLevelAssetPath& ClassPath,
+	const bool bSearchSubClasses) const
+{
 #if WITH_EDITOR
+	auto& ClassIndex = bSearchSubClasses ? AssetPathsByClassHierarchy : AssetPathsByClass;
+	if (const auto* CachedPaths = ClassIndex.Find(ClassPath))
+	{
+		return *CachedPaths;
+	}
+
 	// In the editor, we can simply use the asset registry to find our data.
 	TArray<FAssetData> AssetData;
-	AssetRegistry.GetAssetsByClass(ClassAssetPath, AssetData, bSearchSubClasses);
+	IAssetRegistry::GetChecked().GetAssetsByClass(ClassPath, AssetData, bSearchSubClasses);
 
-	Results.Reserve(AssetData.Num());
+	// The arrays keep their allocation when the map grows, so views of other classes stay valid.
+	auto& Paths = ClassIndex.Add(ClassPath);
+	Paths.Reserve(AssetData.Num());
 	for (const auto& Data : AssetData)
 	{
-		Results.Add(FJsonDataAssetPath::FromSoftObjectPath(Data.GetSoftObjectPath()));
+		Paths.Add(FJsonDataAssetPath::FromSoftObjectPath(Data.GetSoftObjectPath()));
 	}
+	return Paths;
 #else
 	// Outside of that, we need to use our own cache as the generated .uassets are not included in cooked builds.
-	TSet<FTopLevelAssetPath> DerivedClassNames;
-	AssetRegistry.GetDerivedClassNames({ClassAssetPath}, {}, DerivedClassNames);
+	if (bSearchSubClasses == false && AssetMetaDataCacheBinary.IsValid() == false)
+	{
+		const auto* pEntries = AssetMetaDataCache.PathsByClass.Find(ClassPath);
+		return pEntries ? TConstArrayView<FJsonDataAssetPath>(pEntries->Paths) : TConstArrayView<FJsonDataAssetPath>();
+	}
 
-	for (const auto& ClassPath : DerivedClassNames)
+	auto& ClassIndex = bSearchSubClasses ? AssetPathsByClassHierarchy : AssetPathsByClass;
+	if (const auto* CachedPaths = ClassIndex.Find(ClassPath))
 	{
-		const auto pEntries = AssetMetaDataCache.PathsByClass.Find(ClassPath);
-		if (pEntries)
+		return *CachedPaths;
+	}
+
+	auto& Paths = ClassIndex.Add(ClassPath);
+	if (bSearchSubClasses)
+	{
+		if (bClassHierarchyIndexBuilt == false)
+		{
+			BuildClassHierarchyIndex();
+		}
+		if (const auto* DerivedClassPaths = MetaDataCacheClassesByAncestor.Find(ClassPath))
+		{
+			for (const auto& DerivedClassPath : *DerivedClassPaths)
+			{
+				AppendMetaDataCachePaths(DerivedClassPath, OUT Paths);
+			}
+		}
+	}
+	else
+	{
+		AppendMetaDataCachePaths(ClassPath, OUT Paths);
+	}
+	Paths.Shrink();
+	return Paths;
+#endif
+}
+
+TArray<FJsonDataAssetPath> UJsonDataAssetSubsystem::FindJsonAssetsByTag(
+	const FTopLevelAssetPath& ClassPath,
+	const bool bSearchSubClasses,
+	const FName& Tag,
+	TFunctionRef<bool(const FString& Value)> Predicate) const
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(
+		TEXT("UJsonDataAssetSubsystem::FindJsonAssetsByTag"),
+		STAT_FindByTag,
+		STATGROUP_OUUJsonData);
+
+	check(IsInGameThread());
+
+	TArray<FJsonDataAssetPath> Results;
+
+#if WITH_EDITOR
+	// The generated uassets are registered with all of their tags.
+	TArray<FAssetData> AssetData;
+	IAssetRegistry::GetChecked().GetAssetsByClass(ClassPath, AssetData, bSearchSubClasses);
+
+	FString Value;
+	for (const auto& Data : AssetData)
+	{
+		if (Data.GetTagValue(Tag, OUT Value) && Predicate(Value))
+		{
+			Results.Add(FJsonDataAssetPath::FromSoftObjectPath(Data.GetSoftObjectPath()));
+		}
+	}
+#else
+	TArray<FTopLevelAssetPath, TInlineAllocator<1>> ClassPaths;
+	if (bSearchSubClasses)
+	{
+		FWriteScopeLock WriteLock(ClassIndexLock);
+		if (bClassHierarchyIndexBuilt == false)
+		{
+			BuildClassHierarchyIndex();
+		}
+		if (const auto* DerivedClassPaths = MetaDataCacheClassesByAncestor.Find(ClassPath))
+		{
+			ClassPaths.Append(*DerivedClassPaths);
+		}
+	}
+	else
+	{
+		ClassPaths.Add(ClassPath);
+	}
+
+	for (const auto& CacheClassPath : ClassPaths)
+	{
+		if (AssetMetaDataCacheBinary.IsValid())
+		{
+			AssetMetaDataCacheBinary->AppendAssetPathsByTag(CacheClassPath, Tag, Predicate, OUT Results);
+		}
+		else if (const auto* pEntries = AssetMetaDataCache.PathsByClass.Find(CacheClassPath))
 		{
-			Results.Reserve(Results.Num() + pEntries->Paths.Num());
-			for (const auto& Path : pEntries->Paths)
+			for (int32 i = 0; i < pEntries->SearchableTags.Num() && i < pEntries->Paths.Num(); ++i)
 			{
-				Results.Add(Path);
+				const FString* Value = pEntries->SearchableTags[i].Values.Find(Tag);
+				if (Value && Predicate(*Value))
+				{
+					Results.Add(pEntries->Paths[i]);
+				}
 			}
 		}
 	}
 #endif
 
-	return Results;
+	return Results;
+}
+
+TArray<FJsonDataAssetPath> UJsonDataAssetSubsystem::FindJsonAssetsByTagValue(
+	TSoftClassPtr<UJsonDataAsset> Class,
+	const FName Tag,
+	const FString& Value,
+	const bool bSearchSubClasses) const
+{
+	const FTopLevelAssetPath ClassAssetPath(Class.ToString());
+	return FindJsonAssetsByTag(ClassAssetPath, bSearchSubClasses, Tag, [&Value](const FString& TagValue) {
+		return TagValue == Value;
+	});
+}
+
+#if WITH_EDITOR
+void UJsonDataAssetSubsystem::GetSearchableTags(const UJsonDataAsset& Asset, FJsonDataAssetSearchableTags& OutTags)
+{
+	// Asset classes may add arbitrary (and large) tags, but only searchable properties are meant to be queried.
+	TArray<UObject::FAssetRegistryTag> AssetRegistryTags;
+	Asset.GetAssetRegistryTags(OUT AssetRegistryTags);
+	for (const auto& AssetRegistryTag : AssetRegistryTags)
+	{
+		const auto* Property = Asset.GetClass()->FindPropertyByName(AssetRegistryTag.Name);
+		if (Property && Property->HasAnyPropertyFlags(CPF_AssetRegistrySearchable))
+		{
+			OutTags.Values.Add(AssetRegistryTag.Name, AssetRegistryTag.Value);
+		}
+	}
+}
+#endif
+
+TArray<FJsonDataAssetPath> UJsonDataAssetSubsystem::GetJsonDependencyClosure(const FJsonDataAssetPath& Path) const
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(
+		TEXT("UJsonDataAssetSubsystem::GetJsonDependencyClosure"),
+		STAT_GetJsonDependencyClosure,
+		STATGROUP_OUUJsonData);
+
+	check(IsInGameThread());
+
+	TArray<FJsonDataAssetPath> Results;
+	if (Path.IsNull())
+	{
+		return Results;
+	}
+
+#if WITH_EDITOR
+	// The asset registry knows the dependencies of all generated uassets.
+	IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+	if (AssetRegistry.GetAssetPackageDataCopy(FName(*Path.GetPackagePath())).IsSet() == false)
+	{
+		return Results;
+	}
+	const auto GetDirectDependencies = [&AssetRegistry](
+										   const FJsonDataAssetPath& AssetPath,
+										   TArray<FJsonDataAssetPath>& OutPaths) {
+		TArray<FName> DependencyPackageNames;
+		AssetRegistry.GetDependencies(FName(*AssetPath.GetPackagePath()), OUT DependencyPackageNames);
+		for (const auto& DependencyPackageName : DependencyPackageNames)
+		{
+			const FString DependencyPackagePath = DependencyPackageName.ToString();
+			if (OUU::JsonData::Runtime::PackageIsJsonData(DependencyPackagePath))
+			{
+				OutPaths.Add(FJsonDataAssetPath::FromPackagePath(DependencyPackagePath));
+			}
+		}
+	};
+#else
+	if (AssetMetaDataCacheBinary.IsValid())
+	{
+		AssetMetaDataCacheBinary->GetDependencyClosure(Path, OUT Results);
+		return Results;
+	}
+
+	if (MetaDataCacheDependencies.Num() == 0)
+	{
+		for (const auto& Entry : AssetMetaDataCache.PathsByClass)
+		{
+			for (int32 i = 0; i < Entry.Value.Paths.Num(); ++i)
+			{
+				auto& Dependencies = MetaDataCacheDependencies.Add(Entry.Value.Paths[i]);
+				if (Entry.Value.Dependencies.IsValidIndex(i))
+				{
+					Dependencies = Entry.Value.Dependencies[i].Paths;
+				}
+			}
+		}
+	}
+	if (MetaDataCacheDependencies.Contains(Path) == false)
+	{
+		return Results;
+	}
+	const auto GetDirectDependencies = [this](
+										   const FJsonDataAssetPath& AssetPath,
+										   TArray<FJsonDataAssetPath>& OutPaths) {
+		if (const auto* Dependencies = MetaDataCacheDependencies.Find(AssetPath))
+		{
+			OutPaths.Append(*Dependencies);
+		}
+	};
+#endif
+
+	TSet<FJsonDataAssetPath> VisitedPaths;
+	VisitedPaths.Add(Path);
+	Results.Add(Path);
+	TArray<FJsonDataAssetPath> DirectDependencies;
+	for (int32 i = 0; i < Results.Num(); ++i)
+	{
+		DirectDependencies.Reset();
+		GetDirectDependencies(Results[i], OUT DirectDependencies);
+		for (const auto& Dependency : DirectDependencies)
+		{
+			bool bAlreadyVisited = false;
+			VisitedPaths.Add(Dependency, OUT & bAlreadyVisited);
+			if (bAlreadyVisited == false)
+			{
+				Results.Add(Dependency);
+			}
+		}
+	}
+	return Results;
+}
+
+void UJsonDataAssetSubsystem::BuildClassHierarchyIndex() const
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(
+		TEXT("UJsonDataAssetSubsystem::BuildClassHierarchyIndex"),
+		STAT_BuildClassHierarchyIndex,
+		STATGROUP_OUUJsonData);
+
+	const auto& AssetRegistry = IAssetRegistry::GetChecked();
+	MetaDataCacheClassesByAncestor.Reset();
+	AssetPathsByClassHierarchy.Reset();
+
+	// Only depends on the number of classes, the asset lists are built per class when they are queried.
+	TArray<FTopLevelAssetPath> MetaDataCacheClasses;
+	GetMetaDataCacheClasses(OUT MetaDataCacheClasses);
+
+	TArray<FTopLevelAssetPath> ClassHierarchy;
+	for (const auto& ClassPath : MetaDataCacheClasses)
+	{
+		ClassHierarchy.Reset();
+		ClassHierarchy.Add(ClassPath);
+		AssetRegistry.GetAncestorClassNames(ClassPath, OUT ClassHierarchy);
+
+		for (const auto& AncestorClassPath : ClassHierarchy)
+		{
+			MetaDataCacheClassesByAncestor.FindOrAdd(AncestorClassPath).Add(ClassPath);
+		}
+	}
+	bClassHierarchyIndexBuilt = true;
+}
+
+void UJsonDataAssetSubsystem::GetMetaDataCacheClasses(TArray<FTopLevelAssetPath>& OutClassPaths) const
+{
+	if (AssetMetaDataCacheBinary.IsValid())
+	{
+		AssetMetaDataCacheBinary->GetClassPaths(OUT OutClassPaths);
+	}
+	else
+	{
+		AssetMetaDataCache.PathsByClass.GetKeys(OUT OutClassPaths);
+	}
+}
+
+void UJsonDataAssetSubsystem::AppendMetaDataCachePaths(
+	const FTopLevelAssetPath& ClassPath,
+	TArray<FJsonDataAssetPath>& OutPaths) const
+{
+	if (AssetMetaDataCacheBinary.IsValid())
+	{
+		AssetMetaDataCacheBinary->AppendAssetPaths(ClassPath, OUT OutPaths);
+	}
+	else if (const auto* pEntries = AssetMetaDataCache.PathsByClass.Find(ClassPath))
+	{
+		OutPaths.Append(pEntries->Paths);
+	}
+}
+
+void UJsonDataAssetSubsystem::RequestAsyncLoad(
+	const FJsonDataAssetPath& Path,
+	FOnJsonDataAssetLoaded Callback,
+	UE::Tasks::ETaskPriority Priority)
+{
+	check(IsInGameThread());
+
+	DECLARE_SCOPE_CYCLE_COUNTER(
+		TEXT("UJsonDataAssetSubsystem::RequestAsyncLoad"),
+		STAT_RequestAsyncLoad,
+		STATGROUP_OUUJsonData);
+
+	if (Path.IsNull())
+	{
+		Callback.ExecuteIfBound(nullptr);
+		return;
+	}
+
+	if (auto* pPendingCallbacks = PendingAsyncLoads.Find(Path))
+	{
+		// There is already a load in flight for this path. Just wait for it to complete.
+		pPendingCallbacks->Add(MoveTemp(Callback));
+		return;
+	}
+	PendingAsyncLoads.Add(Path).Add(MoveTemp(Callback));
+
+	// Resolve the source path on the game thread, because it requires access to the subsystem mappings.
+	FString LoadPath = OUU::JsonData::Runtime::PackageToSourceFull(Path.GetPackagePath(), EJsonDataAccessMode::Read);
+	// Continue prefetches instead of reading the file a second time.
+	auto PrefetchTask = OUU::JsonData::Runtime::Private::FJsonDataPrefetchCache::Get().TakePrefetchTask(LoadPath);
+
+	UE::Tasks::Launch(
+		UE_SOURCE_LOCATION,
+		[WeakThis = TWeakObjectPtr<UJsonDataAssetSubsystem>(this),
+		 Path,
+		 LoadPath = MoveTemp(LoadPath),
+		 PrefetchTask = MoveTemp(PrefetchTask)]() {
+			auto LoadResult = PrefetchTask.IsValid()
+				? PrefetchTask.GetResult()
+				: OUU::JsonData::Runtime::Private::ReadAndParseJsonFile(LoadPath);
+
+			AsyncTask(ENamedThreads::GameThread, [WeakThis, Path, LoadResult = MoveTemp(LoadResult)]() {
+				auto* Subsystem = WeakThis.Get();
+				if (Subsystem == nullptr)
+					return;
+
+				// The asset may have been loaded synchronously in the meantime.
+				// In that case there is no need to import the json data a second time.
+				UJsonDataAsset* LoadedAsset = Path.ResolveObject();
+				if (LoadedAsset == nullptr)
+				{
+					if (LoadResult.IsValid())
+					{
+						UE_JSON_DATA_TRACE_ASSET_LOAD(Path.GetPackagePath());
+						LoadedAsset = UJsonDataAsset::ImportJsonDataAsset_Internal(
+							Path,
+							nullptr,
+							LoadResult.LoadPath,
+							LoadResult.JsonObject.ToSharedRef());
+					}
+					else
+					{
+						LoadResult.ReportError();
+					}
+				}
+
+				Subsystem->FinishAsyncLoad(Path, LoadedAsset);
+			});
+		},
+		Priority);
+}
+
+void UJsonDataAssetSubsystem::PrefetchDependencyClosure(
+	const FJsonDataAssetPath& Path,
+	UE::Tasks::ETaskPriority Priority)
+{
+	check(IsInGameThread());
+
+	DECLARE_SCOPE_CYCLE_COUNTER(
+		TEXT("UJsonDataAssetSubsystem::PrefetchDependencyClosure"),
+		STAT_PrefetchDependencyClosure,
+		STATGROUP_OUUJsonData);
+
+	auto& PrefetchCache = OUU::JsonData::Runtime::Private::FJsonDataPrefetchCache::Get();
+	int32 NumPrefetchedFiles = 0;
+	for (const auto& DependencyPath : GetJsonDependencyClosure(Path))
+	{
+		// Loaded assets only read their files again when they are reloaded, which never uses prefetched files.
+		if (DependencyPath.ResolveObject() || PendingAsyncLoads.Contains(DependencyPath))
+			continue;
+
+		PrefetchCache.Prefetch(
+			OUU::JsonData::Runtime::PackageToSourceFull(DependencyPath.GetPackagePath(), EJsonDataAccessMode::Read),
+			Priority);
+		NumPrefetchedFiles += 1;
+	}
+
+	UE_LOG(
+		LogJsonDataAsset,
+		Verbose,
+		TEXT("Prefetching %i json files for dependency closure of %s"),
+		NumPrefetchedFiles,
+		*Path.ToString());
+}
+
+void UJsonDataAssetSubsystem::FinishAsyncLoad(const FJsonDataAssetPath& Path, UJsonDataAsset* LoadedAsset)
+{
+	TArray<FOnJsonDataAssetLoaded> Callbacks;
+	if (PendingAsyncLoads.RemoveAndCopyValue(Path, OUT Callbacks) == false)
+		return;
+
+	for (auto& Callback : Callbacks)
+	{
+		Callback.ExecuteIfBound(LoadedAsset);
+	}
 }
 
-void UJsonDataAssetSubsystem::ImportAllAssets(const FName& RootName, bool bOnlyMissing)
+void UJsonDataAssetSubsystem::ImportAssetsInDirectory(const FName& RootName, const FString& JsonDir, bool bOnlyMissing)
 {
 	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UJsonDataAssetSubsystem::ImportAll"), STAT_ImportAll, STATGROUP_OUUJsonData);
 
-	const FString JsonDir = OUU::JsonData::Runtime::GetSourceRoot_Full(RootName, EJsonDataAccessMode::Read);
 	if (!FPaths::DirectoryExists(JsonDir))
 	{
 		// No need to import anything if there is no json source directory
@@ -601,11 +1354,30 @@ void UJsonDataAssetSubsystem::ImportAllAssets(const FName& RootName, bool bOnlyM
 	// Ensure that none of the asset saves during this call scope cause json exports.
 	TGuardValue ScopedDisableAutoExport{this->bAutoExportJson, false};
 
-	TArray<UPackage*> AllPackages;
+	struct FPendingImport
+	{
+		FString FilePath;
+		FString PackagePath;
+		OUU::JsonData::Runtime::Private::FJsonFileLoadResult LoadResult;
+		OUU::JsonData::Runtime::Private::FJsonDataImportManifest::FEntry ManifestEntry;
+	};
+	TArray<FPendingImport> PendingImports;
+
+	// Only the editor saves the imported assets into the cache, so only the editor needs to track their sources.
+	const bool bUpdateManifest = GIsEditor;
+	OUU::JsonData::Runtime::Private::FJsonDataImportManifest Manifest(RootName);
+	if (bUpdateManifest)
+	{
+		Manifest.Load();
+	}
+
 	int32 NumPackagesLoaded = 0;
 	int32 NumPackagesFailedToLoad = 0;
-	auto VisitorLambda =
-		[&NumPackagesLoaded, &NumPackagesFailedToLoad, bOnlyMissing](const TCHAR* FilePath, bool bIsDirectory) -> bool {
+
+	// Stage 1 (game thread): Collect all files that need to be imported.
+	auto VisitorLambda = [&PendingImports, &NumPackagesFailedToLoad, &Manifest, bOnlyMissing, bUpdateManifest](
+							 const TCHAR* FilePath,
+							 bool bIsDirectory) -> bool {
 		if (bIsDirectory)
 			return true;
 
@@ -642,22 +1414,113 @@ void UJsonDataAssetSubsystem::ImportAllAssets(const FName& RootName, bool bOnlyM
 
 		const auto PackagePath = OUU::JsonData::Runtime::SourceFullToPackage(FilePath, EJsonDataAccessMode::Read);
 
-		FString PackageFilename;
-		const bool bPackageAlreadyExists = FPackageName::DoesPackageExist(PackagePath, &PackageFilename);
+		const bool bPackageAlreadyExists = FPackageName::DoesPackageExist(PackagePath);
 		if (bPackageAlreadyExists && bOnlyMissing)
 		{
 			// Existing asset was found. Skip if only importing missing files.
-			return true;
+			// The cache cleanup already removed assets whose source content changed, but the asset class may have
+			// changed since the import.
+			const auto* ManifestEntry = bUpdateManifest ? Manifest.FindEntry(PackagePath) : nullptr;
+			if (ManifestEntry == nullptr || Manifest.IsImportedWithCurrentVersions(*ManifestEntry))
+			{
+				return true;
+			}
+		}
+
+		auto& PendingImport = PendingImports.AddDefaulted_GetRef();
+		PendingImport.FilePath = FilePath;
+		PendingImport.PackagePath = PackagePath;
+		// Resolve the source path here, because the subsystem mappings must not be accessed from worker threads.
+		PendingImport.LoadResult.LoadPath =
+			OUU::JsonData::Runtime::PackageToSourceFull(PackagePath, EJsonDataAccessMode::Read);
+		return true;
+	};
+
+	const IPlatformFile::FDirectoryVisitorFunc VisitorFunc = VisitorLambda;
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	PlatformFile.IterateDirectoryRecursively(*JsonDir, VisitorFunc);
+
+	// Stage 2 (worker threads): Read and parse the files batch by batch, so the next batch can already be parsed while
+	// the game thread is busy importing the previous one. This also limits the number of json DOMs kept in memory.
+	static constexpr int32 ImportBatchSize = 256;
+	const int32 NumBatches = FMath::DivideAndRoundUp(PendingImports.Num(), ImportBatchSize);
+	const int32 NumWorkers = OUU::JsonData::Runtime::Private::GetNumImportWorkers();
+
+	auto LaunchParseBatch = [&PendingImports, NumWorkers, bUpdateManifest](int32 BatchIndex) -> UE::Tasks::FTask {
+		return UE::Tasks::Launch(UE_SOURCE_LOCATION, [&PendingImports, NumWorkers, bUpdateManifest, BatchIndex]() {
+			const int32 BatchStart = BatchIndex * ImportBatchSize;
+			const int32 BatchNum = FMath::Min(ImportBatchSize, PendingImports.Num() - BatchStart);
+			// One ParallelFor iteration per worker that pulls files from a shared counter, so the number of threads
+			// that read files at the same time never exceeds the worker count (the batch size of a ParallelFor over
+			// all files only controls the chunk size, not the number of threads).
+			const int32 NumTasks = FMath::Min(NumWorkers, BatchNum);
+			std::atomic<int32> NextIndex = 0;
+			ParallelFor(
+				TEXT("JsonDataAsset.ReadAndParse"),
+				NumTasks,
+				1,
+				[&PendingImports, &NextIndex, BatchStart, BatchNum, bUpdateManifest](int32) {
+					for (int32 Index = NextIndex++; Index < BatchNum; Index = NextIndex++)
+					{
+						auto& PendingImport = PendingImports[BatchStart + Index];
+						auto& LoadResult = PendingImport.LoadResult;
+						if (bUpdateManifest == false)
+						{
+							LoadResult = OUU::JsonData::Runtime::Private::ReadAndParseJsonFile(LoadResult.LoadPath);
+							continue;
+						}
+
+						// Hash the buffer that is parsed anyway instead of reading the file a second time.
+						const FFileStatData StatData =
+							FPlatformFileManager::Get().GetPlatformFile().GetStatData(*LoadResult.LoadPath);
+						FMD5Hash ContentHash;
+						LoadResult =
+							OUU::JsonData::Runtime::Private::ReadAndParseJsonFile(LoadResult.LoadPath, &ContentHash);
+						if (LoadResult.IsValid())
+						{
+							OUU::JsonData::Runtime::Private::FJsonDataImportManifest::SetSourceFileHash(
+								LoadResult.LoadPath,
+								StatData,
+								ContentHash,
+								OUT PendingImport.ManifestEntry);
+						}
+					}
+				},
+				NumTasks > 1 ? EParallelForFlags::BackgroundPriority : EParallelForFlags::ForceSingleThread);
+		});
+	};
+
+	// Stage 3 (game thread): Create UObjects and import the properties from the parsed json objects.
+	auto ImportParsedFile = [&NumPackagesLoaded, &NumPackagesFailedToLoad, &Manifest](FPendingImport& PendingImport) {
+		auto& LoadResult = PendingImport.LoadResult;
+		if (LoadResult.IsValid() == false)
+		{
+			LoadResult.ReportError();
+			NumPackagesFailedToLoad++;
+			return;
+		}
+
+		const auto Path = FJsonDataAssetPath::FromPackagePath(PendingImport.PackagePath);
+		UJsonDataAsset* NewDataAsset = nullptr;
+		{
+			UE_JSON_DATA_TRACE_ASSET_LOAD(PendingImport.PackagePath);
+			// Same as FJsonDataAssetPath::ForceReload(), but re-uses the json object we already parsed.
+			NewDataAsset = UJsonDataAsset::ImportJsonDataAsset_Internal(
+				Path,
+				Path.ResolveObject(),
+				LoadResult.LoadPath,
+				LoadResult.JsonObject.ToSharedRef());
 		}
+		// Free the json DOM as soon as possible.
+		LoadResult.JsonObject.Reset();
 
-		auto* NewDataAsset = FJsonDataAssetPath::FromPackagePath(PackagePath).ForceReload();
 		if (!IsValid(NewDataAsset))
 		{
 			// Error messages in the load function itself should be sufficient. But it's nice to have a summary
 			// metric.
 			NumPackagesFailedToLoad++;
-			// Continue with other files anyways
-			return true;
+			return;
 		}
 
 #if WITH_EDITOR
@@ -665,18 +1528,10 @@ void UJsonDataAssetSubsystem::ImportAllAssets(const FName& RootName, bool bOnlyM
 		{
 			UPackage* NewPackage = NewDataAsset->GetPackage();
 
-			// The name of the package
-			const FString PackageName = NewPackage->GetName();
-
 			// Construct a filename from long package name.
 			const FString& FileExtension = FPackageName::GetAssetPackageExtension();
-			PackageFilename = FPackageName::LongPackageNameToFilename(PackagePath, FileExtension);
-
-			// The file already exists, no need to prompt for save as
-			FString BaseFilename, Extension, Directory;
-			// Split the path to get the filename without the directory structure
+			FString PackageFilename = FPackageName::LongPackageNameToFilename(PendingImport.PackagePath, FileExtension);
 			FPaths::NormalizeFilename(PackageFilename);
-			FPaths::Split(PackageFilename, Directory, BaseFilename, Extension);
 
 			FSavePackageArgs SaveArgs;
 			SaveArgs.TopLevelFlags = RF_Standalone;
@@ -686,6 +1541,14 @@ void UJsonDataAssetSubsystem::ImportAllAssets(const FName& RootName, bool bOnlyM
 			if (SaveResult == ESavePackageResult::Success)
 			{
 				NumPackagesLoaded++;
+
+				if (PendingImport.ManifestEntry.ContentHash.IsValid())
+				{
+					OUU::JsonData::Runtime::Private::FJsonDataImportManifest::SetCurrentClassVersions(
+						NewDataAsset->GetClass(),
+						OUT PendingImport.ManifestEntry);
+					Manifest.SetEntry(PendingImport.PackagePath, PendingImport.ManifestEntry);
+				}
 			}
 			else
 			{
@@ -693,19 +1556,30 @@ void UJsonDataAssetSubsystem::ImportAllAssets(const FName& RootName, bool bOnlyM
 					Error,
 					NewPackage,
 					TEXT("Failed to save package for json data asset %s"),
-					FilePath);
+					*PendingImport.FilePath);
 
 				NumPackagesFailedToLoad++;
 			}
 		}
 #endif
-		return true;
 	};
 
-	const IPlatformFile::FDirectoryVisitorFunc VisitorFunc = VisitorLambda;
+	UE::Tasks::FTask ParseTask = NumBatches > 0 ? LaunchParseBatch(0) : UE::Tasks::FTask();
+	for (int32 BatchIndex = 0; BatchIndex < NumBatches; ++BatchIndex)
+	{
+		ParseTask.Wait();
+		if (BatchIndex + 1 < NumBatches)
+		{
+			ParseTask = LaunchParseBatch(BatchIndex + 1);
+		}
 
-	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
-	PlatformFile.IterateDirectoryRecursively(*JsonDir, VisitorFunc);
+		const int32 BatchStart = BatchIndex * ImportBatchSize;
+		const int32 BatchEnd = FMath::Min(BatchStart + ImportBatchSize, PendingImports.Num());
+		for (int32 i = BatchStart; i < BatchEnd; ++i)
+		{
+			ImportParsedFile(PendingImports[i]);
+		}
+	}
 
 	UE_LOG(LogJsonDataAsset, Log, TEXT("Loaded %i json data assets"), NumPackagesLoaded);
 	UE_CLOG(
@@ -715,6 +1589,10 @@ void UJsonDataAssetSubsystem::ImportAllAssets(const FName& RootName, bool bOnlyM
 		TEXT("Failed to load %i json data assets"),
 		NumPackagesFailedToLoad);
 
+	if (bUpdateManifest)
+	{
+		Manifest.Save();
+	}
 	OUU::JsonData::Runtime::FCacheVersion::Current().Write();
 }
 
@@ -755,6 +1633,12 @@ void UJsonDataAssetSubsystem::AddPluginDataRoot(const FName& PluginName)
 
 		RegisterMountPoints(PluginName);
 
+		if (SourceWatcher.IsValid())
+		{
+			SourceWatcher->WatchDirectory(
+				OUU::JsonData::Runtime::GetSourceRoot_Full(PluginName, EJsonDataAccessMode::Read));
+		}
+
 		OnNewPluginRootAdded.Broadcast(PluginName);
 	}
 	else
@@ -899,17 +1783,193 @@ void UJsonDataAssetSubsystem::PostEngineInit()
 {
 	RescanAllAssets();
 
+	if (OUU::JsonData::Runtime::Private::FJsonDataSourceWatcher::IsEnabled())
+	{
+		SourceWatcher = MakeShared<OUU::JsonData::Runtime::Private::FJsonDataSourceWatcher>(
+			[this](const TArray<FString>& ChangedFiles) { HandleSourceFilesChanged(ChangedFiles); });
+		for (const auto& RootName : AllRootNames)
+		{
+			SourceWatcher->WatchDirectory(
+				OUU::JsonData::Runtime::GetSourceRoot_Full(RootName, EJsonDataAccessMode::Read));
+		}
+	}
+
+#if !WITH_EDITOR
+	// All native classes are known to the asset registry now.
+	{
+		FWriteScopeLock WriteLock(ClassIndexLock);
+		BuildClassHierarchyIndex();
+	}
+#endif
+
 	if (OUU::JsonData::Runtime::Private::CVar_ImportAllAssetsOnStartup.GetValueOnGameThread())
 	{
 		ImportAllAssets(true);
 	}
 }
 
+void UJsonDataAssetSubsystem::SetRemotePathIndexChecksums(
+	UNetConnection* Connection,
+	const TMap<FName, uint32>& RemoteChecksums)
+{
+	if (IsValid(Connection) == false)
+	{
+		return;
+	}
+
+	for (auto It = RemotePathIndexStates.CreateIterator(); It; ++It)
+	{
+		if (It->Key.IsValid() == false)
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	// Last chance to apply deferred changes before the new connection starts to rely on the path index.
+	ApplyPathIndexChanges({});
+
+	const TWeakObjectPtr<UNetConnection> ConnectionKey(Connection);
+	RemotePathIndexStates.FindOrAdd(ConnectionKey).ChecksumsByRoot = RemoteChecksums;
+	UpdateRemotePathIndexMatch(ConnectionKey);
+}
+
+void UJsonDataAssetSubsystem::HandleGameModePostLogin(AGameModeBase* GameMode, APlayerController* NewPlayer)
+{
+	if (OUU::JsonData::Runtime::Private::CVar_UseFastNetSerialization.GetValueOnGameThread() == false
+		|| IsValid(NewPlayer) == false || NewPlayer->IsLocalController())
+	{
+		return;
+	}
+
+	// The client sends its checksums as soon as its copy of the component begins play.
+	auto* HandshakeComponent = NewObject<UJsonDataAssetNetHandshakeComponent>(NewPlayer);
+	HandshakeComponent->RegisterComponent();
+}
+
+bool UJsonDataAssetSubsystem::CanUseFastNetSerialization(UPackageMap* PackageMap) const
+{
+	const auto* PackageMapClient = Cast<UPackageMapClient>(PackageMap);
+	const UNetConnection* Connection = PackageMapClient ? PackageMapClient->GetConnection() : nullptr;
+	if (Connection == nullptr)
+	{
+		// Not serializing for a specific connection (e.g. local archives), so the local index table is the only one.
+		return true;
+	}
+
+	const auto* RemoteState = RemotePathIndexStates.Find(TWeakObjectPtr<UNetConnection>(Connection));
+	return RemoteState && RemoteState->bMatchesLocalPathIndex;
+}
+
+void UJsonDataAssetSubsystem::UpdateRemotePathIndexMatch(const TWeakObjectPtr<UNetConnection>& Connection)
+{
+	auto* RemoteState = RemotePathIndexStates.Find(Connection);
+	if (RemoteState == nullptr)
+	{
+		return;
+	}
+
+	TArray<FName> MismatchedRoots;
+	for (const auto& LocalEntry : PathIndexChecksumsByRoot)
+	{
+		const uint32* RemoteChecksum = RemoteState->ChecksumsByRoot.Find(LocalEntry.Key);
+		if (RemoteChecksum == nullptr || *RemoteChecksum != LocalEntry.Value)
+		{
+			MismatchedRoots.Add(LocalEntry.Key);
+		}
+	}
+	for (const auto& RemoteEntry : RemoteState->ChecksumsByRoot)
+	{
+		if (PathIndexChecksumsByRoot.Contains(RemoteEntry.Key) == false)
+		{
+			MismatchedRoots.Add(RemoteEntry.Key);
+		}
+	}
+
+	const bool bMatchesLocalPathIndex = MismatchedRoots.Num() == 0;
+	if (bMatchesLocalPathIndex == RemoteState->bMatchesLocalPathIndex)
+	{
+		return;
+	}
+	RemoteState->bMatchesLocalPathIndex = bMatchesLocalPathIndex;
+
+	const FString ConnectionName = Connection.IsValid() ? Connection->GetName() : TEXT("<invalid>");
+	if (bMatchesLocalPathIndex)
+	{
+		UE_LOG(
+			LogJsonDataAsset,
+			Log,
+			TEXT("Json data asset path index of connection %s matches. Using fast net serialization."),
+			*ConnectionName);
+	}
+	else
+	{
+		UE_LOG(
+			LogJsonDataAsset,
+			Warning,
+			TEXT("Json data asset path index of connection %s does not match for roots [%s]. Falling back to full "
+				 "path net serialization."),
+			*ConnectionName,
+			*FString::JoinBy(MismatchedRoots, TEXT(", "), [](const FName& RootName) { return RootName.ToString(); }));
+	}
+}
+
 #if WITH_EDITOR
+void UJsonDataAssetSubsystem::HandleAssetRegistryAssetsChanged(const FAssetData& AssetData)
+{
+	// The asset registry reports all asset types, including every asset found by the background scan.
+	if (AssetData.IsInstanceOf(UJsonDataAsset::StaticClass())
+		|| OUU::JsonData::Runtime::PackageIsJsonData(AssetData.PackageName.ToString()))
+	{
+		InvalidateClassIndex();
+	}
+}
+
+void UJsonDataAssetSubsystem::HandleAssetRegistryAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+	if (OUU::JsonData::Runtime::PackageIsJsonData(FSoftObjectPath(OldObjectPath).GetLongPackageName()))
+	{
+		InvalidateClassIndex();
+		return;
+	}
+	HandleAssetRegistryAssetsChanged(AssetData);
+}
+
+void UJsonDataAssetSubsystem::InvalidateClassIndex()
+{
+	check(IsInGameThread());
+	FWriteScopeLock WriteLock(ClassIndexLock);
+	if (AssetPathsByClassHierarchy.Num() == 0 && AssetPathsByClass.Num() == 0)
+		return;
+
+	// Loading an asset that was not imported yet registers it with the asset registry, so the lists may be reset
+	// while a view of them is iterated. Moving the maps keeps the allocations of the lists.
+	RetiredClassIndexPaths.Add(MoveTemp(AssetPathsByClassHierarchy));
+	RetiredClassIndexPaths.Add(MoveTemp(AssetPathsByClass));
+	AssetPathsByClassHierarchy.Reset();
+	AssetPathsByClass.Reset();
+
+	if (RetiredClassIndexTickerHandle.IsValid() == false)
+	{
+		RetiredClassIndexTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateWeakLambda(
+			this,
+			[this](float) {
+				check(IsInGameThread());
+				RetiredClassIndexTickerHandle.Reset();
+				FWriteScopeLock WriteLock(ClassIndexLock);
+				RetiredClassIndexPaths.Empty();
+				return false;
+			}));
+	}
+}
+
 void UJsonDataAssetSubsystem::HandlePreBeginPIE(const bool bIsSimulating)
 {
 	// Make sure all asset paths are up to date in case we want to use fast net serialization.
 	RescanAllAssets();
+
+	// Game code may modify json data assets during PIE without marking their packages dirty, so reimports after this
+	// point can't rely on the hashes of the last import.
+	OUU::JsonData::Runtime::Private::FJsonDataAssetDiffReimport::Get().ResetAllImportHashes();
 }
 
 void UJsonDataAssetSubsystem::CleanupAssetCache(const FName& RootName)
@@ -936,12 +1996,29 @@ void UJsonDataAssetSubsystem::CleanupAssetCache(const FName& RootName)
 
 		// Delete the directory on-disk before mounting the directory to purge all generated uasset files.
 		PlatformFile.DeleteDirectoryRecursively(*MountDiskPath);
+		OUU::JsonData::Runtime::Private::FJsonDataImportManifest::Delete(RootName);
 		return;
 	}
 
+	OUU::JsonData::Runtime::Private::FJsonDataImportManifest Manifest(RootName);
+	Manifest.Load();
+
+	struct FCachedAsset
+	{
+		FString FilePath;
+		FString PackagePath;
+		FString SourcePath;
+		OUU::JsonData::Runtime::Private::FJsonDataImportManifest::FEntry* ManifestEntry = nullptr;
+		OUU::JsonData::Runtime::Private::FJsonDataImportManifest::FEntry UpdatedManifestEntry;
+		bool bIsUpToDate = false;
+	};
+	TArray<FCachedAsset> CachedAssets;
+
 	// If clearing the whole cache is disabled, at least stale assets that do not have a corresponding source file must
 	// be removed
-	auto VisitorLambda = [&PlatformFile, &MountDiskPath, &RootName](const TCHAR* FilePath, bool bIsDirectory) -> bool {
+	auto VisitorLambda = [&PlatformFile, &MountDiskPath, &RootName, &Manifest, &CachedAssets](
+							 const TCHAR* FilePath,
+							 bool bIsDirectory) -> bool {
 		if (bIsDirectory)
 		{
 			return true;
@@ -976,32 +2053,64 @@ void UJsonDataAssetSubsystem::CleanupAssetCache(const FName& RootName)
 		if (PlatformFile.FileExists(*SourcePath) == false)
 		{
 			PlatformFile.DeleteFile(FilePath);
+			Manifest.RemoveEntry(PackagePath);
 			UE_LOG(
 				LogJsonDataAsset,
 				Log,
 				TEXT("Deleted stale uasset (json source is missing) from json data cache: %s"),
 				FilePath);
 		}
+		else if (auto* ManifestEntry = Manifest.FindEntry(PackagePath))
+		{
+			// Content hashes are compared in parallel below
+			auto& CachedAsset = CachedAssets.AddDefaulted_GetRef();
+			CachedAsset.FilePath = FilePath;
+			CachedAsset.PackagePath = PackagePath;
+			CachedAsset.SourcePath = SourcePath;
+			CachedAsset.ManifestEntry = ManifestEntry;
+		}
 		else
 		{
-			const auto AssetModTime = PlatformFile.GetTimeStamp(FilePath);
-			const auto SourceModTime = PlatformFile.GetTimeStamp(*SourcePath);
-
-			if (AssetModTime < SourceModTime)
-			{
-				PlatformFile.DeleteFile(FilePath);
-				UE_LOG(
-					LogJsonDataAsset,
-					Log,
-					TEXT("Deleted outdated uasset (json source is newer) from json data cache: %s"),
-					FilePath);
-			}
+			PlatformFile.DeleteFile(FilePath);
+			UE_LOG(
+				LogJsonDataAsset,
+				Log,
+				TEXT("Deleted unknown uasset (not in import manifest) from json data cache: %s"),
+				FilePath);
 		}
 
 		return true;
 	};
 
 	PlatformFile.IterateDirectoryRecursively(*MountDiskPath, VisitorLambda);
+
+	ParallelFor(TEXT("JsonDataAsset.CheckCachedAssets"), CachedAssets.Num(), 16, [&CachedAssets](int32 Index) {
+		auto& CachedAsset = CachedAssets[Index];
+		CachedAsset.bIsUpToDate = OUU::JsonData::Runtime::Private::FJsonDataImportManifest::IsSourceFileUnchanged(
+			*CachedAsset.ManifestEntry,
+			CachedAsset.SourcePath,
+			OUT CachedAsset.UpdatedManifestEntry);
+	});
+
+	for (auto& CachedAsset : CachedAssets)
+	{
+		if (CachedAsset.bIsUpToDate)
+		{
+			// Remember the new time stamp, so the file doesn't need to be hashed again on the next startup.
+			*CachedAsset.ManifestEntry = CachedAsset.UpdatedManifestEntry;
+			continue;
+		}
+
+		PlatformFile.DeleteFile(*CachedAsset.FilePath);
+		Manifest.RemoveEntry(CachedAsset.PackagePath);
+		UE_LOG(
+			LogJsonDataAsset,
+			Log,
+			TEXT("Deleted outdated uasset (json source content changed) from json data cache: %s"),
+			*CachedAsset.FilePath);
+	}
+
+	Manifest.Save();
 }
 
 void UJsonDataAssetSubsystem::HandlePackageDeleted(UPackage* Package)
@@ -1036,11 +2145,15 @@ void UJsonDataAssetSubsystem::ModifyCook(
 			 "\t- Iterate:\t%s\n"
 			 "\t- CookJsonData:\t%s\n"
 			 "\t- CookJsonDataDependencies:\t%s\n"
-			 "\t- CookDeveloperContent:\t%s"),
+			 "\t- CookDeveloperContent:\t%s\n"
+			 "\t- CookCompactBinary:\t%s\n"
+			 "\t- CookBundle:\t%s"),
 		*LexToString(bIterateCook),
 		*LexToString(bCookJsonData),
 		*LexToString(bCookJsonDataDependencies),
-		*LexToString(bCookDeveloperContent));
+		*LexToString(bCookDeveloperContent),
+		*LexToString(OUU::JsonData::Runtime::Private::CVar_CookCompactBinary.GetValueOnGameThread()),
+		*LexToString(OUU::JsonData::Runtime::Private::CVar_CookBundle.GetValueOnGameThread()));
 
 	if (bCookJsonData == false /* || bIterateCook == false */)
 	{
@@ -1059,19 +2172,42 @@ void UJsonDataAssetSubsystem::ModifyCook(
 
 	TSet<FName> DependencyPackages;
 	FJsonDataAssetMetaDataCache MetaDataCache;
-	for (auto& RootName : AllRootNames)
+	ModifyCookInternal(
+		AllRootNames,
+		bIterateCook,
+		bCookDeveloperContent,
+		bCookJsonDataDependencies,
+		OUT DependencyPackages,
+		OUT MetaDataCache);
+
+	if (OUU::JsonData::Runtime::Private::CVar_CookBundle.GetValueOnGameThread())
 	{
-		ModifyCookInternal(
-			RootName,
-			bIterateCook,
-			bCookDeveloperContent,
-			bCookJsonDataDependencies,
-			OUT DependencyPackages,
-			OUT MetaDataCache);
+		TArray<FString> CookedJsonFiles;
+		for (const auto& Entry : MetaDataCache.PathsByClass)
+		{
+			for (const auto& Path : Entry.Value.Paths)
+			{
+				CookedJsonFiles.Add(
+					OUU::JsonData::Runtime::PackageToSourceFull(Path.GetPackagePath(), EJsonDataAccessMode::Write));
+			}
+		}
+
+		for (auto& RootName : AllRootNames)
+		{
+			// ReSharper disable once CppExpressionWithoutSideEffects
+			OUU::JsonData::Runtime::Private::FJsonDataBundle::Write(
+				OUU::JsonData::Runtime::GetSourceRoot_Full(RootName, EJsonDataAccessMode::Write),
+				CookedJsonFiles);
+		}
 	}
 
+	const FString MetaDataCacheFilePath = GetMetaDataCacheFilePath(EJsonDataAccessMode::Write);
+	// ReSharper disable once CppExpressionWithoutSideEffects
+	MetaDataCache.SaveToFile(MetaDataCacheFilePath);
 	// ReSharper disable once CppExpressionWithoutSideEffects
-	MetaDataCache.SaveToFile(GetMetaDataCacheFilePath(EJsonDataAccessMode::Write));
+	OUU::JsonData::Runtime::Private::FJsonDataMetaDataCacheBinary::Write(
+		MetaDataCache,
+		OUU::JsonData::Runtime::Private::FJsonDataMetaDataCacheBinary::GetFilePath(MetaDataCacheFilePath));
 
 	if (bCookJsonDataDependencies)
 	{
@@ -1096,64 +2232,104 @@ void UJsonDataAssetSubsystem::ModifyCook(
 }
 
 void UJsonDataAssetSubsystem::ModifyCookInternal(
-	const FName& RootName,
+	TConstArrayView<FName> RootNames,
 	const bool bIterateCook,
 	const bool bCookDeveloperContent,
 	const bool bCookJsonDataDependencies,
 	TSet<FName>& OutDependencyPackages,
 	FJsonDataAssetMetaDataCache& OutMetaDataCache)
 {
-	const FString JsonDir_READ = OUU::JsonData::Runtime::GetSourceRoot_Full(RootName, EJsonDataAccessMode::Read);
-	if (!FPaths::DirectoryExists(JsonDir_READ))
+	struct FCookedJsonFile
 	{
-		return;
-	}
+		FString FilePath;
+		int32 RootIndex = INDEX_NONE;
+		FString PackagePath;
+		bool bSkipResave = false;
+
+		// Results of the game thread stage. Class is null if the asset failed to load.
+		const UClass* Class = nullptr;
+		FJsonDataAssetSearchableTags SearchableTags;
 
-	const FString DeveloperDir = JsonDir_READ / TEXT("Developers");
+		// Results of the dependency stage
+		TArray<FJsonDataAssetPath> JsonDependencies;
+		TArray<FName> OtherDependencies;
+	};
 
 	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
-	IAssetRegistry& AssetRegistry = *IAssetRegistry::Get();
 
-	int32 NumJsonDataAssetsAdded = 0;
-
-	auto VisitorLambda = [bIterateCook,
-						  bCookDeveloperContent,
-						  bCookJsonDataDependencies,
-						  &DeveloperDir,
-						  &PlatformFile,
-						  &NumJsonDataAssetsAdded,
-						  &OutDependencyPackages,
-						  &OutMetaDataCache,
-						  &AssetRegistry](const TCHAR* FilePath, bool bIsDirectory) -> bool {
-		if (bIsDirectory)
-			return true;
+	// Stage 1 (worker threads): Enumerate the source directories of all roots.
+	// Directory paths are resolved here, because the subsystem mappings must not be accessed from worker threads.
+	TArray<FString> JsonDirs;
+	for (const auto& RootName : RootNames)
+	{
+		JsonDirs.Add(OUU::JsonData::Runtime::GetSourceRoot_Full(RootName, EJsonDataAccessMode::Read));
+	}
 
-		if (FPaths::GetExtension(FilePath) != TEXT("json"))
-			return true;
+	TArray<TArray<FString>> FilePathsByRoot;
+	FilePathsByRoot.SetNum(RootNames.Num());
+	ParallelFor(
+		TEXT("JsonDataAsset.CookEnumerateFiles"),
+		RootNames.Num(),
+		1,
+		[&JsonDirs, &FilePathsByRoot, &PlatformFile, bCookDeveloperContent](int32 RootIndex) {
+			const FString& JsonDir_READ = JsonDirs[RootIndex];
+			if (!FPaths::DirectoryExists(JsonDir_READ))
+				return;
+
+			const FString DeveloperDir = JsonDir_READ / TEXT("Developers");
+			auto& FilePaths = FilePathsByRoot[RootIndex];
+			PlatformFile.IterateDirectoryRecursively(
+				*JsonDir_READ,
+				[&DeveloperDir, &FilePaths, bCookDeveloperContent](const TCHAR* FilePath, bool bIsDirectory) -> bool {
+					if (bIsDirectory)
+						return true;
+
+					if (FPaths::GetExtension(FilePath) != TEXT("json"))
+						return true;
+
+					if (OUU::JsonData::Runtime::ShouldIgnoreInvalidExtensions()
+						&& FPaths::GetBaseFilename(FilePath).Contains("."))
+						return true;
+
+					if (bCookDeveloperContent == false && FStringView(FilePath).StartsWith(DeveloperDir))
+					{
+						UE_LOG(
+							LogJsonDataAsset,
+							Verbose,
+							TEXT("Skipped local path %s, because it's inside of a developers directory"),
+							FilePath);
+						return true;
+					}
 
-		if (OUU::JsonData::Runtime::ShouldIgnoreInvalidExtensions() && FPaths::GetBaseFilename(FilePath).Contains("."))
-			return true;
+					FilePaths.Add(FilePath);
+					return true;
+				});
+
+			// Directory iteration order depends on the file system. Sort for deterministic meta data caches.
+			FilePaths.Sort();
+		});
 
-		if (bCookDeveloperContent == false && FStringView(FilePath).StartsWith(DeveloperDir))
+	TArray<FCookedJsonFile> CookedFiles;
+	for (int32 RootIndex = 0; RootIndex < RootNames.Num(); ++RootIndex)
+	{
+		for (auto& FilePath : FilePathsByRoot[RootIndex])
 		{
-			UE_LOG(
-				LogJsonDataAsset,
-				Verbose,
-				TEXT("Skipped local path %s, because it's inside of a developers directory"),
-				FilePath);
-			return true;
+			auto& CookedFile = CookedFiles.AddDefaulted_GetRef();
+			CookedFile.PackagePath =
+				OUU::JsonData::Runtime::SourceFullToPackage(FilePath, EJsonDataAccessMode::Read);
+			CookedFile.FilePath = MoveTemp(FilePath);
+			CookedFile.RootIndex = RootIndex;
 		}
+	}
 
-		const auto PackagePathString = OUU::JsonData::Runtime::SourceFullToPackage(FilePath, EJsonDataAccessMode::Read);
-		const auto RealPackagePath = FPackagePath::FromPackageNameChecked(PackagePathString);
-		const auto Path = FJsonDataAssetPath::FromPackagePath(PackagePathString);
-
-		bool bSkipResave = false;
-		if (bIterateCook)
-		{
+	if (bIterateCook)
+	{
+		ParallelFor(TEXT("JsonDataAsset.CookCheckTimeStamps"), CookedFiles.Num(), 64, [&](int32 Index) {
+			auto& CookedFile = CookedFiles[Index];
+			const auto RealPackagePath = FPackagePath::FromPackageNameChecked(CookedFile.PackagePath);
 			auto CachedAssetPath = RealPackagePath.GetLocalFullPath();
 			// Only re-save assets that did not change since last cook in iterative mode
-			if (PlatformFile.GetTimeStamp(*CachedAssetPath) > PlatformFile.GetTimeStamp(FilePath))
+			if (PlatformFile.GetTimeStamp(*CachedAssetPath) > PlatformFile.GetTimeStamp(*CookedFile.FilePath))
 			{
 				UE_LOG(
 					LogJsonDataAsset,
@@ -1161,59 +2337,102 @@ void UJsonDataAssetSubsystem::ModifyCookInternal(
 					TEXT("Skipped resaving local path %s, because it was newer than source and iterative cook is "
 						 "enabled"),
 					*CachedAssetPath);
-				bSkipResave = true;
+				CookedFile.bSkipResave = true;
 			}
-		}
+		});
+	}
+
+	// Stage 2 (worker threads): Collect the dependencies of all assets from the asset registry.
+	// Json-to-json dependencies are always cooked into the meta data cache, so packaged games can prefetch the
+	// dependency closure of an asset (see PrefetchDependencyClosure).
+	// The asset registry is complete at this point, so this can run while the game thread is busy with stage 3.
+	UE::Tasks::FTask DependencyTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [&CookedFiles]() {
+		IAssetRegistry& AssetRegistry = *IAssetRegistry::Get();
+		ParallelFor(
+			TEXT("JsonDataAsset.CookCollectDependencies"),
+			CookedFiles.Num(),
+			64,
+			[&CookedFiles, &AssetRegistry](int32 Index) {
+				auto& CookedFile = CookedFiles[Index];
+				const auto ObjectName = OUU::JsonData::Runtime::PackageToObjectName(CookedFile.PackagePath);
+				const FAssetIdentifier AssetIdentifier(*CookedFile.PackagePath, *ObjectName);
+
+				TArray<FAssetIdentifier> Dependencies;
+				AssetRegistry.GetDependencies(AssetIdentifier, OUT Dependencies);
+
+				for (auto& Dependency : Dependencies)
+				{
+					if (Dependency.IsPackage() == false)
+						continue;
+
+					auto PackageName = Dependency.PackageName;
+					if (OUU::JsonData::Runtime::PackageIsJsonData(PackageName.ToString()))
+					{
+						CookedFile.JsonDependencies.Add(FJsonDataAssetPath::FromPackagePath(PackageName.ToString()));
+					}
+					else
+					{
+						CookedFile.OtherDependencies.Add(PackageName);
+					}
+				}
+			},
+			EParallelForFlags::BackgroundPriority);
+	});
 
+	// Stage 3 (game thread): Load the assets, export the json files and collect the searchable tags.
+	for (auto& CookedFile : CookedFiles)
+	{
+		const auto Path = FJsonDataAssetPath::FromPackagePath(CookedFile.PackagePath);
 		const auto* LoadedJsonDataAsset = Path.LoadSynchronous();
 		if (!ensure(LoadedJsonDataAsset))
-			return true;
+			continue;
 
-		if (bSkipResave)
+		if (CookedFile.bSkipResave)
 		{
 			// ReSharper disable once CppExpressionWithoutSideEffects
 			LoadedJsonDataAsset->ExportJsonFile();
 		}
 
-		auto& PackagePaths =
-			OutMetaDataCache.PathsByClass.FindOrAdd(LoadedJsonDataAsset->GetClass()->GetClassPathName());
-		PackagePaths.Paths.Add(Path);
+		CookedFile.Class = LoadedJsonDataAsset->GetClass();
+		// Packaged games can't query the asset registry for json data assets, so searchable tags are cooked into the
+		// meta data cache.
+		GetSearchableTags(*LoadedJsonDataAsset, OUT CookedFile.SearchableTags);
+	}
 
-		if (bCookJsonDataDependencies)
-		{
-			const auto ObjectName = OUU::JsonData::Runtime::PackageToObjectName(PackagePathString);
-			const FAssetIdentifier AssetIdentifier(*PackagePathString, *ObjectName);
+	DependencyTask.Wait();
 
-			TArray<FAssetIdentifier> Dependencies;
-			AssetRegistry.GetDependencies(AssetIdentifier, OUT Dependencies);
+	// Stage 4 (game thread): Gather the results in file order.
+	TArray<int32> NumJsonDataAssetsAddedByRoot;
+	NumJsonDataAssetsAddedByRoot.SetNumZeroed(RootNames.Num());
+	for (auto& CookedFile : CookedFiles)
+	{
+		if (CookedFile.Class == nullptr)
+			continue;
 
-			for (auto& Dependency : Dependencies)
-			{
-				if (Dependency.IsPackage())
-				{
-					auto PackageName = Dependency.PackageName;
-					if (OUU::JsonData::Runtime::PackageIsJsonData(PackageName.ToString()) == false)
-					{
-						// We don't want to add json data assets directly to this list.
-						// As they are on the do not cook list, they will throw errors.
-						OutDependencyPackages.Add(PackageName);
-					}
-				}
-			}
-		}
-		NumJsonDataAssetsAdded += 1;
+		auto& PackagePaths = OutMetaDataCache.PathsByClass.FindOrAdd(CookedFile.Class->GetClassPathName());
+		PackagePaths.Paths.Add(FJsonDataAssetPath::FromPackagePath(CookedFile.PackagePath));
 
-		return true;
-	};
+		PackagePaths.SearchableTags.Add(MoveTemp(CookedFile.SearchableTags));
 
-	const IPlatformFile::FDirectoryVisitorFunc VisitorFunc = VisitorLambda;
-	PlatformFile.IterateDirectoryRecursively(*JsonDir_READ, VisitorFunc);
+		PackagePaths.Dependencies.AddDefaulted_GetRef().Paths = MoveTemp(CookedFile.JsonDependencies);
+		if (bCookJsonDataDependencies)
+		{
+			// We don't want to add json data assets directly to this list.
+			// As they are on the do not cook list, they will throw errors.
+			OutDependencyPackages.Append(CookedFile.OtherDependencies);
+		}
 
-	UE_LOG(
-		LogJsonDataAsset,
-		Log,
-		TEXT("Added %i json data assets for json data root %s"),
-		NumJsonDataAssetsAdded,
-		*RootName.ToString());
+		NumJsonDataAssetsAddedByRoot[CookedFile.RootIndex] += 1;
+	}
+
+	for (int32 RootIndex = 0; RootIndex < RootNames.Num(); ++RootIndex)
+	{
+		UE_LOG(
+			LogJsonDataAsset,
+			Log,
+			TEXT("Added %i json data assets for json data root %s"),
+			NumJsonDataAssetsAddedByRoot[RootIndex],
+			*RootNames[RootIndex].ToString());
+	}
 }
 #endif
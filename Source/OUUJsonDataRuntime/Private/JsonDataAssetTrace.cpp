@@ -0,0 +1,85 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#include "JsonDataAssetTrace.h"
+
+#if WITH_JSON_DATA_TRACE
+
+UE_TRACE_CHANNEL_DEFINE(JsonDataChannel)
+
+UE_TRACE_EVENT_BEGIN(JsonData, FileRead)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, BytesRead)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, FilePath)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(JsonData, AssetLoad)
+	UE_TRACE_EVENT_FIELD(uint64, StartCycle)
+	UE_TRACE_EVENT_FIELD(uint64, EndCycle)
+	UE_TRACE_EVENT_FIELD(uint32, NumProperties)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, PackagePath)
+UE_TRACE_EVENT_END()
+
+namespace OUU::JsonData::Runtime::Private
+{
+	namespace Trace
+	{
+		// Innermost active load scope of each thread.
+		thread_local FJsonDataAssetLoadTraceScope* CurrentLoadScope = nullptr;
+	} // namespace Trace
+
+	FJsonDataAssetLoadTraceScope::FJsonDataAssetLoadTraceScope(const FString& InPackagePath)
+	{
+		const bool bChannelEnabled = UE_TRACE_CHANNELEXPR_IS_ENABLED(JsonDataChannel);
+		if (bChannelEnabled == false)
+			return;
+
+		bActive = true;
+		PackagePath = InPackagePath;
+		StartCycle = FPlatformTime::Cycles64();
+		OuterScope = Trace::CurrentLoadScope;
+		Trace::CurrentLoadScope = this;
+
+		const bool bCpuChannelEnabled = UE_TRACE_CHANNELEXPR_IS_ENABLED(CpuChannel);
+		if (bCpuChannelEnabled)
+		{
+			// Dynamic timer name, so hitches can be attributed to assets without any further analysis.
+			FCpuProfilerTrace::OutputBeginDynamicEvent(*PackagePath);
+			bEmittedTimingScope = true;
+		}
+	}
+
+	FJsonDataAssetLoadTraceScope::~FJsonDataAssetLoadTraceScope()
+	{
+		if (bActive == false)
+			return;
+
+		if (bEmittedTimingScope)
+		{
+			FCpuProfilerTrace::OutputEndEvent();
+		}
+
+		UE_TRACE_LOG(JsonData, AssetLoad, JsonDataChannel)
+			<< AssetLoad.StartCycle(StartCycle) << AssetLoad.EndCycle(FPlatformTime::Cycles64())
+			<< AssetLoad.NumProperties(static_cast<uint32>(NumImportedProperties))
+			<< AssetLoad.PackagePath(*PackagePath, PackagePath.Len());
+
+		Trace::CurrentLoadScope = OuterScope;
+	}
+
+	void FJsonDataAssetLoadTraceScope::AddImportedProperties(int32 NumProperties)
+	{
+		if (Trace::CurrentLoadScope)
+		{
+			Trace::CurrentLoadScope->NumImportedProperties += NumProperties;
+		}
+	}
+
+	void TraceJsonFileRead(const FString& FilePath, int64 NumBytes)
+	{
+		UE_TRACE_LOG(JsonData, FileRead, JsonDataChannel)
+			<< FileRead.Cycle(FPlatformTime::Cycles64()) << FileRead.BytesRead(static_cast<uint64>(NumBytes))
+			<< FileRead.FilePath(*FilePath, FilePath.Len());
+	}
+} // namespace OUU::JsonData::Runtime::Private
+
+#endif
@@ -0,0 +1,75 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Trace/Config.h"
+
+// Unreal Insights tracing of json data asset loads. Enable with -trace=cpu,JsonData
+// Not in Public/ folder, because they should only be used directly by the system internal code.
+
+#if UE_TRACE_ENABLED && CPUPROFILERTRACE_ENABLED
+	#define WITH_JSON_DATA_TRACE 1
+#else
+	#define WITH_JSON_DATA_TRACE 0
+#endif
+
+#if WITH_JSON_DATA_TRACE
+	#include "Trace/Trace.h"
+
+UE_TRACE_CHANNEL_EXTERN(JsonDataChannel)
+
+namespace OUU::JsonData::Runtime::Private
+{
+	/**
+	 * Trace scope of a single json asset load.
+	 * Emits a timing scope named after the package path (so the load phases are nested below it in Timing Insights)
+	 * and a JsonData.AssetLoad event with the number of imported properties when the scope ends.
+	 * Opened once per load at its entry point (synchronous load, async load completion or bulk import). Loads of
+	 * referenced assets during the import open their own scope nested below it.
+	 */
+	class FJsonDataAssetLoadTraceScope
+	{
+	public:
+		explicit FJsonDataAssetLoadTraceScope(const FString& InPackagePath);
+		~FJsonDataAssetLoadTraceScope();
+		UE_NONCOPYABLE(FJsonDataAssetLoadTraceScope);
+
+		// Count imported top level properties for the innermost load scope of the calling thread (if any).
+		static void AddImportedProperties(int32 NumProperties);
+
+	private:
+		FString PackagePath;
+		uint64 StartCycle = 0;
+		int32 NumImportedProperties = 0;
+		bool bActive = false;
+		bool bEmittedTimingScope = false;
+		FJsonDataAssetLoadTraceScope* OuterScope = nullptr;
+	};
+
+	// Emit a JsonData.FileRead event with the number of bytes read from disk or a bundle. Thread-safe.
+	void TraceJsonFileRead(const FString& FilePath, int64 NumBytes);
+} // namespace OUU::JsonData::Runtime::Private
+
+	// Timing scope of a load phase, e.g. UE_JSON_DATA_TRACE_PHASE(Parse) -> "JsonData::Parse"
+	#define UE_JSON_DATA_TRACE_PHASE(Phase)                                                                            \
+		TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR("JsonData::" #Phase, JsonDataChannel)
+
+	#define UE_JSON_DATA_TRACE_ASSET_LOAD(PackagePath)                                                                 \
+		OUU::JsonData::Runtime::Private::FJsonDataAssetLoadTraceScope PREPROCESSOR_JOIN(                               \
+			JsonDataAssetLoadTraceScope_,                                                                              \
+			__LINE__)(PackagePath)
+
+	#define UE_JSON_DATA_TRACE_IMPORTED_PROPERTIES(NumProperties)                                                      \
+		OUU::JsonData::Runtime::Private::FJsonDataAssetLoadTraceScope::AddImportedProperties(NumProperties)
+
+	#define UE_JSON_DATA_TRACE_FILE_READ(FilePath, NumBytes)                                                           \
+		OUU::JsonData::Runtime::Private::TraceJsonFileRead(FilePath, NumBytes)
+#else
+	#define UE_JSON_DATA_TRACE_PHASE(Phase)
+	#define UE_JSON_DATA_TRACE_ASSET_LOAD(PackagePath)
+	#define UE_JSON_DATA_TRACE_IMPORTED_PROPERTIES(NumProperties)
+	#define UE_JSON_DATA_TRACE_FILE_READ(FilePath, NumBytes)
+#endif
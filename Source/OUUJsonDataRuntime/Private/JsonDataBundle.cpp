@@ -0,0 +1,355 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#include "JsonDataBundle.h"
+
+#include "Algo/BinarySearch.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/PlatformFileManager.h"
+#include "JsonDataCompactBinary.h"
+#include "LogJsonDataAsset.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeRWLock.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace OUU::JsonData::Runtime::Private
+{
+	namespace Bundle
+	{
+		// "OUJB"
+		constexpr uint32 FileMagic = 0x424A554F;
+		constexpr int32 FileVersion = 1;
+
+		const FString FileName = TEXT("JsonData.jsonbundle");
+
+		FRWLock MountedBundlesLock;
+		TArray<TSharedRef<FJsonDataBundle>> MountedBundles;
+
+		// Empty path (length only), format, offset and size
+		constexpr uint64 MinSerializedEntrySize = sizeof(int32) + sizeof(uint8) + 2 * sizeof(int64);
+
+		void SerializeEntry(FArchive& Ar, FJsonDataBundle::FEntry& Entry)
+		{
+			Ar << Entry.RelativePath;
+			Ar << Entry.Format;
+			Ar << Entry.Offset;
+			Ar << Entry.Size;
+		}
+	} // namespace Bundle
+
+	FJsonDataBundle::~FJsonDataBundle()
+	{
+		// Region must be released before the file handle
+		MappedFileRegion.Reset();
+		MappedFileHandle.Reset();
+	}
+
+	FString FJsonDataBundle::GetBundleFilePath(const FString& SourceRoot)
+	{
+		return NormalizeSourceRoot(SourceRoot) + Bundle::FileName;
+	}
+
+	bool FJsonDataBundle::Write(const FString& SourceRoot, const TArray<FString>& JsonFilePaths)
+	{
+		DECLARE_SCOPE_CYCLE_COUNTER(TEXT("FJsonDataBundle::Write"), STAT_WriteBundle, STATGROUP_OUUJsonData);
+
+		struct FPendingEntry
+		{
+			FEntry Entry;
+			TArray<uint8> Data;
+		};
+		TArray<FPendingEntry> PendingEntries;
+
+		const FString BundleFilePath = GetBundleFilePath(SourceRoot);
+		{
+			// Iterative cooks don't re-export all json files, so the previous bundle may contain the only copy.
+			FJsonDataBundle PreviousBundle;
+			PreviousBundle.SourceRoot = NormalizeSourceRoot(SourceRoot);
+			const bool bHasPreviousBundle =
+				FPaths::FileExists(BundleFilePath) && PreviousBundle.OpenFile(BundleFilePath);
+
+			for (const auto& JsonFilePath : JsonFilePaths)
+			{
+				FString RelativePath;
+				if (PreviousBundle.TryMakeRelativePath(JsonFilePath, OUT RelativePath) == false)
+				{
+					// File belongs to a different source root
+					continue;
+				}
+
+				auto& PendingEntry = PendingEntries.AddDefaulted_GetRef();
+				PendingEntry.Entry.RelativePath = RelativePath;
+
+				const FString LooseFilePath = PreviousBundle.SourceRoot + RelativePath;
+				TArray<uint8> CompactBinaryBuffer;
+				const FMemoryView CompactBinaryView =
+					LoadUpToDateCompactBinaryFile(LooseFilePath, OUT CompactBinaryBuffer);
+				if (CompactBinaryView.IsEmpty() == false)
+				{
+					// Bundles replace the loose files, so the entries don't need the file header.
+					PendingEntry.Entry.Format = EJsonDataBundleEntryFormat::CompactBinary;
+					PendingEntry.Data.Append(
+						static_cast<const uint8*>(CompactBinaryView.GetData()),
+						CompactBinaryView.GetSize());
+				}
+				else if (FFileHelper::LoadFileToArray(OUT PendingEntry.Data, *LooseFilePath, FILEREAD_Silent))
+				{
+					PendingEntry.Entry.Format = EJsonDataBundleEntryFormat::Json;
+				}
+				else if (
+					const auto* PreviousEntry = bHasPreviousBundle ? PreviousBundle.FindEntry(RelativePath) : nullptr)
+				{
+					const auto PreviousData = PreviousBundle.GetEntryData(*PreviousEntry);
+					PendingEntry.Entry.Format = PreviousEntry->Format;
+					PendingEntry.Data.Append(static_cast<const uint8*>(PreviousData.GetData()), PreviousData.GetSize());
+				}
+				else
+				{
+					UE_LOG(LogJsonDataAsset, Warning, TEXT("Json file %s is missing from bundle"), *LooseFilePath);
+					PendingEntries.Pop();
+				}
+			}
+			// Previous bundle is closed here, so the file can be overwritten.
+		}
+
+		if (PendingEntries.Num() == 0)
+		{
+			FPlatformFileManager::Get().GetPlatformFile().DeleteFile(*BundleFilePath);
+			return true;
+		}
+
+		PendingEntries.Sort([](const FPendingEntry& A, const FPendingEntry& B) -> bool {
+			return A.Entry.RelativePath < B.Entry.RelativePath;
+		});
+
+		int64 Offset = 0;
+		for (auto& PendingEntry : PendingEntries)
+		{
+			PendingEntry.Entry.Offset = Offset;
+			PendingEntry.Entry.Size = PendingEntry.Data.Num();
+			Offset += PendingEntry.Entry.Size;
+		}
+
+		TArray<uint8> BundleData;
+		FMemoryWriter Writer(BundleData, true);
+		uint32 Magic = Bundle::FileMagic;
+		int32 Version = Bundle::FileVersion;
+		int32 NumEntries = PendingEntries.Num();
+		Writer << Magic << Version << NumEntries;
+		for (auto& PendingEntry : PendingEntries)
+		{
+			Bundle::SerializeEntry(Writer, PendingEntry.Entry);
+		}
+		for (const auto& PendingEntry : PendingEntries)
+		{
+			Writer.Serialize(const_cast<uint8*>(PendingEntry.Data.GetData()), PendingEntry.Data.Num());
+		}
+
+		if (FFileHelper::SaveArrayToFile(BundleData, *BundleFilePath) == false)
+		{
+			UE_LOG(LogJsonDataAsset, Error, TEXT("Failed to save json data bundle %s"), *BundleFilePath);
+			return false;
+		}
+
+		// Loose files would override the bundle entries at runtime.
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+		const FString NormalizedSourceRoot = NormalizeSourceRoot(SourceRoot);
+		for (const auto& PendingEntry : PendingEntries)
+		{
+			const FString LooseFilePath = NormalizedSourceRoot + PendingEntry.Entry.RelativePath;
+			PlatformFile.DeleteFile(*LooseFilePath);
+			PlatformFile.DeleteFile(*GetCompactBinaryFilePath(LooseFilePath));
+		}
+
+		UE_LOG(
+			LogJsonDataAsset,
+			Display,
+			TEXT("Saved json data bundle %s with %i entries (%lld bytes)"),
+			*BundleFilePath,
+			PendingEntries.Num(),
+			static_cast<int64>(BundleData.Num()));
+		return true;
+	}
+
+	TSharedPtr<FJsonDataBundle> FJsonDataBundle::Open(const FString& SourceRoot)
+	{
+		check(IsInGameThread());
+
+		const FString BundleFilePath = GetBundleFilePath(SourceRoot);
+		if (FPaths::FileExists(BundleFilePath) == false)
+		{
+			return nullptr;
+		}
+
+		auto NewBundle = MakeShared<FJsonDataBundle>();
+		NewBundle->SourceRoot = NormalizeSourceRoot(SourceRoot);
+		if (NewBundle->OpenFile(BundleFilePath) == false)
+		{
+			return nullptr;
+		}
+		return NewBundle;
+	}
+
+	void FJsonDataBundle::Mount(const TSharedRef<FJsonDataBundle>& InBundle)
+	{
+		check(IsInGameThread());
+		check(InBundle->bMounted == false);
+
+		InBundle->bMounted = true;
+		UE_LOG(
+			LogJsonDataAsset,
+			Log,
+			TEXT("Mounted json data bundle %s with %i entries"),
+			*GetBundleFilePath(InBundle->SourceRoot),
+			InBundle->Entries.Num());
+
+		FWriteScopeLock WriteLock(Bundle::MountedBundlesLock);
+		Bundle::MountedBundles.Add(InBundle);
+	}
+
+	void FJsonDataBundle::UnmountAll()
+	{
+		check(IsInGameThread());
+
+		FWriteScopeLock WriteLock(Bundle::MountedBundlesLock);
+		Bundle::MountedBundles.Empty();
+	}
+
+	TSharedPtr<const FJsonDataBundle> FJsonDataBundle::FindForFile(const FString& JsonFilePath)
+	{
+		FReadScopeLock ReadLock(Bundle::MountedBundlesLock);
+		for (const auto& MountedBundle : Bundle::MountedBundles)
+		{
+			if (JsonFilePath.StartsWith(MountedBundle->SourceRoot))
+			{
+				return MountedBundle;
+			}
+		}
+		return nullptr;
+	}
+
+	bool FJsonDataBundle::TryMakeRelativePath(const FString& JsonFilePath, FString& OutRelativePath) const
+	{
+		const FString FullPath = FPaths::ConvertRelativePathToFull(JsonFilePath);
+		if (FullPath.StartsWith(SourceRoot) == false)
+		{
+			return false;
+		}
+		OutRelativePath = FullPath.RightChop(SourceRoot.Len());
+		return true;
+	}
+
+	const FJsonDataBundle::FEntry* FJsonDataBundle::FindEntry(const FString& RelativePath) const
+	{
+		const int32 Index = Algo::BinarySearchBy(Entries, RelativePath, &FEntry::RelativePath);
+		return Entries.IsValidIndex(Index) ? &Entries[Index] : nullptr;
+	}
+
+	FMemoryView FJsonDataBundle::GetEntryData(const FEntry& Entry) const
+	{
+		return DataSection.Mid(Entry.Offset, Entry.Size);
+	}
+
+	void FJsonDataBundle::MarkOverriddenByLooseFile(const FString& RelativePath)
+	{
+		check(bMounted == false);
+
+		const int32 Index = Algo::BinarySearchBy(Entries, RelativePath, &FEntry::RelativePath);
+		if (Entries.IsValidIndex(Index))
+		{
+			Entries[Index].bOverriddenByLooseFile = true;
+		}
+	}
+
+	FString FJsonDataBundle::NormalizeSourceRoot(const FString& SourceRoot)
+	{
+		FString Result = FPaths::ConvertRelativePathToFull(SourceRoot);
+		if (Result.EndsWith(TEXT("/")) == false)
+		{
+			Result += TEXT("/");
+		}
+		return Result;
+	}
+
+	bool FJsonDataBundle::OpenFile(const FString& BundleFilePath)
+	{
+		DECLARE_SCOPE_CYCLE_COUNTER(TEXT("FJsonDataBundle::Open"), STAT_OpenBundle, STATGROUP_OUUJsonData);
+
+		FMemoryView FileView;
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+		MappedFileHandle.Reset(PlatformFile.OpenMapped(*BundleFilePath));
+		if (MappedFileHandle.IsValid())
+		{
+			MappedFileRegion.Reset(MappedFileHandle->MapRegion());
+		}
+
+		if (MappedFileRegion.IsValid())
+		{
+			FileView = MakeMemoryView(MappedFileRegion->GetMappedPtr(), MappedFileRegion->GetMappedSize());
+		}
+		else
+		{
+			// Memory mapping is not supported by all platform files (e.g. some pak file configurations).
+			MappedFileHandle.Reset();
+			if (FFileHelper::LoadFileToArray(OUT LoadedFileData, *BundleFilePath) == false)
+			{
+				UE_LOG(LogJsonDataAsset, Error, TEXT("Failed to load json data bundle %s"), *BundleFilePath);
+				return false;
+			}
+			FileView = MakeMemoryView(LoadedFileData);
+		}
+
+		FMemoryReaderView Reader(FileView);
+		uint32 Magic = 0;
+		int32 Version = 0;
+		int32 NumEntries = 0;
+		Reader << Magic << Version << NumEntries;
+		if (Reader.IsError() || Magic != Bundle::FileMagic || Version != Bundle::FileVersion || NumEntries < 0)
+		{
+			UE_LOG(LogJsonDataAsset, Error, TEXT("Json data bundle %s has an invalid header"), *BundleFilePath);
+			return false;
+		}
+
+		// Don't trust the entry count of a corrupt file with the allocation size.
+		const uint64 IndexAndDataSize = FileView.GetSize() - static_cast<uint64>(Reader.Tell());
+		if (static_cast<uint64>(NumEntries) * Bundle::MinSerializedEntrySize > IndexAndDataSize)
+		{
+			UE_LOG(
+				LogJsonDataAsset,
+				Error,
+				TEXT("Json data bundle %s has more entries (%i) than fit into the file"),
+				*BundleFilePath,
+				NumEntries);
+			return false;
+		}
+
+		Entries.SetNum(NumEntries);
+		for (auto& Entry : Entries)
+		{
+			Bundle::SerializeEntry(Reader, Entry);
+		}
+		if (Reader.IsError())
+		{
+			UE_LOG(LogJsonDataAsset, Error, TEXT("Json data bundle %s has an invalid index"), *BundleFilePath);
+			return false;
+		}
+
+		DataSection = FileView.RightChop(Reader.Tell());
+		for (const auto& Entry : Entries)
+		{
+			if (Entry.Offset < 0 || Entry.Size < 0
+				|| static_cast<uint64>(Entry.Offset + Entry.Size) > DataSection.GetSize())
+			{
+				UE_LOG(
+					LogJsonDataAsset,
+					Error,
+					TEXT("Json data bundle %s has an out of bounds entry (%s)"),
+					*BundleFilePath,
+					*Entry.RelativePath);
+				return false;
+			}
+		}
+		return true;
+	}
+} // namespace OUU::JsonData::Runtime::Private
@@ -0,0 +1,91 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Memory/MemoryView.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+// Packed bundle of all cooked json files of a source root.
+// Written at the end of the json data cook (if enabled via ouu.JsonData.CookBundle) and memory mapped at runtime, so
+// cooked builds don't have to open thousands of small files. Loose json files next to the bundle override the bundled
+// entries, so modding keeps working.
+// Not in Public/ folder, because they should only be used directly by the system internal code.
+namespace OUU::JsonData::Runtime::Private
+{
+	enum class EJsonDataBundleEntryFormat : uint8
+	{
+		Json,
+		CompactBinary
+	};
+
+	class FJsonDataBundle
+	{
+	public:
+		struct FEntry
+		{
+			// Path relative to the source root, including the .json extension
+			FString RelativePath;
+			EJsonDataBundleEntryFormat Format = EJsonDataBundleEntryFormat::Json;
+			// Offset relative to the start of the data section
+			int64 Offset = 0;
+			int64 Size = 0;
+			bool bOverriddenByLooseFile = false;
+		};
+
+		~FJsonDataBundle();
+
+		static FString GetBundleFilePath(const FString& SourceRoot);
+
+		/**
+		 * Pack the cooked json files that are located in the source root into its bundle file and delete the loose
+		 * files afterwards. Files that were already packed by a previous cook are taken from the previous bundle.
+		 */
+		static bool Write(const FString& SourceRoot, const TArray<FString>& JsonFilePaths);
+
+		/**
+		 * Open the bundle of a source root, if there is one. The bundle is not visible to loads until it's mounted,
+		 * so loose files can be flagged without synchronization. Game thread only.
+		 */
+		static TSharedPtr<FJsonDataBundle> Open(const FString& SourceRoot);
+		// Make an opened bundle visible to loads. Mounted bundles are immutable. Game thread only.
+		static void Mount(const TSharedRef<FJsonDataBundle>& InBundle);
+		static void UnmountAll();
+
+		// Find the mounted bundle that contains the source root of a json file. Thread-safe.
+		static TSharedPtr<const FJsonDataBundle> FindForFile(const FString& JsonFilePath);
+
+		const FString& GetSourceRoot() const { return SourceRoot; }
+		const TArray<FEntry>& GetEntries() const { return Entries; }
+
+		bool TryMakeRelativePath(const FString& JsonFilePath, FString& OutRelativePath) const;
+
+		const FEntry* FindEntry(const FString& RelativePath) const;
+		FMemoryView GetEntryData(const FEntry& Entry) const;
+
+		// Loose files must be flagged before the bundle is mounted, because loads read the flags without locking.
+		void MarkOverriddenByLooseFile(const FString& RelativePath);
+
+	private:
+		// Full path with trailing slash
+		FString SourceRoot;
+
+		// Entries sorted by relative path
+		TArray<FEntry> Entries;
+
+		// Bundle file contents. Either memory mapped or (if mapping is not supported) loaded into memory.
+		TUniquePtr<IMappedFileHandle> MappedFileHandle;
+		TUniquePtr<IMappedFileRegion> MappedFileRegion;
+		TArray<uint8> LoadedFileData;
+		FMemoryView DataSection;
+
+		bool bMounted = false;
+
+		static FString NormalizeSourceRoot(const FString& SourceRoot);
+
+		bool OpenFile(const FString& BundleFilePath);
+	};
+} // namespace OUU::JsonData::Runtime::Private
@@ -0,0 +1,274 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#include "JsonDataCompactBinary.h"
+
+#include "HAL/PlatformFileManager.h"
+#include "IPlatformFilePak.h"
+#include "JsonDataAssetConsoleVariables.h"
+#include "LogJsonDataAsset.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+#include "Serialization/CompactBinary.h"
+#include "Serialization/CompactBinaryValidation.h"
+#include "Serialization/CompactBinaryWriter.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace OUU::JsonData::Runtime::Private
+{
+	namespace CompactBinary
+	{
+		// Header in front of the compact binary object that identifies the json file it was created from.
+		struct FFileHeader
+		{
+			static constexpr uint32 ExpectedMagic = 0x4243534A; // "JSCB"
+			// Increment when the header layout changes. Files with other versions are ignored.
+			static constexpr uint32 ExpectedVersion = 1;
+
+			uint32 Magic = ExpectedMagic;
+			uint32 Version = ExpectedVersion;
+			int64 SourceSize = -1;
+			FDateTime SourceTimeStamp;
+			FMD5Hash SourceHash;
+
+			bool IsValid() const { return Magic == ExpectedMagic && Version == ExpectedVersion; }
+
+			friend FArchive& operator<<(FArchive& Ar, FFileHeader& Header)
+			{
+				Ar << Header.Magic << Header.Version;
+				if (Header.IsValid())
+				{
+					Ar << Header.SourceSize << Header.SourceTimeStamp << Header.SourceHash;
+				}
+				return Ar;
+			}
+		};
+
+		// Returns true if both files are mounted from the same pak file. False for loose files and without paks.
+		bool AreServedFromSamePakFile(const FString& FilePathA, const FString& FilePathB)
+		{
+			auto* PakPlatformFile = static_cast<FPakPlatformFile*>(
+				FPlatformFileManager::Get().FindPlatformFile(FPakPlatformFile::GetTypeName()));
+			if (PakPlatformFile == nullptr)
+				return false;
+
+			TRefCountPtr<FPakFile> PakFileA;
+			TRefCountPtr<FPakFile> PakFileB;
+			return PakPlatformFile->FindFileInPakFiles(*FilePathA, &PakFileA)
+				&& PakPlatformFile->FindFileInPakFiles(*FilePathB, &PakFileB) && PakFileA == PakFileB;
+		}
+
+		void WriteJsonValue(FCbWriter& Writer, const TSharedPtr<FJsonValue>& JsonValue);
+
+		void WriteName(FCbWriter& Writer, const FString& Name)
+		{
+			const auto Utf8Name = StringCast<UTF8CHAR>(*Name, Name.Len());
+			Writer.SetName(FUtf8StringView(Utf8Name.Get(), Utf8Name.Length()));
+		}
+
+		void WriteJsonObject(FCbWriter& Writer, const FJsonObject& JsonObject)
+		{
+			Writer.BeginObject();
+			for (const auto& Entry : JsonObject.Values)
+			{
+				WriteName(Writer, Entry.Key);
+				WriteJsonValue(Writer, Entry.Value);
+			}
+			Writer.EndObject();
+		}
+
+		void WriteJsonValue(FCbWriter& Writer, const TSharedPtr<FJsonValue>& JsonValue)
+		{
+			if (JsonValue.IsValid() == false)
+			{
+				Writer.AddNull();
+				return;
+			}
+
+			switch (JsonValue->Type)
+			{
+			case EJson::String:
+			{
+				const FString& StringValue = JsonValue->AsString();
+				const auto Utf8Value = StringCast<UTF8CHAR>(*StringValue, StringValue.Len());
+				Writer.AddString(FUtf8StringView(Utf8Value.Get(), Utf8Value.Length()));
+				break;
+			}
+			// The json importers read all numbers as double, so storing them as float is lossless.
+			// The writer automatically picks the smallest float representation that preserves the value.
+			case EJson::Number: Writer.AddFloat(JsonValue->AsNumber()); break;
+			case EJson::Boolean: Writer.AddBool(JsonValue->AsBool()); break;
+			case EJson::Array:
+			{
+				Writer.BeginArray();
+				for (const auto& Element : JsonValue->AsArray())
+				{
+					WriteJsonValue(Writer, Element);
+				}
+				Writer.EndArray();
+				break;
+			}
+			case EJson::Object: WriteJsonObject(Writer, *JsonValue->AsObject()); break;
+			default: Writer.AddNull(); break;
+			}
+		}
+
+		FString ToString(FUtf8StringView View) { return FString(View.Len(), View.GetData()); }
+
+		TSharedPtr<FJsonObject> ReadJsonObject(const FCbObjectView& Object);
+
+		TSharedPtr<FJsonValue> ReadJsonValue(const FCbFieldView& Field)
+		{
+			if (Field.IsObject())
+			{
+				return MakeShared<FJsonValueObject>(ReadJsonObject(Field.AsObjectView()));
+			}
+			if (Field.IsArray())
+			{
+				TArray<TSharedPtr<FJsonValue>> Elements;
+				const FCbArrayView ArrayView = Field.AsArrayView();
+				Elements.Reserve(ArrayView.Num());
+				for (const FCbFieldView Element : ArrayView)
+				{
+					Elements.Add(ReadJsonValue(Element));
+				}
+				return MakeShared<FJsonValueArray>(Elements);
+			}
+			if (Field.IsString())
+			{
+				return MakeShared<FJsonValueString>(ToString(Field.AsString()));
+			}
+			if (Field.IsFloat() || Field.IsInteger())
+			{
+				return MakeShared<FJsonValueNumber>(Field.AsDouble());
+			}
+			if (Field.IsBool())
+			{
+				return MakeShared<FJsonValueBoolean>(Field.AsBool());
+			}
+			return MakeShared<FJsonValueNull>();
+		}
+
+		TSharedPtr<FJsonObject> ReadJsonObject(const FCbObjectView& Object)
+		{
+			auto JsonObject = MakeShared<FJsonObject>();
+			for (const FCbFieldView Field : Object)
+			{
+				JsonObject->SetField(ToString(Field.GetName()), ReadJsonValue(Field));
+			}
+			return JsonObject;
+		}
+	} // namespace CompactBinary
+
+	FString GetCompactBinaryFilePath(const FString& JsonFilePath)
+	{
+		return FPaths::ChangeExtension(JsonFilePath, TEXT("jsoncb"));
+	}
+
+	void JsonObjectToCompactBinary(const FJsonObject& JsonObject, TArray<uint8>& OutBuffer)
+	{
+		FCbWriter Writer;
+		CompactBinary::WriteJsonObject(Writer, JsonObject);
+
+		OutBuffer.SetNumUninitialized(Writer.GetSaveSize());
+		Writer.Save(MakeMemoryView(OutBuffer));
+	}
+
+	TSharedPtr<FJsonObject> CompactBinaryToJsonObject(FMemoryView Buffer)
+	{
+		if (ValidateCompactBinary(Buffer, ECbValidateMode::Default) != ECbValidateError::None)
+		{
+			return nullptr;
+		}
+
+		const FCbFieldView RootField(Buffer.GetData());
+		if (RootField.IsObject() == false)
+		{
+			return nullptr;
+		}
+		return CompactBinary::ReadJsonObject(RootField.AsObjectView());
+	}
+
+	void UpdateCompactBinaryFile(const FJsonObject& JsonObject, const FString& JsonFilePath)
+	{
+		if (CVar_CookCompactBinary.GetValueOnAnyThread() == false)
+		{
+			// Remove binary files from previous cooks
+			DeleteCompactBinaryFile(JsonFilePath);
+			return;
+		}
+
+		const FString BinaryFilePath = GetCompactBinaryFilePath(JsonFilePath);
+		CompactBinary::FFileHeader Header;
+		const FFileStatData StatData = FPlatformFileManager::Get().GetPlatformFile().GetStatData(*JsonFilePath);
+		Header.SourceHash = FMD5Hash::HashFile(*JsonFilePath);
+		if (StatData.bIsValid == false || Header.SourceHash.IsValid() == false)
+		{
+			UE_LOG(LogJsonDataAsset, Error, TEXT("Failed to hash %s for compact binary file"), *JsonFilePath);
+			DeleteCompactBinaryFile(JsonFilePath);
+			return;
+		}
+		Header.SourceSize = StatData.FileSize;
+		Header.SourceTimeStamp = StatData.ModificationTime;
+
+		TArray<uint8> Buffer;
+		FMemoryWriter Writer(Buffer);
+		Writer << Header;
+
+		TArray<uint8> CompactBinaryBuffer;
+		JsonObjectToCompactBinary(JsonObject, OUT CompactBinaryBuffer);
+		Buffer.Append(CompactBinaryBuffer);
+		if (FFileHelper::SaveArrayToFile(Buffer, *BinaryFilePath) == false)
+		{
+			UE_LOG(LogJsonDataAsset, Error, TEXT("Failed to save compact binary file %s"), *BinaryFilePath);
+			return;
+		}
+		UE_LOG(LogJsonDataAsset, Verbose, TEXT("Saved compact binary file %s"), *BinaryFilePath);
+	}
+
+	void DeleteCompactBinaryFile(const FString& JsonFilePath)
+	{
+		FPlatformFileManager::Get().GetPlatformFile().DeleteFile(*GetCompactBinaryFilePath(JsonFilePath));
+	}
+
+	FMemoryView LoadUpToDateCompactBinaryFile(const FString& JsonFilePath, TArray<uint8>& OutBuffer)
+	{
+		const FString BinaryFilePath = GetCompactBinaryFilePath(JsonFilePath);
+		if (FFileHelper::LoadFileToArray(OUT OutBuffer, *BinaryFilePath, FILEREAD_Silent) == false)
+		{
+			return {};
+		}
+
+		CompactBinary::FFileHeader Header;
+		FMemoryReader Reader(OutBuffer);
+		Reader << Header;
+		if (Reader.IsError() || Header.IsValid() == false)
+		{
+			// Written by an older plugin version
+			return {};
+		}
+
+		// Staged by the same cook. Pak files don't keep the cook-time timestamps, so checking them would always hash
+		// the json file. Overrides are served from loose files or other paks and still get verified below.
+		if (CompactBinary::AreServedFromSamePakFile(JsonFilePath, BinaryFilePath))
+		{
+			return MakeMemoryView(OutBuffer).RightChop(static_cast<uint64>(Reader.Tell()));
+		}
+
+		// Without json file the binary file is the only copy of the data.
+		const FFileStatData StatData = FPlatformFileManager::Get().GetPlatformFile().GetStatData(*JsonFilePath);
+		if (StatData.bIsValid
+			&& (StatData.FileSize != Header.SourceSize || StatData.ModificationTime != Header.SourceTimeStamp))
+		{
+			// A different timestamp alone may come from copying the files, so only the content hash is conclusive.
+			if (StatData.FileSize != Header.SourceSize || FMD5Hash::HashFile(*JsonFilePath) != Header.SourceHash)
+			{
+				// Json file was modified after cook (e.g. by modders).
+				return {};
+			}
+		}
+
+		return MakeMemoryView(OutBuffer).RightChop(static_cast<uint64>(Reader.Tell()));
+	}
+} // namespace OUU::JsonData::Runtime::Private
@@ -0,0 +1,49 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Dom/JsonObject.h"
+#include "Memory/MemoryView.h"
+
+// Compact binary representation of cooked json files.
+// The binary files are written next to the cooked json files (if enabled via ouu.JsonData.CookCompactBinary) and
+// are preferred at runtime over the json files unless the content of the json file changed (e.g. because it was
+// modded).
+// The binary data is converted back into a json object, so it only saves the text parsing, not the json DOM
+// allocations. Importing straight from the binary data would need a third importer next to the DOM and streaming ones.
+// Not in Public/ folder, because they should only be used directly by the system internal code.
+namespace OUU::JsonData::Runtime::Private
+{
+	// Path of the compact binary file that belongs to a json file.
+	FString GetCompactBinaryFilePath(const FString& JsonFilePath);
+
+	// Convert a json object into a compact binary object.
+	// Exported for the specs in OUUJsonDataTests.
+	OUUJSONDATARUNTIME_API void JsonObjectToCompactBinary(const FJsonObject& JsonObject, TArray<uint8>& OutBuffer);
+
+	// Convert a compact binary object back into a json object. Returns nullptr if the buffer is not valid.
+	// Exported for the specs in OUUJsonDataTests.
+	OUUJSONDATARUNTIME_API TSharedPtr<FJsonObject> CompactBinaryToJsonObject(FMemoryView Buffer);
+
+	/**
+	 * Write (or delete) the compact binary file that belongs to a cooked json file depending on the cook settings.
+	 * Must be called after the json file was written, so the binary file is considered up to date.
+	 */
+	void UpdateCompactBinaryFile(const FJsonObject& JsonObject, const FString& JsonFilePath);
+
+	// Delete the compact binary file that belongs to a json file, so it doesn't go stale.
+	void DeleteCompactBinaryFile(const FString& JsonFilePath);
+
+	/**
+	 * Load the compact binary file that belongs to a json file, if it was created from the current content of the json
+	 * file. If both files are served from the same pak file, they were staged together and the binary file is trusted
+	 * without touching the json file. Otherwise (loose files, e.g. overrides by modders, or json files in another pak)
+	 * the binary file's header is verified: It stores size, timestamp and content hash of the json file at cook time.
+	 * The json file is only hashed if its timestamp differs (e.g. because copying touched the files), so neither
+	 * copied nor modded files are misjudged. Thread-safe.
+	 * @returns the compact binary object in OutBuffer or an empty view if there is no up to date binary file.
+	 */
+	FMemoryView LoadUpToDateCompactBinaryFile(const FString& JsonFilePath, TArray<uint8>& OutBuffer);
+} // namespace OUU::JsonData::Runtime::Private
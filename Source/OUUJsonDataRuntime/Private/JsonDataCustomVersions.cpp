@@ -94,3 +94,8 @@ FCustomVersionContainer FJsonDataCustomVersions::ToCustomVersionContainer() cons
 
 	return Result;
 }
+
+bool FJsonDataCustomVersions::Equals(const FJsonDataCustomVersions& Other) const
+{
+	return VersionsByGuid.OrderIndependentCompareEqual(Other.VersionsByGuid);
+}
@@ -0,0 +1,263 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#include "JsonDataImportManifest.h"
+
+#include "Dom/JsonObject.h"
+#include "HAL/PlatformFileManager.h"
+#include "JsonDataAsset.h"
+#include "JsonDataAssetGlobals.h"
+#include "LogJsonDataAsset.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace OUU::JsonData::Runtime::Private
+{
+	namespace ImportManifest
+	{
+		// Increment to discard all existing manifests after changes of the file format.
+		constexpr int32 FileVersion = 1;
+
+		namespace JsonProps
+		{
+			const FString Version = TEXT("Version");
+			const FString Entries = TEXT("Entries");
+			const FString ContentHash = TEXT("ContentHash");
+			const FString TimeStamp = TEXT("TimeStamp");
+			const FString Size = TEXT("Size");
+			const FString Class = TEXT("Class");
+			const FString EngineVersion = TEXT("EngineVersion");
+			const FString CustomVersions = TEXT("CustomVersions");
+		} // namespace JsonProps
+	}	  // namespace ImportManifest
+
+	FJsonDataImportManifest::FJsonDataImportManifest(const FName& InRootName) : RootName(InRootName) {}
+
+	FString FJsonDataImportManifest::GetFilePath(const FName& RootName)
+	{
+		// Next to (not inside) the cache mount point, so it's not mistaken for a cached asset.
+		return FPaths::Combine(
+			OUU::JsonData::Runtime::GetCacheDir_DiskFull(),
+			FString::Printf(TEXT("ImportManifest_%s.json"), *RootName.ToString()));
+	}
+
+	void FJsonDataImportManifest::Delete(const FName& RootName)
+	{
+		FPlatformFileManager::Get().GetPlatformFile().DeleteFile(*GetFilePath(RootName));
+	}
+
+	bool FJsonDataImportManifest::HashSourceFile(const FString& SourcePath, FEntry& OutEntry)
+	{
+		DECLARE_SCOPE_CYCLE_COUNTER(
+			TEXT("FJsonDataImportManifest::HashSourceFile"),
+			STAT_HashSourceFile,
+			STATGROUP_OUUJsonData);
+
+		const FFileStatData StatData = FPlatformFileManager::Get().GetPlatformFile().GetStatData(*SourcePath);
+		if (StatData.bIsValid == false)
+		{
+			return false;
+		}
+
+		OutEntry.ContentHash = FMD5Hash::HashFile(*SourcePath);
+		OutEntry.TimeStamp = StatData.ModificationTime;
+		OutEntry.Size = StatData.FileSize;
+		return OutEntry.ContentHash.IsValid();
+	}
+
+	bool FJsonDataImportManifest::SetSourceFileHash(
+		const FString& SourcePath,
+		const FFileStatData& StatDataBeforeRead,
+		const FMD5Hash& ContentHash,
+		FEntry& OutEntry)
+	{
+		if (StatDataBeforeRead.bIsValid == false || ContentHash.IsValid() == false)
+		{
+			return HashSourceFile(SourcePath, OUT OutEntry);
+		}
+
+		OutEntry.ContentHash = ContentHash;
+		OutEntry.TimeStamp = StatDataBeforeRead.ModificationTime;
+		OutEntry.Size = StatDataBeforeRead.FileSize;
+		return true;
+	}
+
+	bool FJsonDataImportManifest::IsSourceFileUnchanged(
+		const FEntry& Entry,
+		const FString& SourcePath,
+		FEntry& OutUpdatedEntry)
+	{
+		OutUpdatedEntry = Entry;
+
+		const FFileStatData StatData = FPlatformFileManager::Get().GetPlatformFile().GetStatData(*SourcePath);
+		if (StatData.bIsValid == false)
+		{
+			return false;
+		}
+
+		if (StatData.ModificationTime == Entry.TimeStamp && StatData.FileSize == Entry.Size)
+		{
+			return true;
+		}
+
+		// Time stamp was touched (e.g. by a branch switch), but the content may still be the same.
+		return HashSourceFile(SourcePath, OUT OutUpdatedEntry) && OutUpdatedEntry.ContentHash == Entry.ContentHash;
+	}
+
+	void FJsonDataImportManifest::SetCurrentClassVersions(UClass* Class, FEntry& OutEntry)
+	{
+		check(Class && Class->IsChildOf<UJsonDataAsset>());
+
+		const auto* CDO = Class->GetDefaultObject<UJsonDataAsset>();
+		FJsonDataCustomVersions CustomVersions(CDO->GetAdditionalRelevantCustomVersions());
+		CustomVersions.CollectVersions(Class, CDO);
+
+		OutEntry.ClassPath = Class->GetPathName();
+		OutEntry.EngineVersion = FEngineVersion::Current().ToString();
+		OutEntry.CustomVersions = CustomVersions;
+	}
+
+	bool FJsonDataImportManifest::IsImportedWithCurrentVersions(const FEntry& Entry)
+	{
+		check(IsInGameThread());
+
+		if (Entry.EngineVersion != FEngineVersion::Current().ToString())
+		{
+			return false;
+		}
+
+		const FEntry* CurrentVersions = CurrentVersionsByClassPath.Find(Entry.ClassPath);
+		if (CurrentVersions == nullptr)
+		{
+			FEntry NewCurrentVersions;
+			auto* Class = LoadObject<UClass>(nullptr, *Entry.ClassPath, nullptr, LOAD_NoWarn | LOAD_Quiet);
+			if (IsValid(Class) && Class->IsChildOf<UJsonDataAsset>())
+			{
+				SetCurrentClassVersions(Class, OUT NewCurrentVersions);
+			}
+			CurrentVersions = &CurrentVersionsByClassPath.Add(Entry.ClassPath, NewCurrentVersions);
+		}
+
+		// Class path is empty if the class could not be found (anymore)
+		return CurrentVersions->ClassPath == Entry.ClassPath
+			&& CurrentVersions->CustomVersions.Equals(Entry.CustomVersions);
+	}
+
+	void FJsonDataImportManifest::Load()
+	{
+		DECLARE_SCOPE_CYCLE_COUNTER(TEXT("FJsonDataImportManifest::Load"), STAT_LoadManifest, STATGROUP_OUUJsonData);
+
+		EntriesByPackagePath.Reset();
+
+		const FString FilePath = GetFilePath(RootName);
+		FString JsonString;
+		if (FPaths::FileExists(FilePath) == false || FFileHelper::LoadFileToString(OUT JsonString, *FilePath) == false)
+		{
+			return;
+		}
+
+		TSharedPtr<FJsonObject> JsonObject;
+		const TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(JsonString);
+		if (FJsonSerializer::Deserialize(JsonReader, OUT JsonObject) == false || JsonObject.IsValid() == false)
+		{
+			UE_LOG(LogJsonDataAsset, Warning, TEXT("Failed to parse json data import manifest %s"), *FilePath);
+			return;
+		}
+
+		int32 Version = INDEX_NONE;
+		if (JsonObject->TryGetNumberField(ImportManifest::JsonProps::Version, OUT Version) == false
+			|| Version != ImportManifest::FileVersion)
+		{
+			UE_LOG(LogJsonDataAsset, Log, TEXT("Discarding outdated json data import manifest %s"), *FilePath);
+			return;
+		}
+
+		const TSharedPtr<FJsonObject>* EntriesObject = nullptr;
+		if (JsonObject->TryGetObjectField(ImportManifest::JsonProps::Entries, OUT EntriesObject) == false)
+		{
+			return;
+		}
+
+		EntriesByPackagePath.Reserve((*EntriesObject)->Values.Num());
+		for (const auto& EntryField : (*EntriesObject)->Values)
+		{
+			const TSharedPtr<FJsonObject>* EntryObject = nullptr;
+			if (EntryField.Value->TryGetObject(OUT EntryObject) == false)
+			{
+				continue;
+			}
+
+			FEntry Entry;
+			int64 Ticks = 0;
+			LexFromString(Entry.ContentHash, *(*EntryObject)->GetStringField(ImportManifest::JsonProps::ContentHash));
+			LexFromString(Ticks, *(*EntryObject)->GetStringField(ImportManifest::JsonProps::TimeStamp));
+			Entry.TimeStamp = FDateTime(Ticks);
+			(*EntryObject)->TryGetNumberField(ImportManifest::JsonProps::Size, OUT Entry.Size);
+			Entry.ClassPath = (*EntryObject)->GetStringField(ImportManifest::JsonProps::Class);
+			Entry.EngineVersion = (*EntryObject)->GetStringField(ImportManifest::JsonProps::EngineVersion);
+
+			const TSharedPtr<FJsonObject>* CustomVersionsObject = nullptr;
+			if ((*EntryObject)->TryGetObjectField(ImportManifest::JsonProps::CustomVersions, OUT CustomVersionsObject))
+			{
+				Entry.CustomVersions.ReadFromJsonObject(*CustomVersionsObject);
+			}
+
+			if (Entry.ContentHash.IsValid())
+			{
+				EntriesByPackagePath.Add(EntryField.Key, MoveTemp(Entry));
+			}
+		}
+	}
+
+	void FJsonDataImportManifest::Save() const
+	{
+		DECLARE_SCOPE_CYCLE_COUNTER(TEXT("FJsonDataImportManifest::Save"), STAT_SaveManifest, STATGROUP_OUUJsonData);
+
+		auto EntriesObject = MakeShared<FJsonObject>();
+		for (const auto& Entry : EntriesByPackagePath)
+		{
+			auto EntryObject = MakeShared<FJsonObject>();
+			EntryObject->SetStringField(ImportManifest::JsonProps::ContentHash, LexToString(Entry.Value.ContentHash));
+			// Ticks exceed the precision of json numbers
+			EntryObject->SetStringField(
+				ImportManifest::JsonProps::TimeStamp,
+				LexToString(Entry.Value.TimeStamp.GetTicks()));
+			EntryObject->SetNumberField(ImportManifest::JsonProps::Size, Entry.Value.Size);
+			EntryObject->SetStringField(ImportManifest::JsonProps::Class, Entry.Value.ClassPath);
+			EntryObject->SetStringField(ImportManifest::JsonProps::EngineVersion, Entry.Value.EngineVersion);
+			EntryObject->SetObjectField(
+				ImportManifest::JsonProps::CustomVersions,
+				Entry.Value.CustomVersions.ToJsonObject());
+			EntriesObject->SetObjectField(Entry.Key, EntryObject);
+		}
+
+		auto JsonObject = MakeShared<FJsonObject>();
+		JsonObject->SetNumberField(ImportManifest::JsonProps::Version, ImportManifest::FileVersion);
+		JsonObject->SetObjectField(ImportManifest::JsonProps::Entries, EntriesObject);
+
+		FString JsonString;
+		const TSharedRef<TJsonWriter<>> JsonWriter = TJsonWriterFactory<>::Create(OUT & JsonString);
+		ensure(FJsonSerializer::Serialize(JsonObject, JsonWriter));
+
+		const FString FilePath = GetFilePath(RootName);
+		if (FFileHelper::SaveStringToFile(JsonString, *FilePath) == false)
+		{
+			UE_LOG(LogJsonDataAsset, Error, TEXT("Failed to save json data import manifest %s"), *FilePath);
+		}
+	}
+
+	FJsonDataImportManifest::FEntry* FJsonDataImportManifest::FindEntry(const FString& PackagePath)
+	{
+		return EntriesByPackagePath.Find(PackagePath);
+	}
+
+	void FJsonDataImportManifest::SetEntry(const FString& PackagePath, const FEntry& Entry)
+	{
+		EntriesByPackagePath.Add(PackagePath, Entry);
+	}
+
+	void FJsonDataImportManifest::RemoveEntry(const FString& PackagePath) { EntriesByPackagePath.Remove(PackagePath); }
+} // namespace OUU::JsonData::Runtime::Private
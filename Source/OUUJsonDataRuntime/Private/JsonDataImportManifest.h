@@ -0,0 +1,89 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "JsonDataCustomVersions.h"
+#include "Misc/SecureHash.h"
+
+// Content hash manifest of the json source files that were imported into the json data asset cache.
+// The editor decides whether cached uassets are up to date by comparing content hashes instead of time stamps,
+// because version control systems don't reliably touch time stamps (and branch switches touch all of them).
+// Not in Public/ folder, because they should only be used directly by the system internal code.
+namespace OUU::JsonData::Runtime::Private
+{
+	class FJsonDataImportManifest
+	{
+	public:
+		struct FEntry
+		{
+			FMD5Hash ContentHash;
+
+			// Time stamp and size of the source file when the hash was computed.
+			// Only used to skip re-hashing files that were not touched since then.
+			FDateTime TimeStamp;
+			int64 Size = 0;
+
+			// Class, engine version and class custom versions the cached asset was imported with.
+			FString ClassPath;
+			FString EngineVersion;
+			FJsonDataCustomVersions CustomVersions;
+		};
+
+		explicit FJsonDataImportManifest(const FName& InRootName);
+
+		static FString GetFilePath(const FName& RootName);
+
+		// Delete the manifest file, e.g. because the entire asset cache of the root was purged.
+		static void Delete(const FName& RootName);
+
+		/**
+		 * Compute the content hash of a source file and fill the file related fields of the entry. Thread-safe.
+		 * @returns false if the file could not be read.
+		 */
+		static bool HashSourceFile(const FString& SourcePath, FEntry& OutEntry);
+
+		/**
+		 * Fill the file related fields of the entry with the hash of a file that was already read (see
+		 * ReadAndParseJsonFile), so the file doesn't have to be read a second time. The stat data must be queried
+		 * before reading the file, so a file that changes in between is re-hashed by the next check.
+		 * Falls back to HashSourceFile if the hash or stat data are invalid. Thread-safe.
+		 * @returns false if the file could not be read.
+		 */
+		static bool SetSourceFileHash(
+			const FString& SourcePath,
+			const FFileStatData& StatDataBeforeRead,
+			const FMD5Hash& ContentHash,
+			FEntry& OutEntry);
+
+		/**
+		 * Check if the source file still has the content the entry was created from. Thread-safe.
+		 * Files with unchanged time stamp and size are not re-hashed. If the content is unchanged, OutUpdatedEntry
+		 * contains the entry with the current time stamp, so the next check can skip hashing again.
+		 */
+		static bool IsSourceFileUnchanged(const FEntry& Entry, const FString& SourcePath, FEntry& OutUpdatedEntry);
+
+		// Fill the class and version fields of the entry with the current versions of the class.
+		static void SetCurrentClassVersions(UClass* Class, FEntry& OutEntry);
+
+		// Check if the class and engine version of the entry still match the current binaries.
+		// The result per class is cached in the manifest, so it may only be called on the game thread.
+		bool IsImportedWithCurrentVersions(const FEntry& Entry);
+
+		void Load();
+		void Save() const;
+
+		// Entries are keyed by package path, so they are independent from the location of the project on disk.
+		FEntry* FindEntry(const FString& PackagePath);
+		void SetEntry(const FString& PackagePath, const FEntry& Entry);
+		void RemoveEntry(const FString& PackagePath);
+
+	private:
+		FName RootName;
+		TMap<FString, FEntry> EntriesByPackagePath;
+		// Current class and custom versions per class path. Class path is empty for classes that could not be loaded.
+		TMap<FString, FEntry> CurrentVersionsByClassPath;
+	};
+} // namespace OUU::JsonData::Runtime::Private
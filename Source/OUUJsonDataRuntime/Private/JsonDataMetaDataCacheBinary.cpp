@@ -0,0 +1,469 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#include "JsonDataMetaDataCacheBinary.h"
+
+#include "Algo/BinarySearch.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/PlatformFileManager.h"
+#include "JsonDataAssetSubsystem.h"
+#include "LogJsonDataAsset.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace OUU::JsonData::Runtime::Private
+{
+	namespace MetaDataCacheBinary
+	{
+		// "OUMC"
+		constexpr uint32 FileMagic = 0x434D554F;
+		// 2: Searchable tags
+		// 3: Json-to-json dependencies
+		constexpr int32 FileVersion = 3;
+
+		template <typename T>
+		void AppendPod(TArray<uint8>& Buffer, const T& Value)
+		{
+			Buffer.Append(reinterpret_cast<const uint8*>(&Value), sizeof(T));
+		}
+
+		template <typename T>
+		void AppendPodArray(TArray<uint8>& Buffer, const TArray<T>& Values)
+		{
+			Buffer.Append(reinterpret_cast<const uint8*>(Values.GetData()), Values.Num() * sizeof(T));
+		}
+
+		// Slice a table with Num elements from the start of the view.
+		template <typename T>
+		bool ReadPodArray(FMemoryView& View, int32 Num, TConstArrayView<T>& OutValues)
+		{
+			const uint64 Size = static_cast<uint64>(Num) * sizeof(T);
+			if (Num < 0 || View.GetSize() < Size)
+			{
+				return false;
+			}
+			OutValues = MakeArrayView(static_cast<const T*>(View.GetData()), Num);
+			View += Size;
+			return true;
+		}
+
+		bool PathStringLess(FUtf8StringView A, FUtf8StringView B)
+		{
+			// Package names are case-insensitive
+			return A.Compare(B, ESearchCase::IgnoreCase) < 0;
+		}
+
+		FString GetPathString(const FJsonDataAssetPath& Path)
+		{
+			return Path.GetPackagePath() + TEXT(".") + Path.GetAssetName();
+		}
+	} // namespace MetaDataCacheBinary
+
+	FJsonDataMetaDataCacheBinary::~FJsonDataMetaDataCacheBinary()
+	{
+		// Region must be released before the file handle
+		MappedFileRegion.Reset();
+		MappedFileHandle.Reset();
+	}
+
+	FString FJsonDataMetaDataCacheBinary::GetFilePath(const FString& JsonFilePath)
+	{
+		return FPaths::ChangeExtension(JsonFilePath, TEXT("bin"));
+	}
+
+	bool FJsonDataMetaDataCacheBinary::Write(const FJsonDataAssetMetaDataCache& MetaDataCache, const FString& FilePath)
+	{
+		DECLARE_SCOPE_CYCLE_COUNTER(
+			TEXT("FJsonDataMetaDataCacheBinary::Write"),
+			STAT_WriteMetaDataCacheBinary,
+			STATGROUP_OUUJsonData);
+
+		TArray<uint8> StringPool;
+		const auto AddString = [&StringPool](const FString& String) -> FStringEntry {
+			const auto Utf8String = StringCast<UTF8CHAR>(*String, String.Len());
+			FStringEntry Entry;
+			Entry.Offset = StringPool.Num();
+			Entry.Length = Utf8String.Length();
+			StringPool.Append(reinterpret_cast<const uint8*>(Utf8String.Get()), Utf8String.Length());
+			return Entry;
+		};
+
+		// Tag keys are shared by most assets of a class, so they are only stored once.
+		TMap<FName, FStringEntry> TagKeyStrings;
+		const auto AddTagKey = [&](const FName& TagKey) -> FStringEntry {
+			if (const auto* ExistingEntry = TagKeyStrings.Find(TagKey))
+			{
+				return *ExistingEntry;
+			}
+			return TagKeyStrings.Add(TagKey, AddString(TagKey.ToString()));
+		};
+
+		// Sorted, so cooks with the same content produce the same file.
+		TArray<FTopLevelAssetPath> ClassPaths;
+		MetaDataCache.PathsByClass.GetKeys(OUT ClassPaths);
+		ClassPaths.Sort([](const FTopLevelAssetPath& A, const FTopLevelAssetPath& B) -> bool {
+			return A.ToString() < B.ToString();
+		});
+
+		// Path indices are needed for the dependencies before all paths are written.
+		TMap<FString, int32> PathIndicesByPackage;
+		for (const auto& ClassPath : ClassPaths)
+		{
+			for (const auto& AssetPath : MetaDataCache.PathsByClass[ClassPath].Paths)
+			{
+				PathIndicesByPackage.Add(AssetPath.GetPackagePath(), PathIndicesByPackage.Num());
+			}
+		}
+
+		TArray<FClassEntry> ClassEntries;
+		TArray<FStringEntry> PathEntries;
+		TArray<FIndexRange> PathTagRangeEntries;
+		TArray<FTagEntry> TagEntries;
+		TArray<FIndexRange> PathDependencyRangeEntries;
+		TArray<int32> DependencyEntries;
+		for (const auto& ClassPath : ClassPaths)
+		{
+			const auto& ClassAssets = MetaDataCache.PathsByClass[ClassPath];
+
+			auto& ClassEntry = ClassEntries.AddDefaulted_GetRef();
+			ClassEntry.ClassPath = AddString(ClassPath.ToString());
+			ClassEntry.FirstPath = PathEntries.Num();
+			ClassEntry.NumPaths = ClassAssets.Paths.Num();
+			for (int32 PathIndex = 0; PathIndex < ClassAssets.Paths.Num(); ++PathIndex)
+			{
+				const auto& AssetPath = ClassAssets.Paths[PathIndex];
+				PathEntries.Add(AddString(MetaDataCacheBinary::GetPathString(AssetPath)));
+
+				auto& TagRange = PathTagRangeEntries.AddDefaulted_GetRef();
+				TagRange.First = TagEntries.Num();
+				if (ClassAssets.SearchableTags.IsValidIndex(PathIndex))
+				{
+					for (const auto& Tag : ClassAssets.SearchableTags[PathIndex].Values)
+					{
+						auto& TagEntry = TagEntries.AddDefaulted_GetRef();
+						TagEntry.Key = AddTagKey(Tag.Key);
+						TagEntry.Value = AddString(Tag.Value);
+					}
+				}
+				TagRange.Num = TagEntries.Num() - TagRange.First;
+
+				auto& DependencyRange = PathDependencyRangeEntries.AddDefaulted_GetRef();
+				DependencyRange.First = DependencyEntries.Num();
+				if (ClassAssets.Dependencies.IsValidIndex(PathIndex))
+				{
+					for (const auto& DependencyPath : ClassAssets.Dependencies[PathIndex].Paths)
+					{
+						// Dependencies that were not cooked can't be prefetched anyway.
+						if (const int32* DependencyIndex = PathIndicesByPackage.Find(DependencyPath.GetPackagePath()))
+						{
+							DependencyEntries.Add(*DependencyIndex);
+						}
+					}
+				}
+				DependencyRange.Num = DependencyEntries.Num() - DependencyRange.First;
+			}
+		}
+
+		TArray<int32> SortedPathIndexEntries;
+		SortedPathIndexEntries.Reserve(PathEntries.Num());
+		for (int32 PathIndex = 0; PathIndex < PathEntries.Num(); ++PathIndex)
+		{
+			SortedPathIndexEntries.Add(PathIndex);
+		}
+		const auto GetPoolStringView = [&StringPool](const FStringEntry& Entry) -> FUtf8StringView {
+			const auto* Chars = reinterpret_cast<const UTF8CHAR*>(StringPool.GetData()) + Entry.Offset;
+			return FUtf8StringView(Chars, static_cast<int32>(Entry.Length));
+		};
+		SortedPathIndexEntries.Sort([&](const int32 A, const int32 B) -> bool {
+			return MetaDataCacheBinary::PathStringLess(
+				GetPoolStringView(PathEntries[A]),
+				GetPoolStringView(PathEntries[B]));
+		});
+
+		FHeader Header;
+		Header.Magic = MetaDataCacheBinary::FileMagic;
+		Header.Version = MetaDataCacheBinary::FileVersion;
+		Header.NumClasses = ClassEntries.Num();
+		Header.NumPaths = PathEntries.Num();
+		Header.NumTags = TagEntries.Num();
+		Header.NumDependencies = DependencyEntries.Num();
+		Header.StringPoolSize = StringPool.Num();
+
+		// All tables consist of 4 byte values and the string pool comes last, so everything stays aligned.
+		TArray<uint8> FileData;
+		MetaDataCacheBinary::AppendPod(FileData, Header);
+		MetaDataCacheBinary::AppendPodArray(FileData, ClassEntries);
+		MetaDataCacheBinary::AppendPodArray(FileData, PathEntries);
+		MetaDataCacheBinary::AppendPodArray(FileData, SortedPathIndexEntries);
+		MetaDataCacheBinary::AppendPodArray(FileData, PathTagRangeEntries);
+		MetaDataCacheBinary::AppendPodArray(FileData, TagEntries);
+		MetaDataCacheBinary::AppendPodArray(FileData, PathDependencyRangeEntries);
+		MetaDataCacheBinary::AppendPodArray(FileData, DependencyEntries);
+		FileData.Append(StringPool);
+
+		if (FFileHelper::SaveArrayToFile(FileData, *FilePath) == false)
+		{
+			UE_LOG(LogJsonDataAsset, Error, TEXT("Failed to save binary Json asset meta data cache to %s."), *FilePath);
+			return false;
+		}
+		return true;
+	}
+
+	bool FJsonDataMetaDataCacheBinary::Open(const FString& FilePath)
+	{
+		DECLARE_SCOPE_CYCLE_COUNTER(
+			TEXT("FJsonDataMetaDataCacheBinary::Open"),
+			STAT_OpenMetaDataCacheBinary,
+			STATGROUP_OUUJsonData);
+
+		if (FPaths::FileExists(FilePath) == false)
+		{
+			return false;
+		}
+
+		FMemoryView FileView;
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+		MappedFileHandle.Reset(PlatformFile.OpenMapped(*FilePath));
+		if (MappedFileHandle.IsValid())
+		{
+			MappedFileRegion.Reset(MappedFileHandle->MapRegion());
+		}
+
+		if (MappedFileRegion.IsValid())
+		{
+			FileView = MakeMemoryView(MappedFileRegion->GetMappedPtr(), MappedFileRegion->GetMappedSize());
+		}
+		else
+		{
+			// Memory mapping is not supported by all platform files (e.g. some pak file configurations).
+			MappedFileHandle.Reset();
+			if (FFileHelper::LoadFileToArray(OUT LoadedFileData, *FilePath) == false)
+			{
+				UE_LOG(LogJsonDataAsset, Error, TEXT("Failed to load binary Json asset meta data cache %s"), *FilePath);
+				return false;
+			}
+			FileView = MakeMemoryView(LoadedFileData);
+		}
+
+		FHeader Header;
+		if (FileView.GetSize() < sizeof(FHeader))
+		{
+			UE_LOG(LogJsonDataAsset, Error, TEXT("Binary Json asset meta data cache %s is truncated."), *FilePath);
+			return false;
+		}
+		FMemory::Memcpy(&Header, FileView.GetData(), sizeof(FHeader));
+		if (Header.Magic != MetaDataCacheBinary::FileMagic || Header.Version != MetaDataCacheBinary::FileVersion
+			|| Header.NumClasses < 0 || Header.NumPaths < 0 || Header.NumTags < 0 || Header.NumDependencies < 0)
+		{
+			UE_LOG(
+				LogJsonDataAsset,
+				Error,
+				TEXT("Binary Json asset meta data cache %s has an invalid header or outdated version."),
+				*FilePath);
+			return false;
+		}
+
+		FileView += sizeof(FHeader);
+		// All tables are sliced in file order. Whatever remains must be exactly the string pool.
+		if (MetaDataCacheBinary::ReadPodArray(FileView, Header.NumClasses, OUT Classes) == false
+			|| MetaDataCacheBinary::ReadPodArray(FileView, Header.NumPaths, OUT Paths) == false
+			|| MetaDataCacheBinary::ReadPodArray(FileView, Header.NumPaths, OUT SortedPathIndices) == false
+			|| MetaDataCacheBinary::ReadPodArray(FileView, Header.NumPaths, OUT PathTagRanges) == false
+			|| MetaDataCacheBinary::ReadPodArray(FileView, Header.NumTags, OUT Tags) == false
+			|| MetaDataCacheBinary::ReadPodArray(FileView, Header.NumPaths, OUT PathDependencyRanges) == false
+			|| MetaDataCacheBinary::ReadPodArray(FileView, Header.NumDependencies, OUT Dependencies) == false
+			|| FileView.GetSize() != Header.StringPoolSize)
+		{
+			UE_LOG(LogJsonDataAsset, Error, TEXT("Binary Json asset meta data cache %s is truncated."), *FilePath);
+			return false;
+		}
+		StringPool = FileView;
+
+		// Only the class table is validated and indexed here. Paths are validated when they are read.
+		ClassIndicesByPath.Reserve(Classes.Num());
+		for (int32 ClassIndex = 0; ClassIndex < Classes.Num(); ++ClassIndex)
+		{
+			const auto& ClassEntry = Classes[ClassIndex];
+			if (ClassEntry.FirstPath < 0 || ClassEntry.NumPaths < 0
+				|| static_cast<int64>(ClassEntry.FirstPath) + ClassEntry.NumPaths > Paths.Num()
+				|| IsValidString(ClassEntry.ClassPath) == false)
+			{
+				UE_LOG(
+					LogJsonDataAsset,
+					Error,
+					TEXT("Binary Json asset meta data cache %s has an out of bounds class entry."),
+					*FilePath);
+				ClassIndicesByPath.Empty();
+				return false;
+			}
+			ClassIndicesByPath.Add(FTopLevelAssetPath(GetString(ClassEntry.ClassPath)), ClassIndex);
+		}
+
+		UE_LOG(
+			LogJsonDataAsset,
+			Log,
+			TEXT("Opened binary Json asset meta data cache %s with %i classes and %i assets"),
+			*FilePath,
+			Classes.Num(),
+			Paths.Num());
+		return true;
+	}
+
+	void FJsonDataMetaDataCacheBinary::GetClassPaths(TArray<FTopLevelAssetPath>& OutClassPaths) const
+	{
+		ClassIndicesByPath.GetKeys(OUT OutClassPaths);
+	}
+
+	void FJsonDataMetaDataCacheBinary::AppendAssetPaths(
+		const FTopLevelAssetPath& ClassPath,
+		TArray<FJsonDataAssetPath>& OutPaths) const
+	{
+		const int32* ClassIndex = ClassIndicesByPath.Find(ClassPath);
+		if (ClassIndex == nullptr)
+		{
+			return;
+		}
+
+		const auto& ClassEntry = Classes[*ClassIndex];
+		OutPaths.Reserve(OutPaths.Num() + ClassEntry.NumPaths);
+		for (const auto& PathEntry : Paths.Slice(ClassEntry.FirstPath, ClassEntry.NumPaths))
+		{
+			if (IsValidString(PathEntry) == false)
+			{
+				UE_LOG(LogJsonDataAsset, Error, TEXT("Binary Json asset meta data cache has an out of bounds path."));
+				continue;
+			}
+			OutPaths.Add(FJsonDataAssetPath::FromObjectPath(GetString(PathEntry)));
+		}
+	}
+
+	void FJsonDataMetaDataCacheBinary::AppendAssetPathsByTag(
+		const FTopLevelAssetPath& ClassPath,
+		const FName& Tag,
+		TFunctionRef<bool(const FString& Value)> Predicate,
+		TArray<FJsonDataAssetPath>& OutPaths) const
+	{
+		const int32* ClassIndex = ClassIndicesByPath.Find(ClassPath);
+		if (ClassIndex == nullptr)
+		{
+			return;
+		}
+
+		const FString TagString = Tag.ToString();
+		const auto Utf8Tag = StringCast<UTF8CHAR>(*TagString, TagString.Len());
+		const FUtf8StringView TagView(Utf8Tag.Get(), Utf8Tag.Length());
+
+		const auto& ClassEntry = Classes[*ClassIndex];
+		const int32 EndPathIndex = ClassEntry.FirstPath + ClassEntry.NumPaths;
+		for (int32 PathIndex = ClassEntry.FirstPath; PathIndex < EndPathIndex; ++PathIndex)
+		{
+			const auto& TagRange = PathTagRanges[PathIndex];
+			if (IsValidRange(TagRange, Tags.Num()) == false)
+			{
+				UE_LOG(LogJsonDataAsset, Error, TEXT("Binary Json asset meta data cache has an out of bounds tag."));
+				continue;
+			}
+
+			for (const auto& TagEntry : Tags.Slice(TagRange.First, TagRange.Num))
+			{
+				if (IsValidString(TagEntry.Key) == false || IsValidString(TagEntry.Value) == false
+					|| GetStringView(TagEntry.Key).Equals(TagView, ESearchCase::IgnoreCase) == false)
+				{
+					continue;
+				}
+
+				// Only the matching assets pay for path construction.
+				if (Predicate(GetString(TagEntry.Value)) && IsValidString(Paths[PathIndex]))
+				{
+					OutPaths.Add(FJsonDataAssetPath::FromObjectPath(GetString(Paths[PathIndex])));
+				}
+				break;
+			}
+		}
+	}
+
+	bool FJsonDataMetaDataCacheBinary::GetDependencyClosure(
+		const FJsonDataAssetPath& RootPath,
+		TArray<FJsonDataAssetPath>& OutPaths) const
+	{
+		const int32 RootIndex = FindPathIndex(RootPath);
+		if (RootIndex == INDEX_NONE)
+		{
+			return false;
+		}
+
+		// Breadth first, so the direct dependencies of the root come first.
+		TBitArray<> VisitedPaths(false, Paths.Num());
+		TArray<int32, TInlineAllocator<64>> PathIndexQueue;
+		PathIndexQueue.Add(RootIndex);
+		VisitedPaths[RootIndex] = true;
+		for (int32 QueueIndex = 0; QueueIndex < PathIndexQueue.Num(); ++QueueIndex)
+		{
+			const int32 PathIndex = PathIndexQueue[QueueIndex];
+			if (IsValidString(Paths[PathIndex]))
+			{
+				OutPaths.Add(FJsonDataAssetPath::FromObjectPath(GetString(Paths[PathIndex])));
+			}
+
+			const auto& DependencyRange = PathDependencyRanges[PathIndex];
+			if (IsValidRange(DependencyRange, Dependencies.Num()) == false)
+			{
+				UE_LOG(
+					LogJsonDataAsset,
+					Error,
+					TEXT("Binary Json asset meta data cache has an out of bounds dependency."));
+				continue;
+			}
+
+			for (const int32 DependencyIndex : Dependencies.Slice(DependencyRange.First, DependencyRange.Num))
+			{
+				if (Paths.IsValidIndex(DependencyIndex) && VisitedPaths[DependencyIndex] == false)
+				{
+					VisitedPaths[DependencyIndex] = true;
+					PathIndexQueue.Add(DependencyIndex);
+				}
+			}
+		}
+		return true;
+	}
+
+	int32 FJsonDataMetaDataCacheBinary::FindPathIndex(const FJsonDataAssetPath& Path) const
+	{
+		const FString PathString = MetaDataCacheBinary::GetPathString(Path);
+		const auto Utf8Path = StringCast<UTF8CHAR>(*PathString, PathString.Len());
+		const FUtf8StringView PathView(Utf8Path.Get(), Utf8Path.Length());
+
+		// Corrupt entries project to empty strings. That breaks the search, but never reads out of bounds.
+		const int32 SortedIndex = Algo::BinarySearchBy(
+			SortedPathIndices,
+			PathView,
+			[this](const int32 PathIndex) -> FUtf8StringView {
+				return Paths.IsValidIndex(PathIndex) && IsValidString(Paths[PathIndex])
+					? GetStringView(Paths[PathIndex])
+					: FUtf8StringView();
+			},
+			&MetaDataCacheBinary::PathStringLess);
+		return SortedIndex == INDEX_NONE ? INDEX_NONE : SortedPathIndices[SortedIndex];
+	}
+
+	bool FJsonDataMetaDataCacheBinary::IsValidRange(const FIndexRange& Range, const int32 TableSize) const
+	{
+		return Range.First >= 0 && Range.Num >= 0 && static_cast<int64>(Range.First) + Range.Num <= TableSize;
+	}
+
+	bool FJsonDataMetaDataCacheBinary::IsValidString(const FStringEntry& Entry) const
+	{
+		return static_cast<uint64>(Entry.Offset) + Entry.Length <= StringPool.GetSize();
+	}
+
+	FUtf8StringView FJsonDataMetaDataCacheBinary::GetStringView(const FStringEntry& Entry) const
+	{
+		const auto* Chars = static_cast<const UTF8CHAR*>(StringPool.GetData()) + Entry.Offset;
+		return FUtf8StringView(Chars, static_cast<int32>(Entry.Length));
+	}
+
+	FString FJsonDataMetaDataCacheBinary::GetString(const FStringEntry& Entry) const
+	{
+		const FUtf8StringView View = GetStringView(Entry);
+		return FString(View.Len(), View.GetData());
+	}
+} // namespace OUU::JsonData::Runtime::Private
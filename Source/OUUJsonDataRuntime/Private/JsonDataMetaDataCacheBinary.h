@@ -0,0 +1,120 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "JsonDataAssetPath.h"
+#include "Memory/MemoryView.h"
+#include "UObject/TopLevelAssetPath.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+struct FJsonDataAssetMetaDataCache;
+
+// Binary representation of the json asset meta data cache.
+// Written by the cook next to JsonMetaDataCache.json and memory mapped at runtime. Only the class table is read when
+// the file is opened, the asset paths of a class are read from the mapped string pool when they are first queried,
+// so opening the file doesn't get slower with the number of json assets. Searchable tags and json-to-json dependencies
+// of the assets are stored per path and only read by the queries that need them.
+// Not in Public/ folder, because they should only be used directly by the system internal code.
+// Exported for the specs in OUUJsonDataTests.
+namespace OUU::JsonData::Runtime::Private
+{
+	class OUUJSONDATARUNTIME_API FJsonDataMetaDataCacheBinary
+	{
+	public:
+		~FJsonDataMetaDataCacheBinary();
+
+		// Path of the binary file that belongs to the json meta data cache file.
+		static FString GetFilePath(const FString& JsonFilePath);
+
+		static bool Write(const FJsonDataAssetMetaDataCache& MetaDataCache, const FString& FilePath);
+
+		bool Open(const FString& FilePath);
+
+		// All classes that have assets in the cache.
+		void GetClassPaths(TArray<FTopLevelAssetPath>& OutClassPaths) const;
+
+		// Append the paths of all assets of exactly the given class.
+		void AppendAssetPaths(const FTopLevelAssetPath& ClassPath, TArray<FJsonDataAssetPath>& OutPaths) const;
+
+		// Append the paths of all assets of exactly the given class that have a searchable tag matching the predicate.
+		void AppendAssetPathsByTag(
+			const FTopLevelAssetPath& ClassPath,
+			const FName& Tag,
+			TFunctionRef<bool(const FString& Value)> Predicate,
+			TArray<FJsonDataAssetPath>& OutPaths) const;
+
+		/**
+		 * Get the asset and all json data assets it references directly or indirectly.
+		 * @returns false if the asset is not in the cache.
+		 */
+		bool GetDependencyClosure(const FJsonDataAssetPath& RootPath, TArray<FJsonDataAssetPath>& OutPaths) const;
+
+	private:
+		struct FHeader
+		{
+			uint32 Magic = 0;
+			int32 Version = 0;
+			int32 NumClasses = 0;
+			int32 NumPaths = 0;
+			int32 NumTags = 0;
+			int32 NumDependencies = 0;
+			uint32 StringPoolSize = 0;
+		};
+
+		// Range in the string pool. Strings are UTF-8 and not null-terminated.
+		struct FStringEntry
+		{
+			uint32 Offset = 0;
+			uint32 Length = 0;
+		};
+
+		struct FClassEntry
+		{
+			FStringEntry ClassPath;
+			// Range in the path table
+			int32 FirstPath = 0;
+			int32 NumPaths = 0;
+		};
+
+		// Range in the tag or dependency table. One of each per path.
+		struct FIndexRange
+		{
+			int32 First = 0;
+			int32 Num = 0;
+		};
+
+		struct FTagEntry
+		{
+			FStringEntry Key;
+			FStringEntry Value;
+		};
+
+		// File contents. Either memory mapped or (if mapping is not supported) loaded into memory.
+		TUniquePtr<IMappedFileHandle> MappedFileHandle;
+		TUniquePtr<IMappedFileRegion> MappedFileRegion;
+		TArray<uint8> LoadedFileData;
+
+		TConstArrayView<FClassEntry> Classes;
+		TConstArrayView<FStringEntry> Paths;
+		// Path indices sorted by path string (case-insensitive), so paths can be found without building a map.
+		TConstArrayView<int32> SortedPathIndices;
+		TConstArrayView<FIndexRange> PathTagRanges;
+		TConstArrayView<FTagEntry> Tags;
+		TConstArrayView<FIndexRange> PathDependencyRanges;
+		// Path indices of the dependencies
+		TConstArrayView<int32> Dependencies;
+		FMemoryView StringPool;
+
+		TMap<FTopLevelAssetPath, int32> ClassIndicesByPath;
+
+		int32 FindPathIndex(const FJsonDataAssetPath& Path) const;
+
+		bool IsValidRange(const FIndexRange& Range, int32 TableSize) const;
+		bool IsValidString(const FStringEntry& Entry) const;
+		FUtf8StringView GetStringView(const FStringEntry& Entry) const;
+		FString GetString(const FStringEntry& Entry) const;
+	};
+} // namespace OUU::JsonData::Runtime::Private
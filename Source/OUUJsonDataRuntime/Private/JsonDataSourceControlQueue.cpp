@@ -0,0 +1,341 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#include "JsonDataSourceControlQueue.h"
+
+#include "HAL/FileManager.h"
+#include "LogJsonDataAsset.h"
+#include "Misc/Paths.h"
+
+#if WITH_EDITOR
+	#include "ISourceControlModule.h"
+	#include "ISourceControlProvider.h"
+	#include "SourceControlOperations.h"
+#endif
+
+namespace OUU::JsonData::Runtime::Private
+{
+#if WITH_EDITOR
+	namespace SourceControlQueue
+	{
+		// Returns nullptr if source control is disabled.
+		ISourceControlProvider* GetProvider()
+		{
+			// The source control module may already be unloaded during engine shutdown.
+			if (FModuleManager::Get().IsModuleLoaded(TEXT("SourceControl")) == false)
+				return nullptr;
+
+			auto& SourceControlModule = ISourceControlModule::Get();
+			return SourceControlModule.IsEnabled() ? &SourceControlModule.GetProvider() : nullptr;
+		}
+
+		void DeleteLocalFiles(const TArray<FString>& Files)
+		{
+			for (const auto& File : Files)
+			{
+				if (IFileManager::Get().Delete(*File, false, true) == false)
+				{
+					UE_LOG(LogJsonDataAsset, Error, TEXT("Failed to delete %s"), *File);
+				}
+			}
+		}
+
+		FSourceControlOperationComplete LogFailure(int32 NumFiles)
+		{
+			return FSourceControlOperationComplete::CreateLambda(
+				[NumFiles](const FSourceControlOperationRef& Operation, ECommandResult::Type Result) {
+					if (Result != ECommandResult::Succeeded)
+					{
+						UE_LOG(
+							LogJsonDataAsset,
+							Error,
+							TEXT("Source control operation %s failed for %i json files"),
+							*Operation->GetName().ToString(),
+							NumFiles);
+					}
+				});
+		}
+
+		// Submit the actual operations based on the (updated) source control states of the files.
+		void SubmitOperations(
+			ISourceControlProvider& Provider,
+			const TArray<FString>& CheckOutOrAddFiles,
+			const TArray<FString>& DeleteFiles,
+			EConcurrency::Type Concurrency)
+		{
+			TArray<FString> CheckOutFiles;
+			TArray<FString> AddFiles;
+			for (const auto& File : CheckOutOrAddFiles)
+			{
+				const auto State = Provider.GetState(File, EStateCacheUsage::Use);
+				if (State.IsValid() == false || State->IsCheckedOut() || State->IsAdded() || State->IsIgnored())
+					continue;
+
+				if (State->IsSourceControlled() == false)
+				{
+					AddFiles.Add(File);
+				}
+				else if (State->CanCheckout())
+				{
+					CheckOutFiles.Add(File);
+				}
+				else
+				{
+					UE_LOG(
+						LogJsonDataAsset,
+						Warning,
+						TEXT("Can't check out %s: %s"),
+						*File,
+						*State->GetDisplayTooltip().ToString());
+				}
+			}
+
+			// The local files were already deleted when they were queued.
+			TArray<FString> SourceControlDeleteFiles;
+			// Files opened for edit or add must be reverted before they can be deleted. Reverting may restore them.
+			TArray<FString> RevertThenDeleteFiles;
+			TArray<FString> RevertThenLocalDeleteFiles;
+			for (const auto& File : DeleteFiles)
+			{
+				const auto State = Provider.GetState(File, EStateCacheUsage::Use);
+				if (State.IsValid() == false || State->IsSourceControlled() == false)
+					continue;
+
+				if (State->IsAdded())
+				{
+					RevertThenLocalDeleteFiles.Add(File);
+				}
+				else if (State->IsCheckedOut())
+				{
+					RevertThenDeleteFiles.Add(File);
+				}
+				else if (State->IsDeleted() == false)
+				{
+					SourceControlDeleteFiles.Add(File);
+				}
+			}
+
+			if (CheckOutFiles.Num() > 0)
+			{
+				Provider.Execute(
+					ISourceControlOperation::Create<FCheckOut>(),
+					CheckOutFiles,
+					Concurrency,
+					LogFailure(CheckOutFiles.Num()));
+			}
+
+			if (AddFiles.Num() > 0)
+			{
+				Provider.Execute(
+					ISourceControlOperation::Create<FMarkForAdd>(),
+					AddFiles,
+					Concurrency,
+					LogFailure(AddFiles.Num()));
+			}
+
+			if (SourceControlDeleteFiles.Num() > 0)
+			{
+				Provider.Execute(
+					ISourceControlOperation::Create<FDelete>(),
+					SourceControlDeleteFiles,
+					Concurrency,
+					LogFailure(SourceControlDeleteFiles.Num()));
+			}
+
+			TArray<FString> RevertFiles = RevertThenDeleteFiles;
+			RevertFiles.Append(RevertThenLocalDeleteFiles);
+			if (RevertFiles.Num() > 0)
+			{
+				Provider.Execute(
+					ISourceControlOperation::Create<FRevert>(),
+					RevertFiles,
+					Concurrency,
+					FSourceControlOperationComplete::CreateLambda(
+						[RevertThenDeleteFiles, RevertThenLocalDeleteFiles, Concurrency](
+							const FSourceControlOperationRef& Operation,
+							ECommandResult::Type Result) {
+							LogFailure(RevertThenDeleteFiles.Num() + RevertThenLocalDeleteFiles.Num())
+								.ExecuteIfBound(Operation, Result);
+
+							DeleteLocalFiles(RevertThenLocalDeleteFiles);
+
+							auto* Provider = GetProvider();
+							if (Provider && RevertThenDeleteFiles.Num() > 0)
+							{
+								Provider->Execute(
+									ISourceControlOperation::Create<FDelete>(),
+									RevertThenDeleteFiles,
+									Concurrency,
+									LogFailure(RevertThenDeleteFiles.Num()));
+							}
+						}));
+			}
+		}
+	} // namespace SourceControlQueue
+#endif
+
+	FJsonDataSourceControlQueue& FJsonDataSourceControlQueue::Get()
+	{
+		static FJsonDataSourceControlQueue Instance;
+		return Instance;
+	}
+
+	void FJsonDataSourceControlQueue::Shutdown()
+	{
+		Flush(true);
+	}
+
+	void FJsonDataSourceControlQueue::BeginBatch()
+	{
+		check(IsInGameThread());
+		++BatchDepth;
+	}
+
+	void FJsonDataSourceControlQueue::EndBatch()
+	{
+		check(IsInGameThread());
+		if (ensure(BatchDepth > 0))
+		{
+			--BatchDepth;
+		}
+		ScheduleFlush();
+	}
+
+	void FJsonDataSourceControlQueue::QueueCheckOutOrAdd(const FString& FilePath)
+	{
+#if WITH_EDITOR
+		check(IsInGameThread());
+		const FString FullPath = FPaths::ConvertRelativePathToFull(FilePath);
+		PendingDeleteFiles.Remove(FullPath);
+		PendingCheckOutOrAddFiles.Add(FullPath);
+		ScheduleFlush();
+#endif
+	}
+
+	bool FJsonDataSourceControlQueue::CheckOutBeforeWrite(const FString& FilePath)
+	{
+#if WITH_EDITOR
+		check(IsInGameThread());
+		auto* Provider = SourceControlQueue::GetProvider();
+		if (Provider == nullptr)
+			return true;
+
+		const FString FullPath = FPaths::ConvertRelativePathToFull(FilePath);
+		// Queued states may be outdated, e.g. if the file was checked out or reverted outside of the editor.
+		const auto State = Provider->GetState(FullPath, EStateCacheUsage::ForceUpdate);
+		if (State.IsValid() == false || State->IsSourceControlled() == false || State->IsCheckedOut()
+			|| State->IsAdded() || State->IsIgnored())
+		{
+			return true;
+		}
+
+		if (State->CanCheckout() == false)
+		{
+			UE_LOG(
+				LogJsonDataAsset,
+				Warning,
+				TEXT("Can't check out %s: %s"),
+				*FullPath,
+				*State->GetDisplayTooltip().ToString());
+			return false;
+		}
+
+		PendingCheckOutOrAddFiles.Remove(FullPath);
+		const auto Result = Provider->Execute(
+			ISourceControlOperation::Create<FCheckOut>(),
+			TArray<FString>{FullPath},
+			EConcurrency::Synchronous,
+			SourceControlQueue::LogFailure(1));
+		return Result == ECommandResult::Succeeded;
+#else
+		return true;
+#endif
+	}
+
+	void FJsonDataSourceControlQueue::QueueDelete(const FString& FilePath)
+	{
+#if WITH_EDITOR
+		check(IsInGameThread());
+		const FString FullPath = FPaths::ConvertRelativePathToFull(FilePath);
+		PendingCheckOutOrAddFiles.Remove(FullPath);
+		// Don't leave the file on disk until the source control states are updated, so it can't be found by rescans
+		// or reimported in the meantime.
+		SourceControlQueue::DeleteLocalFiles({FullPath});
+		if (SourceControlQueue::GetProvider() == nullptr)
+			return;
+
+		PendingDeleteFiles.Add(FullPath);
+		ScheduleFlush();
+#endif
+	}
+
+	void FJsonDataSourceControlQueue::ScheduleFlush()
+	{
+		if (BatchDepth > 0)
+			return;
+
+		// Commandlets may not tick until they are done.
+		if (IsRunningCommandlet())
+		{
+			Flush(true);
+			return;
+		}
+
+		if (FlushTickerHandle.IsValid() == false)
+		{
+			FlushTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([this](float) {
+				FlushTickerHandle.Reset();
+				Flush(false);
+				return false;
+			}));
+		}
+	}
+
+	void FJsonDataSourceControlQueue::Flush(bool bSynchronous)
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(FlushTickerHandle);
+		FlushTickerHandle.Reset();
+
+#if WITH_EDITOR
+		if (PendingCheckOutOrAddFiles.Num() == 0 && PendingDeleteFiles.Num() == 0)
+			return;
+
+		TArray<FString> CheckOutOrAddFiles = PendingCheckOutOrAddFiles.Array();
+		TArray<FString> DeleteFiles = PendingDeleteFiles.Array();
+		PendingCheckOutOrAddFiles.Reset();
+		PendingDeleteFiles.Reset();
+
+		auto* Provider = SourceControlQueue::GetProvider();
+		if (Provider == nullptr)
+			return;
+
+		UE_LOG(
+			LogJsonDataAsset,
+			Verbose,
+			TEXT("Submitting source control operations for %i json files"),
+			CheckOutOrAddFiles.Num() + DeleteFiles.Num());
+
+		TArray<FString> AllFiles = CheckOutOrAddFiles;
+		AllFiles.Append(DeleteFiles);
+
+		const EConcurrency::Type Concurrency = bSynchronous ? EConcurrency::Synchronous : EConcurrency::Asynchronous;
+		Provider->Execute(
+			ISourceControlOperation::Create<FUpdateStatus>(),
+			AllFiles,
+			Concurrency,
+			FSourceControlOperationComplete::CreateLambda(
+				[CheckOutOrAddFiles, DeleteFiles, Concurrency](
+					const FSourceControlOperationRef& Operation,
+					ECommandResult::Type Result) {
+					auto* Provider = SourceControlQueue::GetProvider();
+					if (Provider == nullptr)
+						return;
+
+					// Continue with the cached states.
+					// Operations on files with outdated states report their own errors.
+					SourceControlQueue::LogFailure(CheckOutOrAddFiles.Num() + DeleteFiles.Num())
+						.ExecuteIfBound(Operation, Result);
+					SourceControlQueue::SubmitOperations(*Provider, CheckOutOrAddFiles, DeleteFiles, Concurrency);
+				}));
+#endif
+	}
+} // namespace OUU::JsonData::Runtime::Private
@@ -0,0 +1,56 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Containers/Ticker.h"
+
+// Not in Public/ folder, because they should only be used directly by the system internal code.
+namespace OUU::JsonData::Runtime::Private
+{
+	/**
+	 * Collects source control operations for json source files and submits them as asynchronous multi-file provider
+	 * operations, so bulk exports and deletes don't cause synchronous provider round trips per file.
+	 * Queued operations are submitted at the end of the frame or when the outermost batch ends
+	 * (see OUU::JsonData::Runtime::FScopedSourceControlBatch). Commandlets submit synchronously outside of batches.
+	 * Files queued for delete are deleted from disk right away, only their source control operations are deferred.
+	 * Source controlled files that are not checked out yet are checked out synchronously before they are written
+	 * (see CheckOutBeforeWrite).
+	 * Editor only. Does nothing in other builds.
+	 * Game thread only.
+	 */
+	class FJsonDataSourceControlQueue
+	{
+	public:
+		static FJsonDataSourceControlQueue& Get();
+
+		// Submit all pending operations synchronously. Called by the runtime module.
+		void Shutdown();
+
+		void BeginBatch();
+		void EndBatch();
+
+		// Check out the file if it's source controlled or mark it for add if it's a new file.
+		void QueueCheckOutOrAdd(const FString& FilePath);
+
+		/**
+		 * Synchronously check out a source controlled file that is about to be written, so it's never modified without
+		 * being checked out. Other files are not affected and must still be queued via QueueCheckOutOrAdd().
+		 * @returns false if the file is source controlled, but can't be checked out.
+		 */
+		bool CheckOutBeforeWrite(const FString& FilePath);
+
+		// Delete the file from disk and queue marking it for delete if it's source controlled.
+		void QueueDelete(const FString& FilePath);
+
+	private:
+		int32 BatchDepth = 0;
+		TSet<FString> PendingCheckOutOrAddFiles;
+		TSet<FString> PendingDeleteFiles;
+		FTSTicker::FDelegateHandle FlushTickerHandle;
+
+		void ScheduleFlush();
+		void Flush(bool bSynchronous);
+	};
+} // namespace OUU::JsonData::Runtime::Private
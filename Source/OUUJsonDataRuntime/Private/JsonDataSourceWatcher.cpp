@@ -0,0 +1,136 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#include "JsonDataSourceWatcher.h"
+
+#include "JsonDataAssetConsoleVariables.h"
+#include "LogJsonDataAsset.h"
+#include "Misc/Paths.h"
+
+#if WITH_JSON_DATA_SOURCE_WATCHER
+	#include "DirectoryWatcherModule.h"
+	#include "IDirectoryWatcher.h"
+#endif
+
+namespace OUU::JsonData::Runtime::Private
+{
+#if WITH_JSON_DATA_SOURCE_WATCHER
+	namespace SourceWatcher
+	{
+		IDirectoryWatcher* GetDirectoryWatcher()
+		{
+			auto& DirectoryWatcherModule =
+				FModuleManager::LoadModuleChecked<FDirectoryWatcherModule>(TEXT("DirectoryWatcher"));
+			return DirectoryWatcherModule.Get();
+		}
+	} // namespace SourceWatcher
+#endif
+
+	FJsonDataSourceWatcher::FJsonDataSourceWatcher(FOnFilesChanged InOnFilesChanged) :
+		OnFilesChanged(MoveTemp(InOnFilesChanged))
+	{
+#if WITH_JSON_DATA_SOURCE_WATCHER
+		if (IsEnabled())
+		{
+			TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+				FTickerDelegate::CreateRaw(this, &FJsonDataSourceWatcher::Tick));
+		}
+#endif
+	}
+
+	FJsonDataSourceWatcher::~FJsonDataSourceWatcher()
+	{
+#if WITH_JSON_DATA_SOURCE_WATCHER
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+
+		// The directory watcher module may already be unloaded during engine shutdown.
+		if (FModuleManager::Get().IsModuleLoaded(TEXT("DirectoryWatcher")))
+		{
+			if (auto* DirectoryWatcher = SourceWatcher::GetDirectoryWatcher())
+			{
+				for (const auto& Entry : WatchedDirectories)
+				{
+					DirectoryWatcher->UnregisterDirectoryChangedCallback_Handle(Entry.Key, Entry.Value);
+				}
+			}
+		}
+#endif
+	}
+
+	bool FJsonDataSourceWatcher::IsEnabled()
+	{
+#if WITH_JSON_DATA_SOURCE_WATCHER
+		// Commandlets (e.g. cooks) write json files themselves and never need to pick up external changes.
+		if (IsRunningCommandlet())
+			return false;
+
+		// Game builds may replicate json data asset paths by index, which the watcher can't change during a session
+		// (see UJsonDataAssetSubsystem::ApplyPathIndexChanges), so they have to opt in.
+		const int32 WatchSourceFiles = CVar_WatchSourceFiles.GetValueOnGameThread();
+		return WatchSourceFiles >= (GIsEditor ? 1 : 2);
+#else
+		return false;
+#endif
+	}
+
+	void FJsonDataSourceWatcher::WatchDirectory(const FString& Directory)
+	{
+#if WITH_JSON_DATA_SOURCE_WATCHER
+		if (IsEnabled() == false || WatchedDirectories.Contains(Directory))
+			return;
+
+		auto* DirectoryWatcher = SourceWatcher::GetDirectoryWatcher();
+		if (DirectoryWatcher == nullptr)
+			return;
+
+		FDelegateHandle Handle;
+		if (DirectoryWatcher->RegisterDirectoryChangedCallback_Handle(
+				Directory,
+				IDirectoryWatcher::FDirectoryChanged::CreateRaw(this, &FJsonDataSourceWatcher::HandleDirectoryChanged),
+				OUT Handle))
+		{
+			WatchedDirectories.Add(Directory, Handle);
+			UE_LOG(LogJsonDataAsset, Log, TEXT("Watching json source directory %s for changes"), *Directory);
+		}
+		else
+		{
+			UE_LOG(LogJsonDataAsset, Warning, TEXT("Failed to watch json source directory %s"), *Directory);
+		}
+#endif
+	}
+
+	void FJsonDataSourceWatcher::HandleDirectoryChanged(const TArray<FFileChangeData>& FileChanges)
+	{
+#if WITH_JSON_DATA_SOURCE_WATCHER
+		for (const auto& FileChange : FileChanges)
+		{
+			FString FilePath = FPaths::ConvertRelativePathToFull(FileChange.Filename);
+			FPaths::NormalizeFilename(FilePath);
+			PendingChangedFiles.Add(MoveTemp(FilePath));
+		}
+		LastChangeTime = FPlatformTime::Seconds();
+#endif
+	}
+
+	bool FJsonDataSourceWatcher::Tick(float DeltaTime)
+	{
+#if WITH_JSON_DATA_SOURCE_WATCHER
+		if (GIsEditor == false)
+		{
+			// Only the editor engine ticks the directory watcher.
+			if (auto* DirectoryWatcher = SourceWatcher::GetDirectoryWatcher())
+			{
+				DirectoryWatcher->Tick(DeltaTime);
+			}
+		}
+
+		if (PendingChangedFiles.Num() > 0
+			&& FPlatformTime::Seconds() - LastChangeTime >= CVar_SourceWatcherDebounce.GetValueOnGameThread())
+		{
+			const TArray<FString> ChangedFiles = PendingChangedFiles.Array();
+			PendingChangedFiles.Reset();
+			OnFilesChanged(ChangedFiles);
+		}
+#endif
+		return true;
+	}
+} // namespace OUU::JsonData::Runtime::Private
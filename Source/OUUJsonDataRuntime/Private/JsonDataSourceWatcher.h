@@ -0,0 +1,48 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Containers/Ticker.h"
+
+struct FFileChangeData;
+
+// Not in Public/ folder, because they should only be used directly by the system internal code.
+namespace OUU::JsonData::Runtime::Private
+{
+	/**
+	 * Watches json source directories for file changes (if enabled via ouu.JsonData.WatchSourceFiles).
+	 * Change notifications are collected until no new changes arrived for ouu.JsonData.SourceWatcherDebounce seconds
+	 * and then reported as one batch of changed files, so editors that save files in multiple steps (or tools that
+	 * change many files at once) only cause a single reimport.
+	 * Only available in builds with developer tools (editor and development builds). Does nothing in other builds.
+	 * Game thread only.
+	 */
+	class FJsonDataSourceWatcher
+	{
+	public:
+		// Receives the full paths of all files that were added, modified or removed.
+		using FOnFilesChanged = TFunction<void(const TArray<FString>& ChangedFiles)>;
+
+		explicit FJsonDataSourceWatcher(FOnFilesChanged InOnFilesChanged);
+		~FJsonDataSourceWatcher();
+
+		static bool IsEnabled();
+
+		// Watch a directory and all of its subdirectories. Directories may be watched before they exist.
+		void WatchDirectory(const FString& Directory);
+
+	private:
+		FOnFilesChanged OnFilesChanged;
+
+		TMap<FString, FDelegateHandle> WatchedDirectories;
+		FTSTicker::FDelegateHandle TickerHandle;
+
+		TSet<FString> PendingChangedFiles;
+		double LastChangeTime = 0.0;
+
+		void HandleDirectoryChanged(const TArray<FFileChangeData>& FileChanges);
+		bool Tick(float DeltaTime);
+	};
+} // namespace OUU::JsonData::Runtime::Private
@@ -4,19 +4,18 @@
 
 #include "GameplayTagContainer.h"
 #include "GameplayTagsManager.h"
+#include "JsonDataAssetConsoleVariables.h"
 #include "JsonDataCustomVersions.h"
+#include "JsonLibraryImportPlan.h"
 #include "JsonUtilities.h"
 #include "LogJsonDataAsset.h"
 #include "Misc/PackageName.h"
+#include "Misc/ScopeExit.h"
 #include "UObject/ObjectRedirector.h"
 #include "UObject/Package.h"
 #include "UObject/StructOnScope.h"
 #include "UObject/TextProperty.h"
 
-// GRIMLORE Start dlehn: Check property redirects in case the property has been renamed.
-#include "UObject/CoreRedirects.h"
-// GRIMLORE End
-
 /** Static switch for types: Select type based on Condition */
 template <bool Condition, typename TrueType, typename FalseType>
 struct TConditionalType;
@@ -154,7 +153,8 @@ struct FJsonLibraryExportHelper
 		{
 			// export enums as strings
 			UEnum* EnumDef = EnumProperty->GetEnum();
-			FString StringValue = EnumDef->GetAuthoredNameStringByValue(
+			FString StringValue = FJsonEnumNameCache::Get().GetAuthoredNameStringByValue(
+				EnumDef,
 				EnumProperty->GetUnderlyingProperty()->GetSignedIntPropertyValue(Value));
 			return FOUUPropertyJsonResult::Json(MakeShared<FJsonValueString>(StringValue));
 		}
@@ -165,8 +165,9 @@ struct FJsonLibraryExportHelper
 			if (EnumDef != nullptr)
 			{
 				// export enums as strings
-				FString StringValue =
-					EnumDef->GetAuthoredNameStringByValue(NumericProperty->GetSignedIntPropertyValue(Value));
+				FString StringValue = FJsonEnumNameCache::Get().GetAuthoredNameStringByValue(
+					EnumDef,
+					NumericProperty->GetSignedIntPropertyValue(Value));
 				return FOUUPropertyJsonResult::Json(MakeShared<FJsonValueString>(StringValue));
 			}
 
@@ -704,918 +705,2077 @@ struct FJsonLibraryExportHelper
 	}
 };
 
-struct FJsonLibraryImportHelper
+// Streaming counterpart of FJsonLibraryExportHelper for full exports.
+// Writes json tokens directly to a json writer while walking the properties instead of building a json DOM first.
+// Delta serialization (bOnlyModifiedProperties) is not supported, because skipping structs and sub-objects without
+// modified values would require knowing their contents before writing their start tokens.
+// Values are written in the same order and format as FJsonSerializer writes the DOM of FJsonLibraryExportHelper.
+struct FJsonLibraryStreamingExportHelper
 {
-	// clang-format off
-	bool JsonValueToFPropertyWithContainer(const TSharedPtr<FJsonValue>& JsonValue, FProperty* Property, void* OutValue, const UStruct* ContainerStruct, void* Container, const FArchive& VersionLoadingArchive, int64 CheckFlags, int64 SkipFlags, const bool bStrictMode, FText* OutFailReason);
-	bool JsonAttributesToUStructWithContainer(const TMap< FString, TSharedPtr<FJsonValue> >& JsonAttributes, const UStruct* StructDefinition, void* OutStruct, const UStruct* ContainerStruct, void* Container, const FArchive& VersionLoadingArchive, int64 CheckFlags, int64 SkipFlags, const bool bStrictMode, FText* OutFailReason);
-	// clang-format on
+	using FJsonWriter = TJsonWriter<UTF8CHAR>;
 
-	bool JsonValueToUProperty(
-		const TSharedPtr<FJsonValue>& JsonValue,
-		FProperty* Property,
-		void* OutValue,
-		const FArchive& VersionLoadingArchive,
-		int64 CheckFlags,
-		int64 SkipFlags,
-		const bool bStrictMode = false,
-		FText* OutFailReason = nullptr)
+	FJsonLibraryStreamingExportHelper(
+		FJsonWriter& InWriter,
+		int64 InCheckFlags,
+		int64 InSkipFlags,
+		const FOUUJsonLibraryObjectFilter& InSubObjectFilter) :
+		Writer(InWriter),
+		DefaultCheckFlags(InCheckFlags),
+		DefaultSkipFlags(InSkipFlags),
+		DomHelper(InCheckFlags, InSkipFlags, InSubObjectFilter, false)
 	{
-		return JsonValueToFPropertyWithContainer(
-			JsonValue,
-			Property,
-			OutValue,
-			nullptr,
-			nullptr,
-			VersionLoadingArchive,
-			CheckFlags,
-			SkipFlags,
-			bStrictMode,
-			OutFailReason);
 	}
 
-	bool JsonObjectToUStruct(
-		const TSharedRef<FJsonObject>& JsonObject,
-		const UStruct* StructDefinition,
-		void* OutStruct,
-		const FArchive& VersionLoadingArchive,
-		int64 CheckFlags,
-		int64 SkipFlags,
-		const bool bStrictMode = false,
-		FText* OutFailReason = nullptr)
+	FJsonWriter& Writer;
+
+	// Export all properties
+	int64 DefaultCheckFlags = 0;
+	// Don't skip any properties
+	int64 DefaultSkipFlags = 0;
+
+	// Used for map keys, which have to be converted to strings before their values can be written.
+	FJsonLibraryExportHelper DomHelper;
+
+	// All write functions take the identifier of the value: The field name for values inside of json objects or
+	// nullptr for array elements and root values.
+
+	void WriteObjectStart(const FString* Identifier)
 	{
-		return JsonAttributesToUStruct(
-			JsonObject->Values,
-			StructDefinition,
-			OutStruct,
-			VersionLoadingArchive,
-			CheckFlags,
-			SkipFlags,
-			bStrictMode,
-			OutFailReason);
+		if (Identifier)
+		{
+			Writer.WriteObjectStart(*Identifier);
+		}
+		else
+		{
+			Writer.WriteObjectStart();
+		}
 	}
 
-	bool JsonAttributesToUStruct(
-		const TMap<FString, TSharedPtr<FJsonValue>>& JsonAttributes,
-		const UStruct* StructDefinition,
-		void* OutStruct,
-		const FArchive& VersionLoadingArchive,
-		int64 CheckFlags,
-		int64 SkipFlags,
-		const bool bStrictMode = false,
-		FText* OutFailReason = nullptr)
+	void WriteArrayStart(const FString* Identifier)
 	{
-		return JsonAttributesToUStructWithContainer(
-			JsonAttributes,
-			StructDefinition,
-			OutStruct,
-			StructDefinition,
-			OutStruct,
-			VersionLoadingArchive,
-			CheckFlags,
-			SkipFlags,
-			bStrictMode,
-			OutFailReason);
+		if (Identifier)
+		{
+			Writer.WriteArrayStart(*Identifier);
+		}
+		else
+		{
+			Writer.WriteArrayStart();
+		}
 	}
 
-	/** Convert JSON to property, assuming either the property is not an array or the value is an individual array
-	 * element */
-	bool ConvertScalarJsonValueToFPropertyWithContainer(
-		const TSharedPtr<FJsonValue>& JsonValue,
-		FProperty* Property,
-		void* OutValue,
-		const UStruct* ContainerStruct,
-		void* Container,
-		const FArchive& VersionLoadingArchive,
-		int64 CheckFlags,
-		int64 SkipFlags,
-		const bool bStrictMode,
-		FText* OutFailReason)
+	template <typename ValueType>
+	void WriteValue(const FString* Identifier, const ValueType& Value)
 	{
-		DECLARE_CYCLE_STAT(
-			TEXT("ConvertScalarJsonValueToFPropertyWithContainer"),
-			STAT_ConvertScalarJsonValueToFPropertyWithContainer,
-			STATGROUP_OUUJsonData);
+		if (Identifier)
+		{
+			Writer.WriteValue(*Identifier, Value);
+		}
+		else
+		{
+			Writer.WriteValue(Value);
+		}
+	}
 
-		if (FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+	void WriteNull(const FString* Identifier)
+	{
+		if (Identifier)
 		{
-			if (JsonValue->Type == EJson::String)
-			{
-				// see if we were passed a string for the enum
-				const UEnum* Enum = EnumProperty->GetEnum();
-				check(Enum);
-				FString StrValue = JsonValue->AsString();
-				int64 IntValue = Enum->GetValueByName(FName(*StrValue), EGetByNameFlags::CheckAuthoredName);
-				if (IntValue == INDEX_NONE)
-				{
-					UE_LOG(
-						LogJsonDataAsset,
-						Error,
-						TEXT("JsonValueToUProperty - Unable to import enum %s from string value %s for property %s"),
-						*Enum->CppType,
-						*StrValue,
-						*Property->GetAuthoredName());
-					if (OutFailReason)
-					{
-						*OutFailReason = FText::Format(
-							INVTEXT("Unable to import enum {0} from string value {1} for property {2}"),
-							FText::FromString(Enum->CppType),
-							FText::FromString(StrValue),
-							FText::FromString(Property->GetAuthoredName()));
-					}
-					return false;
-				}
-				EnumProperty->GetUnderlyingProperty()->SetIntPropertyValue(OutValue, IntValue);
-			}
-			else
-			{
-				// AsNumber will log an error for completely inappropriate types (then give us a default)
-				EnumProperty->GetUnderlyingProperty()
-					->SetIntPropertyValue(OutValue, StaticCast<int64>(JsonValue->AsNumber()));
-			}
+			Writer.WriteNull(*Identifier);
 		}
-		else if (FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property))
+		else
 		{
-			if (NumericProperty->IsEnum() && JsonValue->Type == EJson::String)
-			{
-				// see if we were passed a string for the enum
-				const UEnum* Enum = NumericProperty->GetIntPropertyEnum();
-				check(Enum); // should be assured by IsEnum()
-				FString StrValue = JsonValue->AsString();
-				int64 IntValue = Enum->GetValueByName(FName(*StrValue), EGetByNameFlags::CheckAuthoredName);
-				if (IntValue == INDEX_NONE)
-				{
-					UE_LOG(
-						LogJsonDataAsset,
-						Error,
-						TEXT("JsonValueToUProperty - Unable to import enum %s from numeric value %s for property %s"),
-						*Enum->CppType,
-						*StrValue,
-						*Property->GetAuthoredName());
-					if (OutFailReason)
-					{
-						*OutFailReason = FText::Format(
-							INVTEXT("Unable to import enum {0} from numeric value {1} for property {2}"),
-							FText::FromString(Enum->CppType),
-							FText::FromString(StrValue),
-							FText::FromString(Property->GetAuthoredName()));
-					}
-					return false;
-				}
-				NumericProperty->SetIntPropertyValue(OutValue, IntValue);
-			}
-			else if (NumericProperty->IsFloatingPoint())
-			{
-				// AsNumber will log an error for completely inappropriate types (then give us a default)
-				NumericProperty->SetFloatingPointPropertyValue(OutValue, JsonValue->AsNumber());
-			}
-			else if (NumericProperty->IsInteger())
+			Writer.WriteNull();
+		}
+	}
+
+	void WriteJsonValue(const FString* Identifier, const TSharedPtr<FJsonValue>& JsonValue)
+	{
+		if (JsonValue.IsValid() == false)
+		{
+			WriteNull(Identifier);
+			return;
+		}
+
+		switch (JsonValue->Type)
+		{
+		case EJson::String: WriteValue(Identifier, JsonValue->AsString()); break;
+		case EJson::Number: WriteValue(Identifier, JsonValue->AsNumber()); break;
+		case EJson::Boolean: WriteValue(Identifier, JsonValue->AsBool()); break;
+		case EJson::Array:
+		{
+			WriteArrayStart(Identifier);
+			for (const auto& Element : JsonValue->AsArray())
 			{
-				if (JsonValue->Type == EJson::String)
-				{
-					// parse string -> int64 ourselves so we don't lose any precision going through AsNumber (aka
-					// double)
-					NumericProperty->SetIntPropertyValue(OutValue, FCString::Atoi64(*JsonValue->AsString()));
-				}
-				else
-				{
-					// AsNumber will log an error for completely inappropriate types (then give us a default)
-					NumericProperty->SetIntPropertyValue(OutValue, static_cast<int64>(JsonValue->AsNumber()));
-				}
+				WriteJsonValue(nullptr, Element);
 			}
-			else
+			Writer.WriteArrayEnd();
+			break;
+		}
+		case EJson::Object:
+		{
+			WriteObjectStart(Identifier);
+			WriteJsonAttributes(JsonValue->AsObject()->Values);
+			Writer.WriteObjectEnd();
+			break;
+		}
+		default: WriteNull(Identifier); break;
+		}
+	}
+
+	void WriteJsonAttributes(const TMap<FString, TSharedPtr<FJsonValue>>& JsonAttributes)
+	{
+		for (const auto& Entry : JsonAttributes)
+		{
+			WriteJsonValue(&Entry.Key, Entry.Value);
+		}
+	}
+
+	FString GetMapKeyString(FMapProperty* MapProperty, const void* Key, int32 Index, int64 CheckFlags, int64 SkipFlags)
+		const
+	{
+		const auto KeyElement = DomHelper.UPropertyToJsonValue(
+			MapProperty->KeyProp,
+			Key,
+			nullptr,
+			CheckFlags & (~CPF_ParmFlags),
+			SkipFlags,
+			nullptr,
+			MapProperty,
+			false);
+
+		FString KeyString;
+		if (KeyElement.Value.IsValid() == false || !KeyElement.Value->TryGetString(KeyString))
+		{
+			MapProperty->KeyProp->ExportTextItem_Direct(KeyString, Key, nullptr, nullptr, 0);
+			if (KeyString.IsEmpty())
 			{
 				UE_LOG(
 					LogJsonDataAsset,
 					Error,
-					TEXT("JsonValueToUProperty - Unable to import json value into %s numeric property %s"),
-					*Property->GetClass()->GetName(),
-					*Property->GetAuthoredName());
-				if (OutFailReason)
-				{
-					*OutFailReason = FText::Format(
-						INVTEXT("Unable to import json value into {0} numeric property {1}"),
-						FText::FromString(Property->GetClass()->GetName()),
-						FText::FromString(Property->GetAuthoredName()));
-				}
-				return false;
+					TEXT("Unable to convert key to string for property %s."),
+					*MapProperty->GetAuthoredName())
+				KeyString = FString::Printf(TEXT("Unparsed Key %d"), Index);
 			}
 		}
-		else if (FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+
+		// Coerce camelCase map keys for Enum/FName properties
+		if (CastField<FEnumProperty>(MapProperty->KeyProp) || CastField<FNameProperty>(MapProperty->KeyProp))
 		{
-			// AsBool will log an error for completely inappropriate types (then give us a default)
-			BoolProperty->SetPropertyValue(OutValue, JsonValue->AsBool());
+			KeyString = FJsonObjectConverter::StandardizeCase(KeyString);
 		}
-		else if (FStrProperty* StringProperty = CastField<FStrProperty>(Property))
+		return KeyString;
+	}
+
+	/** Write property, assuming either the property is not an array or the value is an individual array element */
+	bool WriteScalarProperty(
+		const FString* Identifier,
+		FProperty* Property,
+		const void* Value,
+		int64 CheckFlags,
+		int64 SkipFlags,
+		FProperty* OuterProperty)
+	{
+		if (FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
 		{
-			// AsString will log an error for completely inappropriate types (then give us a default)
-			StringProperty->SetPropertyValue(OutValue, JsonValue->AsString());
+			// export enums as strings
+			UEnum* EnumDef = EnumProperty->GetEnum();
+			WriteValue(
+				Identifier,
+				FJsonEnumNameCache::Get().GetAuthoredNameStringByValue(
+					EnumDef,
+					EnumProperty->GetUnderlyingProperty()->GetSignedIntPropertyValue(Value)));
+			return true;
 		}
-		else if (FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+		else if (FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property))
 		{
-			if (JsonValue->Type == EJson::Array)
+			// see if it's an enum
+			UEnum* EnumDef = NumericProperty->GetIntPropertyEnum();
+			if (EnumDef != nullptr)
 			{
-				TArray<TSharedPtr<FJsonValue>> ArrayValue = JsonValue->AsArray();
-				int32 ArrLen = ArrayValue.Num();
+				// export enums as strings
+				WriteValue(
+					Identifier,
+					FJsonEnumNameCache::Get().GetAuthoredNameStringByValue(
+						EnumDef,
+						NumericProperty->GetSignedIntPropertyValue(Value)));
+				return true;
+			}
 
-				// make the output array size match
-				FScriptArrayHelper Helper(ArrayProperty, OutValue);
-				Helper.Resize(ArrLen);
+			// We want to export numbers as numbers.
+			// Integers are written as double like FJsonValueNumber does to get the same number formatting.
+			if (NumericProperty->IsFloatingPoint())
+			{
+				WriteValue(Identifier, NumericProperty->GetFloatingPointPropertyValue(Value));
+				return true;
+			}
+			else if (NumericProperty->IsInteger())
+			{
+				WriteValue(Identifier, static_cast<double>(NumericProperty->GetSignedIntPropertyValue(Value)));
+				return true;
+			}
 
-				// set the property values
-				for (int32 i = 0; i < ArrLen; ++i)
+			UE_LOG(
+				LogJsonDataAsset,
+				Error,
+				TEXT("UObjectToJsonWriter - Unhandled property type '%s': %s"),
+				*Property->GetClass()->GetName(),
+				*Property->GetPathName());
+			return false;
+		}
+		else if (FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+		{
+			// Export booleans as booleans
+			WriteValue(Identifier, BoolProperty->GetPropertyValue(Value));
+			return true;
+		}
+		else if (FStrProperty* StringProperty = CastField<FStrProperty>(Property))
+		{
+			WriteValue(Identifier, StringProperty->GetPropertyValue(Value));
+			return true;
+		}
+		else if (FTextProperty* TextProperty = CastField<FTextProperty>(Property))
+		{
+			WriteValue(Identifier, TextProperty->GetPropertyValue(Value).ToString());
+			return true;
+		}
+		else if (FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+		{
+			WriteArrayStart(Identifier);
+			FScriptArrayHelper Helper(ArrayProperty, Value);
+			for (int32 i = 0, n = Helper.Num(); i < n; ++i)
+			{
+				if (WriteProperty(
+						nullptr,
+						ArrayProperty->Inner,
+						Helper.GetRawPtr(i),
+						CheckFlags & (~CPF_ParmFlags),
+						SkipFlags,
+						ArrayProperty)
+					== false)
 				{
-					const TSharedPtr<FJsonValue>& ArrayValueItem = ArrayValue[i];
-					if (ArrayValueItem.IsValid() && !ArrayValueItem->IsNull())
-					{
-						if (!JsonValueToFPropertyWithContainer(
-								ArrayValueItem,
-								ArrayProperty->Inner,
-								Helper.GetRawPtr(i),
-								ContainerStruct,
-								Container,
-								VersionLoadingArchive,
-								CheckFlags & (~CPF_ParmFlags),
-								SkipFlags,
-								bStrictMode,
-								OutFailReason))
-						{
-							UE_LOG(
-								LogJsonDataAsset,
-								Error,
-								TEXT("JsonValueToUProperty - Unable to import Array element %d for property %s"),
-								i,
-								*Property->GetAuthoredName());
-							if (OutFailReason)
-							{
-								*OutFailReason = FText::Format(
-									INVTEXT("Unable to import Array element {0} for property {1}\n{2}"),
-									FText::AsNumber(i),
-									FText::FromString(Property->GetAuthoredName()),
-									*OutFailReason);
-							}
-							return false;
-						}
-					}
+					return false;
 				}
 			}
-			else
+			Writer.WriteArrayEnd();
+			return true;
+		}
+		else if (FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+		{
+			WriteArrayStart(Identifier);
+			FScriptSetHelper Helper(SetProperty, Value);
+			for (int32 i = 0, n = Helper.Num(); n; ++i)
 			{
-				UE_LOG(
-					LogJsonDataAsset,
-					Error,
-					TEXT("JsonValueToUProperty - Unable to import non-array JSON value into Array property %s"),
-					*Property->GetAuthoredName());
-				if (OutFailReason)
+				if (Helper.IsValidIndex(i))
 				{
-					*OutFailReason = FText::Format(
-						INVTEXT("Unable to import non-array JSON value into Array property {0}"),
-						FText::FromString(Property->GetAuthoredName()));
+					if (WriteProperty(
+							nullptr,
+							SetProperty->ElementProp,
+							Helper.GetElementPtr(i),
+							CheckFlags & (~CPF_ParmFlags),
+							SkipFlags,
+							SetProperty)
+						== false)
+					{
+						return false;
+					}
+
+					--n;
 				}
-				return false;
 			}
+			Writer.WriteArrayEnd();
+			return true;
 		}
 		else if (FMapProperty* MapProperty = CastField<FMapProperty>(Property))
 		{
-			if (JsonValue->Type == EJson::Object)
+			WriteObjectStart(Identifier);
+			FScriptMapHelper Helper(MapProperty, Value);
+			for (int32 i = 0, n = Helper.Num(); n; ++i)
 			{
-				TSharedPtr<FJsonObject> ObjectValue = JsonValue->AsObject();
-
-				FScriptMapHelper Helper(MapProperty, OutValue);
-
-				check(ObjectValue);
-
-				int32 MapSize = ObjectValue->Values.Num();
-				Helper.EmptyValues(MapSize);
-
-				// set the property values
-				for (const auto& Entry : ObjectValue->Values)
+				if (Helper.IsValidIndex(i))
 				{
-					if (Entry.Value.IsValid() && !Entry.Value->IsNull())
+					const FString KeyString =
+						GetMapKeyString(MapProperty, Helper.GetKeyPtr(i), i, CheckFlags, SkipFlags);
+					if (WriteProperty(
+							&KeyString,
+							MapProperty->ValueProp,
+							Helper.GetValuePtr(i),
+							CheckFlags & (~CPF_ParmFlags),
+							SkipFlags,
+							MapProperty)
+						== false)
 					{
-						int32 NewIndex = Helper.AddDefaultValue_Invalid_NeedsRehash();
-
-						TSharedPtr<FJsonValueString> TempKeyValue = MakeShared<FJsonValueString>(Entry.Key);
-
-						if (!JsonValueToFPropertyWithContainer(
-								TempKeyValue,
-								MapProperty->KeyProp,
-								Helper.GetKeyPtr(NewIndex),
-								ContainerStruct,
-								Container,
-								VersionLoadingArchive,
-								CheckFlags & (~CPF_ParmFlags),
-								SkipFlags,
-								bStrictMode,
-								OutFailReason))
-						{
-							UE_LOG(
-								LogJsonDataAsset,
-								Error,
-								TEXT("JsonValueToUProperty - Unable to import Map element %s key for property %s"),
-								*Entry.Key,
-								*Property->GetAuthoredName());
-							if (OutFailReason)
-							{
-								*OutFailReason = FText::Format(
-									INVTEXT("Unable to import Map element {0} key for property {1}\n{2}"),
-									FText::FromString(Entry.Key),
-									FText::FromString(Property->GetAuthoredName()),
-									*OutFailReason);
-							}
-							return false;
-						}
-
-						if (!JsonValueToFPropertyWithContainer(
-								Entry.Value,
-								MapProperty->ValueProp,
-								Helper.GetValuePtr(NewIndex),
-								ContainerStruct,
-								Container,
-								VersionLoadingArchive,
-								CheckFlags & (~CPF_ParmFlags),
-								SkipFlags,
-								bStrictMode,
-								OutFailReason))
-						{
-							UE_LOG(
-								LogJsonDataAsset,
-								Error,
-								TEXT("JsonValueToUProperty - Unable to import Map element %s value for property %s"),
-								*Entry.Key,
-								*Property->GetAuthoredName());
-							if (OutFailReason)
-							{
-								*OutFailReason = FText::Format(
-									INVTEXT("Unable to import Map element {0} value for property {1}\n{2}"),
-									FText::FromString(Entry.Key),
-									FText::FromString(Property->GetAuthoredName()),
-									*OutFailReason);
-							}
-							return false;
-						}
+						return false;
 					}
+
+					--n;
 				}
+			}
+			Writer.WriteObjectEnd();
+			return true;
+		}
+		else if (FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+		{
+			UScriptStruct::ICppStructOps* TheCppStructOps = StructProperty->Struct->GetCppStructOps();
+			// Intentionally exclude the JSON Object wrapper, which specifically needs to export JSON in an object
+			// representation instead of a string
+			if (StructProperty->Struct != FJsonObjectWrapper::StaticStruct() && TheCppStructOps
+				&& TheCppStructOps->HasExportTextItem())
+			{
+				FString OutValueStr;
+				TheCppStructOps->ExportTextItem(OutValueStr, Value, nullptr, nullptr, PPF_None, nullptr);
+				WriteValue(Identifier, OutValueStr);
+				return true;
+			}
 
-				Helper.Rehash();
+			// Gameplay tags and containers don't have an ExportTextItem function (see FJsonLibraryExportHelper)
+			if (StructProperty->Struct->IsChildOf(FGameplayTag::StaticStruct()))
+			{
+				WriteValue(Identifier, StaticCast<const FGameplayTag*>(Value)->ToString());
+				return true;
 			}
-			else
+			else if (StructProperty->Struct->IsChildOf(FGameplayTagContainer::StaticStruct()))
 			{
-				UE_LOG(
-					LogJsonDataAsset,
-					Error,
-					TEXT("JsonValueToUProperty - Unable to import non-object JSON value into Map property %s"),
-					*Property->GetAuthoredName());
-				if (OutFailReason)
+				WriteArrayStart(Identifier);
+				for (const auto& Tag : *StaticCast<const FGameplayTagContainer*>(Value))
 				{
-					*OutFailReason = FText::Format(
-						INVTEXT("Unable to import non-object JSON value into Map property {0}"),
-						FText::FromString(Property->GetAuthoredName()));
+					Writer.WriteValue(Tag.ToString());
 				}
+				Writer.WriteArrayEnd();
+				return true;
+			}
+
+			WriteObjectStart(Identifier);
+			if (WriteStructFields(StructProperty->Struct, Value, CheckFlags & (~CPF_ParmFlags), SkipFlags) == false)
+			{
 				return false;
 			}
+			Writer.WriteObjectEnd();
+			return true;
 		}
-		else if (FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+		else if (FObjectProperty* ObjectProperty = CastField<FObjectProperty>(Property))
 		{
-			if (JsonValue->Type == EJson::Array)
+			// Instanced properties should be copied by value, while normal UObject* properties should output as asset
+			// references
+			UObject* Object = ObjectProperty->GetObjectPropertyValue(Value);
+			if (Object
+				&& (ObjectProperty->HasAnyPropertyFlags(CPF_PersistentInstance)
+					|| (OuterProperty && OuterProperty->HasAnyPropertyFlags(CPF_PersistentInstance))))
 			{
-				TArray<TSharedPtr<FJsonValue>> ArrayValue = JsonValue->AsArray();
-				int32 ArrLen = ArrayValue.Num();
+				WriteObjectStart(Identifier);
+				Writer.WriteValue(ObjectClassNameKey, Object->GetClass()->GetPathName());
+				if (WriteStructFields(Object->GetClass(), Object, CheckFlags, SkipFlags) == false)
+				{
+					return false;
+				}
+				Writer.WriteObjectEnd();
+				return true;
+			}
+		}
 
-				FScriptSetHelper Helper(SetProperty, OutValue);
-				Helper.EmptyElements(ArrLen);
+		// Default to export as string for everything else
+		FString StringValue;
+		Property->ExportTextItem_Direct(StringValue, Value, nullptr, nullptr, PPF_None);
+		WriteValue(Identifier, StringValue);
+		return true;
+	}
 
-				// set the property values
-				for (int32 i = 0; i < ArrLen; ++i)
-				{
-					const TSharedPtr<FJsonValue>& ArrayValueItem = ArrayValue[i];
-					if (ArrayValueItem.IsValid() && !ArrayValueItem->IsNull())
-					{
-						int32 NewIndex = Helper.AddDefaultValue_Invalid_NeedsRehash();
-						if (!JsonValueToFPropertyWithContainer(
-								ArrayValueItem,
-								SetProperty->ElementProp,
-								Helper.GetElementPtr(NewIndex),
-								ContainerStruct,
-								Container,
-								VersionLoadingArchive,
-								CheckFlags & (~CPF_ParmFlags),
-								SkipFlags,
-								bStrictMode,
-								OutFailReason))
-						{
-							UE_LOG(
-								LogJsonDataAsset,
-								Error,
-								TEXT("JsonValueToUProperty - Unable to import Set element %d for property %s"),
-								i,
-								*Property->GetAuthoredName());
-							if (OutFailReason)
-							{
-								*OutFailReason = FText::Format(
-									INVTEXT("Unable to import Set element {0} for property {1}\n{2}"),
-									FText::AsNumber(i),
-									FText::FromString(Property->GetAuthoredName()),
-									*OutFailReason);
-							}
-							return false;
-						}
-					}
-				}
+	bool WriteProperty(
+		const FString* Identifier,
+		FProperty* Property,
+		const void* Value,
+		int64 CheckFlags,
+		int64 SkipFlags,
+		FProperty* OuterProperty = nullptr)
+	{
+		if (Property->ArrayDim == 1)
+		{
+			return WriteScalarProperty(Identifier, Property, Value, CheckFlags, SkipFlags, OuterProperty);
+		}
 
-				Helper.Rehash();
-			}
-			else
+		WriteArrayStart(Identifier);
+		for (int Index = 0; Index != Property->ArrayDim; ++Index)
+		{
+			if (WriteScalarProperty(
+					nullptr,
+					Property,
+					StaticCast<const char*>(Value) + Index * Property->ElementSize,
+					CheckFlags,
+					SkipFlags,
+					OuterProperty)
+				== false)
 			{
-				UE_LOG(
-					LogJsonDataAsset,
-					Error,
-					TEXT("JsonValueToUProperty - Unable to import non-array JSON value into Set property %s"),
-					*Property->GetAuthoredName());
-				if (OutFailReason)
-				{
-					*OutFailReason = FText::Format(
-						INVTEXT("Unable to import non-array JSON value into Set property {0}"),
-						FText::FromString(Property->GetAuthoredName()));
-				}
 				return false;
 			}
 		}
-		else if (FTextProperty* TextProperty = CastField<FTextProperty>(Property))
+		Writer.WriteArrayEnd();
+		return true;
+	}
+
+	bool WriteStructFields(const UStruct* StructDefinition, const void* Struct, int64 CheckFlags, int64 SkipFlags)
+	{
+		DECLARE_CYCLE_STAT(TEXT("WriteStructFields"), STAT_WriteStructFields, STATGROUP_OUUJsonData);
+
+		if (SkipFlags == 0)
 		{
-			if (JsonValue->Type == EJson::String)
+			// If we have no specified skip flags, skip deprecated, transient and skip serialization by default when
+			// writing
+			SkipFlags |= CPF_Deprecated | CPF_Transient;
+		}
+
+		if (StructDefinition == FJsonObjectWrapper::StaticStruct())
+		{
+			// Just copy it into the object
+			const FJsonObjectWrapper* ProxyObject = StaticCast<const FJsonObjectWrapper*>(Struct);
+			if (ProxyObject->JsonObject.IsValid())
 			{
-				// assume this string is already localized, so import as invariant
-				TextProperty->SetPropertyValue(OutValue, FText::FromString(JsonValue->AsString()));
+				WriteJsonAttributes(ProxyObject->JsonObject->Values);
 			}
-			else if (JsonValue->Type == EJson::Object)
+			return true;
+		}
+
+		for (TFieldIterator<FProperty> It(StructDefinition); It; ++It)
+		{
+			FProperty* Property = *It;
+
+			// Check to see if we should ignore this property
+			if (CheckFlags != 0 && !Property->HasAnyPropertyFlags(CheckFlags))
 			{
-				TSharedPtr<FJsonObject> Obj = JsonValue->AsObject();
-				check(Obj.IsValid()); // should not fail if Type == EJson::Object
+				continue;
+			}
+			if (Property->HasAnyPropertyFlags(SkipFlags))
+			{
+				continue;
+			}
 
-				// import the sub-value as a culture invariant string
-				FText Text;
-				if (!FJsonObjectConverter::GetTextFromObject(Obj.ToSharedRef(), Text))
+			const FString VariableName = FJsonObjectConverter::StandardizeCase(Property->GetAuthoredName());
+			const void* Value = Property->ContainerPtrToValuePtr<uint8>(Struct);
+			if (WriteProperty(&VariableName, Property, Value, CheckFlags, SkipFlags) == false)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	bool WriteObject(const FString* Identifier, const UObject* Object)
+	{
+		WriteObjectStart(Identifier);
+		if (WriteStructFields(Object->GetClass(), Object, DefaultCheckFlags, DefaultSkipFlags) == false)
+		{
+			return false;
+		}
+		Writer.WriteObjectEnd();
+		return true;
+	}
+};
+
+struct FJsonLibraryImportHelper
+{
+	// Gameplay tags by tag string that were resolved during this import. Invalid tag strings map to an invalid tag.
+	// Import sessions share resolved tags across imports (see FJsonGameplayTagCache).
+	TMap<FString, FGameplayTag> ResolvedGameplayTags;
+	// Reused buffer for the tags of a single container.
+	TArray<FGameplayTag> GameplayTagBuffer;
+
+	// Fixups that have to be applied after all json attributes of a struct/object have been imported.
+	static void PostImportStruct(
+		const UStruct* StructDefinition,
+		void* OutStruct,
+		const FArchive& VersionLoadingArchive);
+
+	FGameplayTag ResolveGameplayTag(const FString& TagString)
+	{
+		if (const auto* pTag = ResolvedGameplayTags.Find(TagString))
+		{
+			return *pTag;
+		}
+
+		auto& SessionCache = FJsonGameplayTagCache::Get();
+		FGameplayTag Tag;
+		if (SessionCache.Find(TagString, OUT Tag) == false)
+		{
+			if (UGameplayTagsManager::Get().ImportSingleGameplayTag(Tag, FName(*TagString), true) == false)
+			{
+				Tag = FGameplayTag();
+			}
+			SessionCache.Add(TagString, Tag);
+		}
+		ResolvedGameplayTags.Add(TagString, Tag);
+		return Tag;
+	}
+
+	// Add a resolved tag to GameplayTagBuffer. Invalid tags are skipped.
+	void AddToGameplayTagBuffer(const FString& TagString)
+	{
+		const FGameplayTag Tag = ResolveGameplayTag(TagString);
+		if (Tag.IsValid())
+		{
+			GameplayTagBuffer.AddUnique(Tag);
+		}
+	}
+
+	// Replace the container contents with GameplayTagBuffer, so parent tags are only filled once per container
+	// instead of once per AddTag call.
+	void MoveGameplayTagBufferToContainer(FGameplayTagContainer& OutContainer)
+	{
+		OutContainer = FGameplayTagContainer::CreateFromArray(GameplayTagBuffer);
+		GameplayTagBuffer.Reset();
+	}
+
+	// clang-format off
+	bool JsonValueToFPropertyWithContainer(const TSharedPtr<FJsonValue>& JsonValue, FProperty* Property, void* OutValue, const UStruct* ContainerStruct, void* Container, const FArchive& VersionLoadingArchive, int64 CheckFlags, int64 SkipFlags, const bool bStrictMode, FText* OutFailReason, EJsonImportPropertyType PropertyType = EJsonImportPropertyType::Unknown);
+	bool JsonAttributesToUStructWithContainer(const TMap< FString, TSharedPtr<FJsonValue> >& JsonAttributes, const UStruct* StructDefinition, void* OutStruct, const UStruct* ContainerStruct, void* Container, const FArchive& VersionLoadingArchive, int64 CheckFlags, int64 SkipFlags, const bool bStrictMode, FText* OutFailReason);
+	// clang-format on
+
+	bool JsonValueToUProperty(
+		const TSharedPtr<FJsonValue>& JsonValue,
+		FProperty* Property,
+		void* OutValue,
+		const FArchive& VersionLoadingArchive,
+		int64 CheckFlags,
+		int64 SkipFlags,
+		const bool bStrictMode = false,
+		FText* OutFailReason = nullptr)
+	{
+		return JsonValueToFPropertyWithContainer(
+			JsonValue,
+			Property,
+			OutValue,
+			nullptr,
+			nullptr,
+			VersionLoadingArchive,
+			CheckFlags,
+			SkipFlags,
+			bStrictMode,
+			OutFailReason);
+	}
+
+	bool JsonObjectToUStruct(
+		const TSharedRef<FJsonObject>& JsonObject,
+		const UStruct* StructDefinition,
+		void* OutStruct,
+		const FArchive& VersionLoadingArchive,
+		int64 CheckFlags,
+		int64 SkipFlags,
+		const bool bStrictMode = false,
+		FText* OutFailReason = nullptr)
+	{
+		return JsonAttributesToUStruct(
+			JsonObject->Values,
+			StructDefinition,
+			OutStruct,
+			VersionLoadingArchive,
+			CheckFlags,
+			SkipFlags,
+			bStrictMode,
+			OutFailReason);
+	}
+
+	bool JsonAttributesToUStruct(
+		const TMap<FString, TSharedPtr<FJsonValue>>& JsonAttributes,
+		const UStruct* StructDefinition,
+		void* OutStruct,
+		const FArchive& VersionLoadingArchive,
+		int64 CheckFlags,
+		int64 SkipFlags,
+		const bool bStrictMode = false,
+		FText* OutFailReason = nullptr)
+	{
+		return JsonAttributesToUStructWithContainer(
+			JsonAttributes,
+			StructDefinition,
+			OutStruct,
+			StructDefinition,
+			OutStruct,
+			VersionLoadingArchive,
+			CheckFlags,
+			SkipFlags,
+			bStrictMode,
+			OutFailReason);
+	}
+
+	/** Convert JSON to property, assuming either the property is not an array or the value is an individual array
+	 * element */
+	bool ConvertScalarJsonValueToFPropertyWithContainer(
+		const TSharedPtr<FJsonValue>& JsonValue,
+		FProperty* Property,
+		void* OutValue,
+		const UStruct* ContainerStruct,
+		void* Container,
+		const FArchive& VersionLoadingArchive,
+		int64 CheckFlags,
+		int64 SkipFlags,
+		const bool bStrictMode,
+		FText* OutFailReason)
+	{
+		DECLARE_CYCLE_STAT(
+			TEXT("ConvertScalarJsonValueToFPropertyWithContainer"),
+			STAT_ConvertScalarJsonValueToFPropertyWithContainer,
+			STATGROUP_OUUJsonData);
+
+		if (FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+		{
+			if (JsonValue->Type == EJson::String)
+			{
+				// see if we were passed a string for the enum
+				const UEnum* Enum = EnumProperty->GetEnum();
+				check(Enum);
+				FString StrValue = JsonValue->AsString();
+				int64 IntValue = FJsonEnumNameCache::Get().GetValueByAuthoredName(Enum, StrValue);
+				if (IntValue == INDEX_NONE)
 				{
 					UE_LOG(
 						LogJsonDataAsset,
 						Error,
-						TEXT("JsonValueToUProperty - Unable to import JSON object with invalid keys into Text property "
-							 "%s"),
+						TEXT("JsonValueToUProperty - Unable to import enum %s from string value %s for property %s"),
+						*Enum->CppType,
+						*StrValue,
 						*Property->GetAuthoredName());
 					if (OutFailReason)
 					{
 						*OutFailReason = FText::Format(
-							INVTEXT("Unable to import JSON object with invalid keys into Text property {0}"),
+							INVTEXT("Unable to import enum {0} from string value {1} for property {2}"),
+							FText::FromString(Enum->CppType),
+							FText::FromString(StrValue),
 							FText::FromString(Property->GetAuthoredName()));
 					}
 					return false;
 				}
-				TextProperty->SetPropertyValue(OutValue, Text);
+				EnumProperty->GetUnderlyingProperty()->SetIntPropertyValue(OutValue, IntValue);
 			}
 			else
 			{
-				UE_LOG(
-					LogJsonDataAsset,
-					Error,
-					TEXT("JsonValueToUProperty - Unable to import JSON value that is neither string nor object into "
-						 "Text property %s"),
-					*Property->GetAuthoredName());
-				if (OutFailReason)
-				{
-					*OutFailReason = FText::Format(
-						INVTEXT("Unable to import JSON value that is neither string nor object into Text property {0}"),
-						FText::FromString(Property->GetAuthoredName()));
-				}
-				return false;
+				// AsNumber will log an error for completely inappropriate types (then give us a default)
+				EnumProperty->GetUnderlyingProperty()
+					->SetIntPropertyValue(OutValue, StaticCast<int64>(JsonValue->AsNumber()));
 			}
 		}
-		else if (FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+		else if (FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property))
 		{
-			if (JsonValue->Type == EJson::Object)
+			if (NumericProperty->IsEnum() && JsonValue->Type == EJson::String)
 			{
-				TSharedPtr<FJsonObject> Obj = JsonValue->AsObject();
-				check(Obj.IsValid()); // should not fail if Type == EJson::Object
-				if (!JsonAttributesToUStructWithContainer(
-						Obj->Values,
-						StructProperty->Struct,
-						OutValue,
-						ContainerStruct,
-						Container,
-						VersionLoadingArchive,
-						CheckFlags & (~CPF_ParmFlags),
-						SkipFlags,
-						bStrictMode,
-						OutFailReason))
+				// see if we were passed a string for the enum
+				const UEnum* Enum = NumericProperty->GetIntPropertyEnum();
+				check(Enum); // should be assured by IsEnum()
+				FString StrValue = JsonValue->AsString();
+				int64 IntValue = FJsonEnumNameCache::Get().GetValueByAuthoredName(Enum, StrValue);
+				if (IntValue == INDEX_NONE)
 				{
 					UE_LOG(
 						LogJsonDataAsset,
 						Error,
-						TEXT("JsonValueToUProperty - Unable to import JSON object into %s property %s"),
-						*StructProperty->Struct->GetAuthoredName(),
+						TEXT("JsonValueToUProperty - Unable to import enum %s from numeric value %s for property %s"),
+						*Enum->CppType,
+						*StrValue,
 						*Property->GetAuthoredName());
 					if (OutFailReason)
 					{
 						*OutFailReason = FText::Format(
-							INVTEXT("Unable to import JSON object into {0} property {1}\n{2}"),
-							FText::FromString(StructProperty->Struct->GetAuthoredName()),
-							FText::FromString(Property->GetAuthoredName()),
-							*OutFailReason);
+							INVTEXT("Unable to import enum {0} from numeric value {1} for property {2}"),
+							FText::FromString(Enum->CppType),
+							FText::FromString(StrValue),
+							FText::FromString(Property->GetAuthoredName()));
 					}
 					return false;
 				}
+				NumericProperty->SetIntPropertyValue(OutValue, IntValue);
 			}
-			else if (JsonValue->Type == EJson::String && StructProperty->Struct->GetFName() == NAME_LinearColor)
-			{
-				FLinearColor& ColorOut = *StaticCast<FLinearColor*>(OutValue);
-				FString ColorString = JsonValue->AsString();
-
-				FColor IntermediateColor;
-				IntermediateColor = FColor::FromHex(ColorString);
-
-				ColorOut = IntermediateColor;
-			}
-			else if (JsonValue->Type == EJson::String && StructProperty->Struct->GetFName() == NAME_Color)
+			else if (NumericProperty->IsFloatingPoint())
 			{
-				FColor& ColorOut = *StaticCast<FColor*>(OutValue);
-				FString ColorString = JsonValue->AsString();
-
-				ColorOut = FColor::FromHex(ColorString);
+				// AsNumber will log an error for completely inappropriate types (then give us a default)
+				NumericProperty->SetFloatingPointPropertyValue(OutValue, JsonValue->AsNumber());
 			}
-			else if (JsonValue->Type == EJson::String && StructProperty->Struct->GetFName() == NAME_DateTime)
+			else if (NumericProperty->IsInteger())
 			{
-				FString DateString = JsonValue->AsString();
-				FDateTime& DateTimeOut = *StaticCast<FDateTime*>(OutValue);
-				if (DateString == TEXT("min"))
-				{
-					// min representable value for our date struct. Actual date may vary by platform (this is used for
-					// sorting)
-					DateTimeOut = FDateTime::MinValue();
-				}
-				else if (DateString == TEXT("max"))
-				{
-					// max representable value for our date struct. Actual date may vary by platform (this is used for
-					// sorting)
-					DateTimeOut = FDateTime::MaxValue();
-				}
-				else if (DateString == TEXT("now"))
-				{
-					// this value's not really meaningful from JSON serialization (since we don't know timezone) but
-					// handle it anyway since we're handling the other keywords
-					DateTimeOut = FDateTime::UtcNow();
-				}
-				else if (FDateTime::ParseIso8601(*DateString, DateTimeOut))
+				if (JsonValue->Type == EJson::String)
 				{
-					// ok
+					// parse string -> int64 ourselves so we don't lose any precision going through AsNumber (aka
+					// double)
+					NumericProperty->SetIntPropertyValue(OutValue, FCString::Atoi64(*JsonValue->AsString()));
 				}
-				else if (FDateTime::Parse(DateString, DateTimeOut))
+				else
 				{
-					// ok
+					// AsNumber will log an error for completely inappropriate types (then give us a default)
+					NumericProperty->SetIntPropertyValue(OutValue, static_cast<int64>(JsonValue->AsNumber()));
 				}
-				else
+			}
+			else
+			{
+				UE_LOG(
+					LogJsonDataAsset,
+					Error,
+					TEXT("JsonValueToUProperty - Unable to import json value into %s numeric property %s"),
+					*Property->GetClass()->GetName(),
+					*Property->GetAuthoredName());
+				if (OutFailReason)
 				{
-					UE_LOG(
-						LogJsonDataAsset,
-						Error,
-						TEXT("JsonValueToUProperty - Unable to import JSON string into DateTime property %s"),
-						*Property->GetAuthoredName());
-					if (OutFailReason)
-					{
-						*OutFailReason = FText::Format(
-							INVTEXT("Unable to import JSON string into DateTime property {0}"),
-							FText::FromString(Property->GetAuthoredName()));
-					}
-					return false;
+					*OutFailReason = FText::Format(
+						INVTEXT("Unable to import json value into {0} numeric property {1}"),
+						FText::FromString(Property->GetClass()->GetName()),
+						FText::FromString(Property->GetAuthoredName()));
 				}
+				return false;
 			}
-			else if (
-				JsonValue->Type == EJson::String && StructProperty->Struct->GetCppStructOps()
-				&& StructProperty->Struct->GetCppStructOps()->HasImportTextItem())
+		}
+		else if (FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+		{
+			// AsBool will log an error for completely inappropriate types (then give us a default)
+			BoolProperty->SetPropertyValue(OutValue, JsonValue->AsBool());
+		}
+		else if (FStrProperty* StringProperty = CastField<FStrProperty>(Property))
+		{
+			// AsString will log an error for completely inappropriate types (then give us a default)
+			StringProperty->SetPropertyValue(OutValue, JsonValue->AsString());
+		}
+		else if (FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+		{
+			if (JsonValue->Type == EJson::Array)
 			{
-				UScriptStruct::ICppStructOps* TheCppStructOps = StructProperty->Struct->GetCppStructOps();
+				TArray<TSharedPtr<FJsonValue>> ArrayValue = JsonValue->AsArray();
+				int32 ArrLen = ArrayValue.Num();
 
-				FString ImportTextString = JsonValue->AsString();
-				const TCHAR* ImportTextPtr = *ImportTextString;
-				if (!TheCppStructOps->ImportTextItem(ImportTextPtr, OutValue, PPF_None, nullptr, (FOutputDevice*)GWarn))
+				// make the output array size match
+				FScriptArrayHelper Helper(ArrayProperty, OutValue);
+				Helper.Resize(ArrLen);
+
+				// set the property values
+				for (int32 i = 0; i < ArrLen; ++i)
 				{
-					// Fall back to trying the tagged property approach if custom ImportTextItem couldn't get it done
-					if (Property->ImportText_Direct(ImportTextPtr, OutValue, nullptr, PPF_None) == nullptr)
+					const TSharedPtr<FJsonValue>& ArrayValueItem = ArrayValue[i];
+					if (ArrayValueItem.IsValid() && !ArrayValueItem->IsNull())
 					{
-						UE_LOG(
-							LogJsonDataAsset,
-							Error,
-							TEXT("JsonValueToUProperty - Unable to import JSON string into %s property %s"),
-							*StructProperty->Struct->GetAuthoredName(),
-							*Property->GetAuthoredName());
-						if (OutFailReason)
+						if (!JsonValueToFPropertyWithContainer(
+								ArrayValueItem,
+								ArrayProperty->Inner,
+								Helper.GetRawPtr(i),
+								ContainerStruct,
+								Container,
+								VersionLoadingArchive,
+								CheckFlags & (~CPF_ParmFlags),
+								SkipFlags,
+								bStrictMode,
+								OutFailReason))
 						{
-							*OutFailReason = FText::Format(
-								INVTEXT("Unable to import JSON string into {0} property {1}"),
-								FText::FromString(StructProperty->Struct->GetAuthoredName()),
-								FText::FromString(Property->GetAuthoredName()));
+							UE_LOG(
+								LogJsonDataAsset,
+								Error,
+								TEXT("JsonValueToUProperty - Unable to import Array element %d for property %s"),
+								i,
+								*Property->GetAuthoredName());
+							if (OutFailReason)
+							{
+								*OutFailReason = FText::Format(
+									INVTEXT("Unable to import Array element {0} for property {1}\n{2}"),
+									FText::AsNumber(i),
+									FText::FromString(Property->GetAuthoredName()),
+									*OutFailReason);
+							}
+							return false;
 						}
-						return false;
 					}
 				}
 			}
-			else if (JsonValue->Type == EJson::String)
+			else
 			{
-				FString ImportTextString = JsonValue->AsString();
-				const TCHAR* ImportTextPtr = *ImportTextString;
-				if (Property->ImportText_Direct(ImportTextPtr, OutValue, nullptr, PPF_None) == nullptr)
+				UE_LOG(
+					LogJsonDataAsset,
+					Error,
+					TEXT("JsonValueToUProperty - Unable to import non-array JSON value into Array property %s"),
+					*Property->GetAuthoredName());
+				if (OutFailReason)
 				{
-					UE_LOG(
-						LogJsonDataAsset,
-						Error,
-						TEXT("JsonValueToUProperty - Unable to import JSON string into %s property %s"),
-						*StructProperty->Struct->GetAuthoredName(),
-						*Property->GetAuthoredName());
-					if (OutFailReason)
-					{
-						*OutFailReason = FText::Format(
-							INVTEXT("Unable to import JSON string into {0} property {1}"),
-							FText::FromString(StructProperty->Struct->GetAuthoredName()),
-							FText::FromString(Property->GetAuthoredName()));
-					}
-					return false;
+					*OutFailReason = FText::Format(
+						INVTEXT("Unable to import non-array JSON value into Array property {0}"),
+						FText::FromString(Property->GetAuthoredName()));
 				}
+				return false;
 			}
-			else
+		}
+		else if (FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+		{
+			if (JsonValue->Type == EJson::Object)
+			{
+				TSharedPtr<FJsonObject> ObjectValue = JsonValue->AsObject();
+
+				FScriptMapHelper Helper(MapProperty, OutValue);
+
+				check(ObjectValue);
+
+				int32 MapSize = ObjectValue->Values.Num();
+				Helper.EmptyValues(MapSize);
+
+				// set the property values
+				for (const auto& Entry : ObjectValue->Values)
+				{
+					if (Entry.Value.IsValid() && !Entry.Value->IsNull())
+					{
+						int32 NewIndex = Helper.AddDefaultValue_Invalid_NeedsRehash();
+
+						TSharedPtr<FJsonValueString> TempKeyValue = MakeShared<FJsonValueString>(Entry.Key);
+
+						if (!JsonValueToFPropertyWithContainer(
+								TempKeyValue,
+								MapProperty->KeyProp,
+								Helper.GetKeyPtr(NewIndex),
+								ContainerStruct,
+								Container,
+								VersionLoadingArchive,
+								CheckFlags & (~CPF_ParmFlags),
+								SkipFlags,
+								bStrictMode,
+								OutFailReason))
+						{
+							UE_LOG(
+								LogJsonDataAsset,
+								Error,
+								TEXT("JsonValueToUProperty - Unable to import Map element %s key for property %s"),
+								*Entry.Key,
+								*Property->GetAuthoredName());
+							if (OutFailReason)
+							{
+								*OutFailReason = FText::Format(
+									INVTEXT("Unable to import Map element {0} key for property {1}\n{2}"),
+									FText::FromString(Entry.Key),
+									FText::FromString(Property->GetAuthoredName()),
+									*OutFailReason);
+							}
+							return false;
+						}
+
+						if (!JsonValueToFPropertyWithContainer(
+								Entry.Value,
+								MapProperty->ValueProp,
+								Helper.GetValuePtr(NewIndex),
+								ContainerStruct,
+								Container,
+								VersionLoadingArchive,
+								CheckFlags & (~CPF_ParmFlags),
+								SkipFlags,
+								bStrictMode,
+								OutFailReason))
+						{
+							UE_LOG(
+								LogJsonDataAsset,
+								Error,
+								TEXT("JsonValueToUProperty - Unable to import Map element %s value for property %s"),
+								*Entry.Key,
+								*Property->GetAuthoredName());
+							if (OutFailReason)
+							{
+								*OutFailReason = FText::Format(
+									INVTEXT("Unable to import Map element {0} value for property {1}\n{2}"),
+									FText::FromString(Entry.Key),
+									FText::FromString(Property->GetAuthoredName()),
+									*OutFailReason);
+							}
+							return false;
+						}
+					}
+				}
+
+				Helper.Rehash();
+			}
+			else
+			{
+				UE_LOG(
+					LogJsonDataAsset,
+					Error,
+					TEXT("JsonValueToUProperty - Unable to import non-object JSON value into Map property %s"),
+					*Property->GetAuthoredName());
+				if (OutFailReason)
+				{
+					*OutFailReason = FText::Format(
+						INVTEXT("Unable to import non-object JSON value into Map property {0}"),
+						FText::FromString(Property->GetAuthoredName()));
+				}
+				return false;
+			}
+		}
+		else if (FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+		{
+			if (JsonValue->Type == EJson::Array)
+			{
+				TArray<TSharedPtr<FJsonValue>> ArrayValue = JsonValue->AsArray();
+				int32 ArrLen = ArrayValue.Num();
+
+				FScriptSetHelper Helper(SetProperty, OutValue);
+				Helper.EmptyElements(ArrLen);
+
+				// set the property values
+				for (int32 i = 0; i < ArrLen; ++i)
+				{
+					const TSharedPtr<FJsonValue>& ArrayValueItem = ArrayValue[i];
+					if (ArrayValueItem.IsValid() && !ArrayValueItem->IsNull())
+					{
+						int32 NewIndex = Helper.AddDefaultValue_Invalid_NeedsRehash();
+						if (!JsonValueToFPropertyWithContainer(
+								ArrayValueItem,
+								SetProperty->ElementProp,
+								Helper.GetElementPtr(NewIndex),
+								ContainerStruct,
+								Container,
+								VersionLoadingArchive,
+								CheckFlags & (~CPF_ParmFlags),
+								SkipFlags,
+								bStrictMode,
+								OutFailReason))
+						{
+							UE_LOG(
+								LogJsonDataAsset,
+								Error,
+								TEXT("JsonValueToUProperty - Unable to import Set element %d for property %s"),
+								i,
+								*Property->GetAuthoredName());
+							if (OutFailReason)
+							{
+								*OutFailReason = FText::Format(
+									INVTEXT("Unable to import Set element {0} for property {1}\n{2}"),
+									FText::AsNumber(i),
+									FText::FromString(Property->GetAuthoredName()),
+									*OutFailReason);
+							}
+							return false;
+						}
+					}
+				}
+
+				Helper.Rehash();
+			}
+			else
+			{
+				UE_LOG(
+					LogJsonDataAsset,
+					Error,
+					TEXT("JsonValueToUProperty - Unable to import non-array JSON value into Set property %s"),
+					*Property->GetAuthoredName());
+				if (OutFailReason)
+				{
+					*OutFailReason = FText::Format(
+						INVTEXT("Unable to import non-array JSON value into Set property {0}"),
+						FText::FromString(Property->GetAuthoredName()));
+				}
+				return false;
+			}
+		}
+		else if (FTextProperty* TextProperty = CastField<FTextProperty>(Property))
+		{
+			if (JsonValue->Type == EJson::String)
+			{
+				// assume this string is already localized, so import as invariant
+				TextProperty->SetPropertyValue(OutValue, FText::FromString(JsonValue->AsString()));
+			}
+			else if (JsonValue->Type == EJson::Object)
+			{
+				TSharedPtr<FJsonObject> Obj = JsonValue->AsObject();
+				check(Obj.IsValid()); // should not fail if Type == EJson::Object
+
+				// import the sub-value as a culture invariant string
+				FText Text;
+				if (!FJsonObjectConverter::GetTextFromObject(Obj.ToSharedRef(), Text))
+				{
+					UE_LOG(
+						LogJsonDataAsset,
+						Error,
+						TEXT("JsonValueToUProperty - Unable to import JSON object with invalid keys into Text property "
+							 "%s"),
+						*Property->GetAuthoredName());
+					if (OutFailReason)
+					{
+						*OutFailReason = FText::Format(
+							INVTEXT("Unable to import JSON object with invalid keys into Text property {0}"),
+							FText::FromString(Property->GetAuthoredName()));
+					}
+					return false;
+				}
+				TextProperty->SetPropertyValue(OutValue, Text);
+			}
+			else
+			{
+				UE_LOG(
+					LogJsonDataAsset,
+					Error,
+					TEXT("JsonValueToUProperty - Unable to import JSON value that is neither string nor object into "
+						 "Text property %s"),
+					*Property->GetAuthoredName());
+				if (OutFailReason)
+				{
+					*OutFailReason = FText::Format(
+						INVTEXT("Unable to import JSON value that is neither string nor object into Text property {0}"),
+						FText::FromString(Property->GetAuthoredName()));
+				}
+				return false;
+			}
+		}
+		else if (FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+		{
+			if (JsonValue->Type == EJson::Object)
+			{
+				TSharedPtr<FJsonObject> Obj = JsonValue->AsObject();
+				check(Obj.IsValid()); // should not fail if Type == EJson::Object
+				if (!JsonAttributesToUStructWithContainer(
+						Obj->Values,
+						StructProperty->Struct,
+						OutValue,
+						ContainerStruct,
+						Container,
+						VersionLoadingArchive,
+						CheckFlags & (~CPF_ParmFlags),
+						SkipFlags,
+						bStrictMode,
+						OutFailReason))
+				{
+					UE_LOG(
+						LogJsonDataAsset,
+						Error,
+						TEXT("JsonValueToUProperty - Unable to import JSON object into %s property %s"),
+						*StructProperty->Struct->GetAuthoredName(),
+						*Property->GetAuthoredName());
+					if (OutFailReason)
+					{
+						*OutFailReason = FText::Format(
+							INVTEXT("Unable to import JSON object into {0} property {1}\n{2}"),
+							FText::FromString(StructProperty->Struct->GetAuthoredName()),
+							FText::FromString(Property->GetAuthoredName()),
+							*OutFailReason);
+					}
+					return false;
+				}
+			}
+			else if (JsonValue->Type == EJson::String && StructProperty->Struct->GetFName() == NAME_LinearColor)
+			{
+				FLinearColor& ColorOut = *StaticCast<FLinearColor*>(OutValue);
+				FString ColorString = JsonValue->AsString();
+
+				FColor IntermediateColor;
+				IntermediateColor = FColor::FromHex(ColorString);
+
+				ColorOut = IntermediateColor;
+			}
+			else if (JsonValue->Type == EJson::String && StructProperty->Struct->GetFName() == NAME_Color)
+			{
+				FColor& ColorOut = *StaticCast<FColor*>(OutValue);
+				FString ColorString = JsonValue->AsString();
+
+				ColorOut = FColor::FromHex(ColorString);
+			}
+			else if (JsonValue->Type == EJson::String && StructProperty->Struct->GetFName() == NAME_DateTime)
+			{
+				FString DateString = JsonValue->AsString();
+				FDateTime& DateTimeOut = *StaticCast<FDateTime*>(OutValue);
+				if (DateString == TEXT("min"))
+				{
+					// min representable value for our date struct. Actual date may vary by platform (this is used for
+					// sorting)
+					DateTimeOut = FDateTime::MinValue();
+				}
+				else if (DateString == TEXT("max"))
+				{
+					// max representable value for our date struct. Actual date may vary by platform (this is used for
+					// sorting)
+					DateTimeOut = FDateTime::MaxValue();
+				}
+				else if (DateString == TEXT("now"))
+				{
+					// this value's not really meaningful from JSON serialization (since we don't know timezone) but
+					// handle it anyway since we're handling the other keywords
+					DateTimeOut = FDateTime::UtcNow();
+				}
+				else if (FDateTime::ParseIso8601(*DateString, DateTimeOut))
+				{
+					// ok
+				}
+				else if (FDateTime::Parse(DateString, DateTimeOut))
+				{
+					// ok
+				}
+				else
+				{
+					UE_LOG(
+						LogJsonDataAsset,
+						Error,
+						TEXT("JsonValueToUProperty - Unable to import JSON string into DateTime property %s"),
+						*Property->GetAuthoredName());
+					if (OutFailReason)
+					{
+						*OutFailReason = FText::Format(
+							INVTEXT("Unable to import JSON string into DateTime property {0}"),
+							FText::FromString(Property->GetAuthoredName()));
+					}
+					return false;
+				}
+			}
+			else if (
+				JsonValue->Type == EJson::String && StructProperty->Struct->GetCppStructOps()
+				&& StructProperty->Struct->GetCppStructOps()->HasImportTextItem())
+			{
+				UScriptStruct::ICppStructOps* TheCppStructOps = StructProperty->Struct->GetCppStructOps();
+
+				FString ImportTextString = JsonValue->AsString();
+				const TCHAR* ImportTextPtr = *ImportTextString;
+				if (!TheCppStructOps->ImportTextItem(ImportTextPtr, OutValue, PPF_None, nullptr, (FOutputDevice*)GWarn))
+				{
+					// Fall back to trying the tagged property approach if custom ImportTextItem couldn't get it done
+					if (Property->ImportText_Direct(ImportTextPtr, OutValue, nullptr, PPF_None) == nullptr)
+					{
+						UE_LOG(
+							LogJsonDataAsset,
+							Error,
+							TEXT("JsonValueToUProperty - Unable to import JSON string into %s property %s"),
+							*StructProperty->Struct->GetAuthoredName(),
+							*Property->GetAuthoredName());
+						if (OutFailReason)
+						{
+							*OutFailReason = FText::Format(
+								INVTEXT("Unable to import JSON string into {0} property {1}"),
+								FText::FromString(StructProperty->Struct->GetAuthoredName()),
+								FText::FromString(Property->GetAuthoredName()));
+						}
+						return false;
+					}
+				}
+			}
+			else if (JsonValue->Type == EJson::String)
+			{
+				FString ImportTextString = JsonValue->AsString();
+				const TCHAR* ImportTextPtr = *ImportTextString;
+				if (Property->ImportText_Direct(ImportTextPtr, OutValue, nullptr, PPF_None) == nullptr)
+				{
+					UE_LOG(
+						LogJsonDataAsset,
+						Error,
+						TEXT("JsonValueToUProperty - Unable to import JSON string into %s property %s"),
+						*StructProperty->Struct->GetAuthoredName(),
+						*Property->GetAuthoredName());
+					if (OutFailReason)
+					{
+						*OutFailReason = FText::Format(
+							INVTEXT("Unable to import JSON string into {0} property {1}"),
+							FText::FromString(StructProperty->Struct->GetAuthoredName()),
+							FText::FromString(Property->GetAuthoredName()));
+					}
+					return false;
+				}
+			}
+			else
+			{
+				UE_LOG(
+					LogJsonDataAsset,
+					Error,
+					TEXT("JsonValueToUProperty - Unable to import JSON value that is neither string nor object into %s "
+						 "property %s"),
+					*StructProperty->Struct->GetAuthoredName(),
+					*Property->GetAuthoredName());
+				if (OutFailReason)
+				{
+					*OutFailReason = FText::Format(
+						INVTEXT("Unable to import JSON value that is neither string nor object into {0} property {1}"),
+						FText::FromString(StructProperty->Struct->GetAuthoredName()),
+						FText::FromString(Property->GetAuthoredName()));
+				}
+				return false;
+			}
+		}
+		else if (FObjectProperty* ObjectProperty = CastField<FObjectProperty>(Property))
+		{
+			if (JsonValue->Type == EJson::Object)
+			{
+				UObject* Outer = GetTransientPackage();
+				if (ContainerStruct->IsChildOf(UObject::StaticClass()))
+				{
+					Outer = StaticCast<UObject*>(Container);
+				}
+
+				TSharedPtr<FJsonObject> Obj = JsonValue->AsObject();
+				UClass* PropertyClass = ObjectProperty->PropertyClass;
+
+				// If a specific subclass was stored in the JSON, use that instead of the PropertyClass
+				FString ClassString = Obj->GetStringField(ObjectClassNameKey);
+				Obj->RemoveField(ObjectClassNameKey);
+				if (!ClassString.IsEmpty())
+				{
+					// ReSharper disable once CppTooWideScope
+					UClass* FoundClass = FPackageName::IsShortPackageName(ClassString)
+						? FindFirstObject<UClass>(*ClassString)
+						: UClass::TryFindTypeSlow<UClass>(ClassString);
+					if (FoundClass)
+					{
+						PropertyClass = FoundClass;
+
+						// GRIMLORE Start dlehn: If stored class does not match expected class, make sure to create the
+						// correct type
+						if (PropertyClass->IsChildOf(ObjectProperty->PropertyClass) == false
+							|| PropertyClass->HasAnyClassFlags(CLASS_Abstract))
+						{
+							UE_LOG(
+								LogJsonDataAsset,
+								Warning,
+								TEXT("JsonValueToUProperty - JSON object class %s saved in property %s on object %s is "
+									 "not valid for a property of type %s. "
+									 "Will try to load as default class instead."),
+								*PropertyClass->GetAuthoredName(),
+								*Property->GetAuthoredName(),
+								*Outer->GetPathName(),
+								*ObjectProperty->PropertyClass->GetAuthoredName());
+
+							PropertyClass = ObjectProperty->PropertyClass;
+						}
+					}
+					else
+					{
+						UE_LOG(
+							LogJsonDataAsset,
+							Warning,
+							TEXT("JsonValueToUProperty - JSON object class %s saved in property %s of type %s on "
+								 "object %s does not exist. Will try to load as default class instead."),
+							*ClassString,
+							*Property->GetAuthoredName(),
+							*ObjectProperty->PropertyClass->GetAuthoredName(),
+							*Outer->GetPathName());
+						// GRIMLORE End
+					}
+				}
+
+				// GRIMLORE Start dlehn: Property class may not be valid, so we will not create an object.
+				if (PropertyClass->HasAnyClassFlags(CLASS_Abstract))
+				{
+					UE_LOG(
+						LogJsonDataAsset,
+						Error,
+						TEXT("JsonValueToUProperty - Unable to import JSON object of class %s into property %s on "
+							 "object %s because the class is abstract."),
+						*PropertyClass->GetAuthoredName(),
+						*Property->GetAuthoredName(),
+						*Outer->GetPathName());
+					if (OutFailReason)
+					{
+						*OutFailReason = FText::Format(
+							INVTEXT("Unable to import JSON object of class {0} into property {1} because the class is "
+									"abstract.\n{2}"),
+							FText::FromString(PropertyClass->GetAuthoredName()),
+							FText::FromString(Property->GetAuthoredName()),
+							*OutFailReason);
+					}
+
+					ObjectProperty->SetObjectPropertyValue(OutValue, nullptr);
+
+					// We cannot return false here, otherwise loading of the object will be cancelled entirely.
+					return true;
+				}
+				// GRIMLORE End
+
+				UObject* createdObj = StaticAllocateObject(
+					PropertyClass,
+					Outer,
+					NAME_None,
+					EObjectFlags::RF_NoFlags,
+					EInternalObjectFlags::None,
+					false);
+				(*PropertyClass->ClassConstructor)(
+					FObjectInitializer(createdObj, PropertyClass->ClassDefaultObject, EObjectInitializerOptions::None));
+
+				ObjectProperty->SetObjectPropertyValue(OutValue, createdObj);
+
+				check(Obj.IsValid()); // should not fail if Type == EJson::Object
+				if (!JsonAttributesToUStructWithContainer(
+						Obj->Values,
+						PropertyClass,
+						createdObj,
+						PropertyClass,
+						createdObj,
+						VersionLoadingArchive,
+						CheckFlags & (~CPF_ParmFlags),
+						SkipFlags,
+						bStrictMode,
+						OutFailReason))
+				{
+					UE_LOG(
+						LogJsonDataAsset,
+						Error,
+						TEXT("JsonValueToUProperty - Unable to import JSON object into %s property %s"),
+						*PropertyClass->GetAuthoredName(),
+						*Property->GetAuthoredName());
+					if (OutFailReason)
+					{
+						*OutFailReason = FText::Format(
+							INVTEXT("Unable to import JSON object into {0} property {1}\n{2}"),
+							FText::FromString(PropertyClass->GetAuthoredName()),
+							FText::FromString(Property->GetAuthoredName()),
+							*OutFailReason);
+					}
+					return false;
+				}
+			}
+			else if (JsonValue->Type == EJson::String)
+			{
+				// Default to expect a string for everything else
+				if (Property->ImportText_Direct(*JsonValue->AsString(), OutValue, nullptr, PPF_SerializedAsImportText)
+					== nullptr)
+				{
+					UE_LOG(
+						LogJsonDataAsset,
+						Error,
+						TEXT("JsonValueToUProperty - Unable to import JSON string into %s property %s"),
+						*ObjectProperty->PropertyClass->GetAuthoredName(),
+						*Property->GetAuthoredName());
+					if (OutFailReason)
+					{
+						*OutFailReason = FText::Format(
+							INVTEXT("Unable to import JSON string into {0} property {1}"),
+							FText::FromString(*ObjectProperty->PropertyClass->GetAuthoredName()),
+							FText::FromString(Property->GetAuthoredName()));
+					}
+					return false;
+				}
+
+				// GRIMLORE Start jreich: Fixed hard refs to objects not resolving redirectors when loading
+				while (auto* Redirector = Cast<UObjectRedirector>(ObjectProperty->GetObjectPropertyValue(OutValue)))
+				{
+					ObjectProperty->SetObjectPropertyValue(OutValue, Redirector->DestinationObject);
+				}
+				// GRIMLORE End
+			}
+		}
+		// GRIMLORE Start dlehn: Fixed interface properties not resolving redirectors when loading
+		else if (FInterfaceProperty* InterfaceProperty = CastField<FInterfaceProperty>(Property))
+		{
+			if (JsonValue->Type == EJson::String)
+			{
+				const auto StringValue = JsonValue->AsString();
+				const TCHAR* Buffer = *StringValue;
+				UObject* TargetObject = nullptr;
+				if (FObjectPropertyBase::ParseObjectPropertyValue(
+						InterfaceProperty,
+						nullptr,
+						UObject::StaticClass(),
+						PPF_SerializedAsImportText,
+						Buffer,
+						TargetObject)
+					== false)
+				{
+					UE_LOG(
+						LogJsonDataAsset,
+						Error,
+						TEXT("JsonValueToUProperty - Unable to import JSON string into %s property %s"),
+						*InterfaceProperty->InterfaceClass->GetAuthoredName(),
+						*Property->GetAuthoredName());
+					if (OutFailReason)
+					{
+						*OutFailReason = FText::Format(
+							INVTEXT("Unable to import JSON string into {0} property {1}"),
+							FText::FromString(*InterfaceProperty->InterfaceClass->GetAuthoredName()),
+							FText::FromString(Property->GetAuthoredName()));
+					}
+					return false;
+				}
+
+				while (auto* Redirector = Cast<UObjectRedirector>(TargetObject))
+				{
+					TargetObject = Redirector->DestinationObject;
+				}
+
+				FScriptInterface LoadedValue;
+				if (TargetObject)
+				{
+					if (TargetObject->GetClass()->ImplementsInterface(InterfaceProperty->InterfaceClass))
+					{
+						LoadedValue.SetObject(TargetObject);
+						LoadedValue.SetInterface(TargetObject->GetInterfaceAddress(InterfaceProperty->InterfaceClass));
+					}
+					else
+					{
+						UE_LOG(
+							LogJsonDataAsset,
+							Error,
+							TEXT("JsonValueToUProperty - Unable to import JSON string into %s property %s because "
+								 "target object '%s' does not implement required interface."),
+							*InterfaceProperty->InterfaceClass->GetAuthoredName(),
+							*Property->GetAuthoredName(),
+							*TargetObject->GetPathName());
+						if (OutFailReason)
+						{
+							*OutFailReason = FText::Format(
+								INVTEXT("Unable to import JSON string into {0} property {1} because target object '%s' "
+										"does not implement required interface"),
+								FText::FromString(InterfaceProperty->InterfaceClass->GetAuthoredName()),
+								FText::FromString(Property->GetAuthoredName()),
+								FText::FromString(TargetObject->GetPathName()));
+						}
+
+						// Don't return false here, that is not a fatal error.
+					}
+				}
+
+				InterfaceProperty->SetPropertyValue(OutValue, LoadedValue);
+			}
+			else
+			{
+				UE_LOG(
+					LogJsonDataAsset,
+					Error,
+					TEXT("JsonValueToUProperty - Unable to import JSON string into %s property %s because we expect "
+						 "interface pointers to be serialized as a string."),
+					*InterfaceProperty->InterfaceClass->GetAuthoredName(),
+					*Property->GetAuthoredName());
+				if (OutFailReason)
+				{
+					*OutFailReason = FText::Format(
+						INVTEXT("Unable to import JSON string into {0} property {1} because we expect interface "
+								"pointers to be serialized as a string."),
+						FText::FromString(*InterfaceProperty->InterfaceClass->GetAuthoredName()),
+						FText::FromString(Property->GetAuthoredName()));
+				}
+				return false;
+			}
+		}
+		// GRIMLORE End
+		else
+		{
+			// Default to expect a string for everything else
+			if (Property->ImportText_Direct(*JsonValue->AsString(), OutValue, nullptr, PPF_SerializedAsImportText)
+				== nullptr)
+			{
+				UE_LOG(
+					LogJsonDataAsset,
+					Error,
+					TEXT("JsonValueToUProperty - Unable to import JSON string into property %s"),
+					*Property->GetAuthoredName());
+				if (OutFailReason)
+				{
+					*OutFailReason = FText::Format(
+						INVTEXT("Unable to import JSON string into property {0}"),
+						FText::FromString(Property->GetAuthoredName()));
+				}
+				return false;
+			}
+		}
+
+		return true;
+	}
+};
+
+void FJsonLibraryImportHelper::PostImportStruct(
+	const UStruct* StructDefinition,
+	void* OutStruct,
+	const FArchive& VersionLoadingArchive)
+{
+	// GRIMLORE Start dlehn: Ensure objects loaded from json receive PostLoad calls
+	if (StructDefinition->IsChildOf<UObject>())
+	{
+		const auto pObject = StaticCast<UObject*>(OutStruct);
+		if (pObject->HasAnyFlags(RF_NeedPostLoad) == false)
+		{
+			pObject->SetFlags(RF_NeedPostLoad);
+			pObject->ConditionalPostLoad();
+		}
+	}
+	else if (const auto ScriptStruct = Cast<UScriptStruct>(StructDefinition))
+	{
+		if (const auto StructOps = ScriptStruct->GetCppStructOps())
+		{
+			if (StructOps->HasPostSerialize())
+			{
+				StructOps->PostSerialize(VersionLoadingArchive, OutStruct);
+			}
+		}
+	}
+
+	// Fix for gameplay tag container's ImportTextItem function not being called because they have no matching
+	// ExportTextItem function. So we have to manually do what they would otherwise do during import.
+	if (StructDefinition->IsChildOf(FGameplayTagContainer::StaticStruct()))
+	{
+		auto& TagContainer = *StaticCast<FGameplayTagContainer*>(OutStruct);
+		const auto& Tags = TagContainer.GetGameplayTagArray();
+		if (Tags.Contains(FGameplayTag()))
+		{
+			// Remove invalid tags. Unfortunately there is no public function to remove all invalid tags at once.
+			TagContainer = FGameplayTagContainer::CreateFromArray(
+				Tags.FilterByPredicate([](const FGameplayTag& Tag) { return Tag.IsValid(); }));
+		}
+		else
+		{
+			TagContainer.FillParentTags();
+		}
+	}
+
+	// GRIMLORE End
+}
+
+bool FJsonLibraryImportHelper::JsonValueToFPropertyWithContainer(
+	const TSharedPtr<FJsonValue>& JsonValue,
+	FProperty* Property,
+	void* OutValue,
+	const UStruct* ContainerStruct,
+	void* Container,
+	const FArchive& VersionLoadingArchive,
+	int64 CheckFlags,
+	int64 SkipFlags,
+	const bool bStrictMode,
+	FText* OutFailReason,
+	EJsonImportPropertyType PropertyType)
+{
+	if (!JsonValue.IsValid())
+	{
+		UE_LOG(LogJsonDataAsset, Error, TEXT("JsonValueToUProperty - Invalid JSON value"));
+		if (OutFailReason)
+		{
+			*OutFailReason = INVTEXT("Invalid JSON value");
+		}
+		return false;
+	}
+
+	if (PropertyType == EJsonImportPropertyType::Unknown)
+	{
+		PropertyType = GetJsonImportPropertyType(Property);
+	}
+	const bool bArrayOrSetProperty =
+		PropertyType == EJsonImportPropertyType::Array || PropertyType == EJsonImportPropertyType::Set;
+	const bool bJsonArray = JsonValue->Type == EJson::Array;
+
+	if (!bJsonArray)
+	{
+		if (bArrayOrSetProperty)
+		{
+			UE_LOG(LogJsonDataAsset, Error, TEXT("JsonValueToUProperty - Expecting JSON array"));
+			if (OutFailReason)
+			{
+				*OutFailReason = INVTEXT("Expecting JSON array");
+			}
+			return false;
+		}
+
+		if (Property->ArrayDim != 1)
+		{
+			if (bStrictMode)
+			{
+				UE_LOG(
+					LogJsonDataAsset,
+					Error,
+					TEXT("JsonValueToUProperty - Property %s is not an array but has %d elements"),
+					*Property->GetAuthoredName(),
+					Property->ArrayDim);
+				if (OutFailReason)
+				{
+					*OutFailReason = FText::Format(
+						INVTEXT("Property {0} is not an array but has {1} elements"),
+						FText::FromString(Property->GetAuthoredName()),
+						FText::AsNumber(Property->ArrayDim));
+				}
+				return false;
+			}
+
+			UE_LOG(
+				LogJsonDataAsset,
+				Warning,
+				TEXT("Ignoring excess properties when deserializing %s"),
+				*Property->GetAuthoredName());
+		}
+
+		return ConvertScalarJsonValueToFPropertyWithContainer(
+			JsonValue,
+			Property,
+			OutValue,
+			ContainerStruct,
+			Container,
+			VersionLoadingArchive,
+			CheckFlags,
+			SkipFlags,
+			bStrictMode,
+			OutFailReason);
+	}
+
+	// In practice, the ArrayDim == 1 check ought to be redundant, since nested arrays of FProperties are not
+	// supported
+	if (bArrayOrSetProperty && Property->ArrayDim == 1)
+	{
+		// Read into TArray
+		return ConvertScalarJsonValueToFPropertyWithContainer(
+			JsonValue,
+			Property,
+			OutValue,
+			ContainerStruct,
+			Container,
+			VersionLoadingArchive,
+			CheckFlags,
+			SkipFlags,
+			bStrictMode,
+			OutFailReason);
+	}
+
+	// We're deserializing a JSON array
+	const auto& ArrayValue = JsonValue->AsArray();
+
+	// GRIMLORE Start dlehn: Manually handle import for gameplay tag containers because the unreal ones don't
+	// properly implement it.
+	if (PropertyType == EJsonImportPropertyType::GameplayTagContainer)
+	{
+		auto& TagContainer = *static_cast<FGameplayTagContainer*>(OutValue);
+		const auto& JsonArray = JsonValue->AsArray();
+		GameplayTagBuffer.Reset(JsonArray.Num());
+		for (const auto& JsonTagValue : JsonArray)
+		{
+			AddToGameplayTagBuffer(JsonTagValue->AsString());
+		}
+		MoveGameplayTagBufferToContainer(TagContainer);
+		return true;
+	}
+	// GRIMLORE End
+
+	if (bStrictMode && (Property->ArrayDim != ArrayValue.Num()))
+	{
+		UE_LOG(
+			LogJsonDataAsset,
+			Error,
+			TEXT("JsonValueToUProperty - JSON array size is incorrect (has %d elements, but needs %d)"),
+			ArrayValue.Num(),
+			Property->ArrayDim);
+		if (OutFailReason)
+		{
+			*OutFailReason = FText::Format(
+				INVTEXT("JSON array size is incorrect (has {0} elements, but needs {1})"),
+				FText::AsNumber(ArrayValue.Num()),
+				FText::AsNumber(Property->ArrayDim));
+		}
+		return false;
+	}
+
+	if (Property->ArrayDim < ArrayValue.Num())
+	{
+		UE_LOG(
+			LogJsonDataAsset,
+			Warning,
+			TEXT("Ignoring excess properties when deserializing %s"),
+			*Property->GetAuthoredName());
+	}
+
+	// Read into native array
+	const int32 ItemsToRead = FMath::Clamp(ArrayValue.Num(), 0, Property->ArrayDim);
+	for (int Index = 0; Index != ItemsToRead; ++Index)
+	{
+		if (!ConvertScalarJsonValueToFPropertyWithContainer(
+				ArrayValue[Index],
+				Property,
+				StaticCast<char*>(OutValue) + Index * Property->ElementSize,
+				ContainerStruct,
+				Container,
+				VersionLoadingArchive,
+				CheckFlags,
+				SkipFlags,
+				bStrictMode,
+				OutFailReason))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool FJsonLibraryImportHelper::JsonAttributesToUStructWithContainer(
+	const TMap<FString, TSharedPtr<FJsonValue>>& JsonAttributes,
+	const UStruct* StructDefinition,
+	void* OutStruct,
+	const UStruct* ContainerStruct,
+	void* Container,
+	const FArchive& VersionLoadingArchive,
+	int64 CheckFlags,
+	int64 SkipFlags,
+	const bool bStrictMode,
+	FText* OutFailReason)
+{
+	DECLARE_CYCLE_STAT(
+		TEXT("JsonAttributesToUStructWithContainer"),
+		STAT_JsonAttributesToUStructWithContainer,
+		STATGROUP_OUUJsonData);
+
+	if (StructDefinition == FJsonObjectWrapper::StaticStruct())
+	{
+		// Just copy it into the object
+		FJsonObjectWrapper* ProxyObject = StaticCast<FJsonObjectWrapper*>(OutStruct);
+		ProxyObject->JsonObject = MakeShared<FJsonObject>();
+		ProxyObject->JsonObject->Values = JsonAttributes;
+		return true;
+	}
+
+	int32 NumUnclaimedProperties = JsonAttributes.Num();
+	if (NumUnclaimedProperties <= 0)
+	{
+		return true;
+	}
+
+	auto& ImportPlanCache = FJsonImportPlanCache::Get();
+	for (const auto& AttribEntry : JsonAttributes)
+	{
+		const auto PropertyPlan = ImportPlanCache.FindPropertyPlan(StructDefinition, AttribEntry.Key);
+		// Should we log a warning/error if we still have properties in the JSON data that aren't in the struct
+		// definition in strict mode?
+		if (PropertyPlan.ShouldImport(CheckFlags, SkipFlags) == false)
+		{
+			continue;
+		}
+		auto Property = PropertyPlan.Property;
+
+		const auto JsonValue = &AttribEntry.Value;
+		if (JsonValue->IsValid() && !(*JsonValue)->IsNull())
+		{
+			void* Value = Property->ContainerPtrToValuePtr<uint8>(OutStruct);
+			if (!JsonValueToFPropertyWithContainer(
+					*JsonValue,
+					Property,
+					Value,
+					ContainerStruct,
+					Container,
+					VersionLoadingArchive,
+					CheckFlags,
+					SkipFlags,
+					bStrictMode,
+					OutFailReason,
+					PropertyPlan.Type))
+			{
+				UE_LOG(
+					LogJsonDataAsset,
+					Error,
+					TEXT("JsonObjectToUStruct - Unable to import JSON value into property %s"),
+					*AttribEntry.Key);
+				if (OutFailReason)
+				{
+					*OutFailReason = FText::Format(
+						INVTEXT("Unable to import JSON value into property {0}\n{1}"),
+						FText::FromString(AttribEntry.Key),
+						*OutFailReason);
+				}
+				return false;
+			}
+		}
+	}
+
+	PostImportStruct(StructDefinition, OutStruct, VersionLoadingArchive);
+
+	return true;
+}
+
+// Streaming counterpart of FJsonLibraryImportHelper.
+// Reads tokens from a json reader and writes them directly into property memory without building a json DOM first.
+// Values that need random access to their json object (e.g. instanced objects with class names) or rarely used
+// conversions are read into a small DOM for just that value and passed on to the DOM based import helper.
+struct FJsonLibraryStreamingImportHelper
+{
+	FJsonLibraryStreamingImportHelper(TJsonReader<>& InReader, const FArchive& InVersionLoadingArchive) :
+		Reader(InReader), VersionLoadingArchive(InVersionLoadingArchive)
+	{
+	}
+
+	TJsonReader<>& Reader;
+	const FArchive& VersionLoadingArchive;
+	FJsonLibraryImportHelper DomHelper;
+
+	bool ReadNext(EJsonNotation& OutNotation)
+	{
+		if (Reader.ReadNext(OutNotation) == false || OutNotation == EJsonNotation::Error)
+		{
+			UE_LOG(LogJsonDataAsset, Error, TEXT("JsonReader - Failed to read json: %s"), *Reader.GetErrorMessage());
+			return false;
+		}
+		return true;
+	}
+
+	TSharedPtr<FJsonValue> ReadValue(EJsonNotation Notation)
+	{
+		switch (Notation)
+		{
+		case EJsonNotation::String: return MakeShared<FJsonValueString>(Reader.GetValueAsString());
+		case EJsonNotation::Number: return MakeShared<FJsonValueNumber>(Reader.GetValueAsNumber());
+		case EJsonNotation::Boolean: return MakeShared<FJsonValueBoolean>(Reader.GetValueAsBoolean());
+		case EJsonNotation::Null: return MakeShared<FJsonValueNull>();
+		case EJsonNotation::ArrayStart:
+		{
+			TArray<TSharedPtr<FJsonValue>> Values;
+			EJsonNotation ElementNotation;
+			while (ReadNext(OUT ElementNotation))
 			{
-				UE_LOG(
-					LogJsonDataAsset,
-					Error,
-					TEXT("JsonValueToUProperty - Unable to import JSON value that is neither string nor object into %s "
-						 "property %s"),
-					*StructProperty->Struct->GetAuthoredName(),
-					*Property->GetAuthoredName());
-				if (OutFailReason)
+				if (ElementNotation == EJsonNotation::ArrayEnd)
 				{
-					*OutFailReason = FText::Format(
-						INVTEXT("Unable to import JSON value that is neither string nor object into {0} property {1}"),
-						FText::FromString(StructProperty->Struct->GetAuthoredName()),
-						FText::FromString(Property->GetAuthoredName()));
+					return MakeShared<FJsonValueArray>(Values);
 				}
-				return false;
+
+				auto ElementValue = ReadValue(ElementNotation);
+				if (ElementValue.IsValid() == false)
+				{
+					return nullptr;
+				}
+				Values.Add(ElementValue);
 			}
+			return nullptr;
 		}
-		else if (FObjectProperty* ObjectProperty = CastField<FObjectProperty>(Property))
+		case EJsonNotation::ObjectStart:
 		{
-			if (JsonValue->Type == EJson::Object)
+			auto Object = MakeShared<FJsonObject>();
+			EJsonNotation FieldNotation;
+			while (ReadNext(OUT FieldNotation))
 			{
-				UObject* Outer = GetTransientPackage();
-				if (ContainerStruct->IsChildOf(UObject::StaticClass()))
+				if (FieldNotation == EJsonNotation::ObjectEnd)
 				{
-					Outer = StaticCast<UObject*>(Container);
+					return MakeShared<FJsonValueObject>(Object);
 				}
 
-				TSharedPtr<FJsonObject> Obj = JsonValue->AsObject();
-				UClass* PropertyClass = ObjectProperty->PropertyClass;
-
-				// If a specific subclass was stored in the JSON, use that instead of the PropertyClass
-				FString ClassString = Obj->GetStringField(ObjectClassNameKey);
-				Obj->RemoveField(ObjectClassNameKey);
-				if (!ClassString.IsEmpty())
+				// Copy the key before reading nested values overrides the reader's identifier.
+				FString FieldName = Reader.GetIdentifier();
+				auto FieldValue = ReadValue(FieldNotation);
+				if (FieldValue.IsValid() == false)
 				{
-					// ReSharper disable once CppTooWideScope
-					UClass* FoundClass = FPackageName::IsShortPackageName(ClassString)
-						? FindFirstObject<UClass>(*ClassString)
-						: UClass::TryFindTypeSlow<UClass>(ClassString);
-					if (FoundClass)
-					{
-						PropertyClass = FoundClass;
-
-						// GRIMLORE Start dlehn: If stored class does not match expected class, make sure to create the
-						// correct type
-						if (PropertyClass->IsChildOf(ObjectProperty->PropertyClass) == false
-							|| PropertyClass->HasAnyClassFlags(CLASS_Abstract))
-						{
-							UE_LOG(
-								LogJsonDataAsset,
-								Warning,
-								TEXT("JsonValueToUProperty - JSON object class %s saved in property %s on object %s is "
-									 "not valid for a property of type %s. "
-									 "Will try to load as default class instead."),
-								*PropertyClass->GetAuthoredName(),
-								*Property->GetAuthoredName(),
-								*Outer->GetPathName(),
-								*ObjectProperty->PropertyClass->GetAuthoredName());
-
-							PropertyClass = ObjectProperty->PropertyClass;
-						}
-					}
-					else
-					{
-						UE_LOG(
-							LogJsonDataAsset,
-							Warning,
-							TEXT("JsonValueToUProperty - JSON object class %s saved in property %s of type %s on "
-								 "object %s does not exist. Will try to load as default class instead."),
-							*ClassString,
-							*Property->GetAuthoredName(),
-							*ObjectProperty->PropertyClass->GetAuthoredName(),
-							*Outer->GetPathName());
-						// GRIMLORE End
-					}
+					return nullptr;
 				}
+				Object->SetField(FieldName, FieldValue);
+			}
+			return nullptr;
+		}
+		default: return nullptr;
+		}
+	}
 
-				// GRIMLORE Start dlehn: Property class may not be valid, so we will not create an object.
-				if (PropertyClass->HasAnyClassFlags(CLASS_Abstract))
-				{
-					UE_LOG(
-						LogJsonDataAsset,
-						Error,
-						TEXT("JsonValueToUProperty - Unable to import JSON object of class %s into property %s on "
-							 "object %s because the class is abstract."),
-						*PropertyClass->GetAuthoredName(),
-						*Property->GetAuthoredName(),
-						*Outer->GetPathName());
-					if (OutFailReason)
-					{
-						*OutFailReason = FText::Format(
-							INVTEXT("Unable to import JSON object of class {0} into property {1} because the class is "
-									"abstract.\n{2}"),
-							FText::FromString(PropertyClass->GetAuthoredName()),
-							FText::FromString(Property->GetAuthoredName()),
-							*OutFailReason);
-					}
+	bool SkipValue(EJsonNotation Notation)
+	{
+		if (Notation != EJsonNotation::ArrayStart && Notation != EJsonNotation::ObjectStart)
+		{
+			return true;
+		}
 
-					ObjectProperty->SetObjectPropertyValue(OutValue, nullptr);
+		int32 Depth = 1;
+		while (Depth > 0 && ReadNext(OUT Notation))
+		{
+			if (Notation == EJsonNotation::ArrayStart || Notation == EJsonNotation::ObjectStart)
+			{
+				++Depth;
+			}
+			else if (Notation == EJsonNotation::ArrayEnd || Notation == EJsonNotation::ObjectEnd)
+			{
+				--Depth;
+			}
+		}
+		return Depth == 0;
+	}
 
-					// We cannot return false here, otherwise loading of the object will be cancelled entirely.
-					return true;
-				}
-				// GRIMLORE End
+	// Read the current value into a json DOM value and import it with the DOM import helper.
+	bool ReadScalarValueViaDom(
+		EJsonNotation Notation,
+		FProperty* Property,
+		void* OutValue,
+		const UStruct* ContainerStruct,
+		void* Container,
+		int64 CheckFlags,
+		int64 SkipFlags)
+	{
+		const auto JsonValue = ReadValue(Notation);
+		if (JsonValue.IsValid() == false)
+		{
+			return false;
+		}
 
-				UObject* createdObj = StaticAllocateObject(
-					PropertyClass,
-					Outer,
-					NAME_None,
-					EObjectFlags::RF_NoFlags,
-					EInternalObjectFlags::None,
-					false);
-				(*PropertyClass->ClassConstructor)(
-					FObjectInitializer(createdObj, PropertyClass->ClassDefaultObject, EObjectInitializerOptions::None));
+		return DomHelper.ConvertScalarJsonValueToFPropertyWithContainer(
+			JsonValue,
+			Property,
+			OutValue,
+			ContainerStruct,
+			Container,
+			VersionLoadingArchive,
+			CheckFlags,
+			SkipFlags,
+			false,
+			nullptr);
+	}
 
-				ObjectProperty->SetObjectPropertyValue(OutValue, createdObj);
+	bool ImportEnumValueFromString(
+		const UEnum* Enum,
+		FProperty* Property,
+		FNumericProperty* UnderlyingProperty,
+		void* OutValue)
+	{
+		const FString& StrValue = Reader.GetValueAsString();
+		const int64 IntValue = FJsonEnumNameCache::Get().GetValueByAuthoredName(Enum, StrValue);
+		if (IntValue == INDEX_NONE)
+		{
+			UE_LOG(
+				LogJsonDataAsset,
+				Error,
+				TEXT("JsonValueToUProperty - Unable to import enum %s from string value %s for property %s"),
+				*Enum->CppType,
+				*StrValue,
+				*Property->GetAuthoredName());
+			return false;
+		}
+		UnderlyingProperty->SetIntPropertyValue(OutValue, IntValue);
+		return true;
+	}
 
-				check(Obj.IsValid()); // should not fail if Type == EJson::Object
-				if (!JsonAttributesToUStructWithContainer(
-						Obj->Values,
-						PropertyClass,
-						createdObj,
-						PropertyClass,
-						createdObj,
-						VersionLoadingArchive,
+	/** Streaming equivalent of FJsonLibraryImportHelper::ConvertScalarJsonValueToFPropertyWithContainer */
+	bool ReadScalarValueIntoProperty(
+		EJsonNotation Notation,
+		FProperty* Property,
+		void* OutValue,
+		const UStruct* ContainerStruct,
+		void* Container,
+		int64 CheckFlags,
+		int64 SkipFlags)
+	{
+		if (Notation == EJsonNotation::ObjectStart)
+		{
+			if (FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+			{
+				if (!ReadObjectIntoStruct(
+						StructProperty->Struct,
+						OutValue,
+						ContainerStruct,
+						Container,
 						CheckFlags & (~CPF_ParmFlags),
-						SkipFlags,
-						bStrictMode,
-						OutFailReason))
+						SkipFlags))
 				{
 					UE_LOG(
 						LogJsonDataAsset,
 						Error,
 						TEXT("JsonValueToUProperty - Unable to import JSON object into %s property %s"),
-						*PropertyClass->GetAuthoredName(),
+						*StructProperty->Struct->GetAuthoredName(),
 						*Property->GetAuthoredName());
-					if (OutFailReason)
-					{
-						*OutFailReason = FText::Format(
-							INVTEXT("Unable to import JSON object into {0} property {1}\n{2}"),
-							FText::FromString(PropertyClass->GetAuthoredName()),
-							FText::FromString(Property->GetAuthoredName()),
-							*OutFailReason);
-					}
 					return false;
 				}
+				return true;
 			}
-			else if (JsonValue->Type == EJson::String)
+			if (FMapProperty* MapProperty = CastField<FMapProperty>(Property))
 			{
-				// Default to expect a string for everything else
-				if (Property->ImportText_Direct(*JsonValue->AsString(), OutValue, nullptr, PPF_SerializedAsImportText)
-					== nullptr)
-				{
-					UE_LOG(
-						LogJsonDataAsset,
-						Error,
-						TEXT("JsonValueToUProperty - Unable to import JSON string into %s property %s"),
-						*ObjectProperty->PropertyClass->GetAuthoredName(),
-						*Property->GetAuthoredName());
-					if (OutFailReason)
-					{
-						*OutFailReason = FText::Format(
-							INVTEXT("Unable to import JSON string into {0} property {1}"),
-							FText::FromString(*ObjectProperty->PropertyClass->GetAuthoredName()),
-							FText::FromString(Property->GetAuthoredName()));
-					}
-					return false;
-				}
+				return ReadObjectIntoMap(MapProperty, OutValue, ContainerStruct, Container, CheckFlags, SkipFlags);
+			}
+			// Instanced objects need the class name before the object can be created, text objects are rare.
+			return ReadScalarValueViaDom(
+				Notation,
+				Property,
+				OutValue,
+				ContainerStruct,
+				Container,
+				CheckFlags,
+				SkipFlags);
+		}
 
-				// GRIMLORE Start jreich: Fixed hard refs to objects not resolving redirectors when loading
-				while (auto* Redirector = Cast<UObjectRedirector>(ObjectProperty->GetObjectPropertyValue(OutValue)))
-				{
-					ObjectProperty->SetObjectPropertyValue(OutValue, Redirector->DestinationObject);
-				}
-				// GRIMLORE End
+		if (Notation == EJsonNotation::ArrayStart)
+		{
+			if (FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+			{
+				return ReadArrayIntoArray(ArrayProperty, OutValue, ContainerStruct, Container, CheckFlags, SkipFlags);
+			}
+			if (FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+			{
+				return ReadArrayIntoSet(SetProperty, OutValue, ContainerStruct, Container, CheckFlags, SkipFlags);
+			}
+			return ReadScalarValueViaDom(
+				Notation,
+				Property,
+				OutValue,
+				ContainerStruct,
+				Container,
+				CheckFlags,
+				SkipFlags);
+		}
+
+		// Fast paths for the most common scalar types. Everything else uses the DOM conversion with a single value.
+		if (FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+		{
+			if (Notation == EJsonNotation::String)
+			{
+				return ImportEnumValueFromString(
+					EnumProperty->GetEnum(),
+					Property,
+					EnumProperty->GetUnderlyingProperty(),
+					OutValue);
+			}
+			if (Notation == EJsonNotation::Number)
+			{
+				EnumProperty->GetUnderlyingProperty()->SetIntPropertyValue(
+					OutValue,
+					StaticCast<int64>(Reader.GetValueAsNumber()));
+				return true;
+			}
+		}
+		else if (FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property))
+		{
+			if (NumericProperty->IsEnum() && Notation == EJsonNotation::String)
+			{
+				return ImportEnumValueFromString(
+					NumericProperty->GetIntPropertyEnum(),
+					Property,
+					NumericProperty,
+					OutValue);
+			}
+			if (NumericProperty->IsFloatingPoint() && Notation == EJsonNotation::Number)
+			{
+				NumericProperty->SetFloatingPointPropertyValue(OutValue, Reader.GetValueAsNumber());
+				return true;
+			}
+			if (NumericProperty->IsInteger() && Notation == EJsonNotation::Number)
+			{
+				NumericProperty->SetIntPropertyValue(OutValue, static_cast<int64>(Reader.GetValueAsNumber()));
+				return true;
+			}
+			if (NumericProperty->IsInteger() && Notation == EJsonNotation::String)
+			{
+				// parse string -> int64 ourselves so we don't lose any precision going through double
+				NumericProperty->SetIntPropertyValue(OutValue, FCString::Atoi64(*Reader.GetValueAsString()));
+				return true;
+			}
+		}
+		else if (FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+		{
+			if (Notation == EJsonNotation::Boolean)
+			{
+				BoolProperty->SetPropertyValue(OutValue, Reader.GetValueAsBoolean());
+				return true;
+			}
+		}
+		else if (FStrProperty* StringProperty = CastField<FStrProperty>(Property))
+		{
+			if (Notation == EJsonNotation::String)
+			{
+				StringProperty->SetPropertyValue(OutValue, Reader.GetValueAsString());
+				return true;
+			}
+		}
+		else if (FTextProperty* TextProperty = CastField<FTextProperty>(Property))
+		{
+			if (Notation == EJsonNotation::String)
+			{
+				// assume this string is already localized, so import as invariant
+				TextProperty->SetPropertyValue(OutValue, FText::FromString(Reader.GetValueAsString()));
+				return true;
 			}
 		}
-		// GRIMLORE Start dlehn: Fixed interface properties not resolving redirectors when loading
-		else if (FInterfaceProperty* InterfaceProperty = CastField<FInterfaceProperty>(Property))
+		else if (FObjectProperty* ObjectProperty = CastField<FObjectProperty>(Property))
 		{
-			if (JsonValue->Type == EJson::String)
+			if (Notation == EJsonNotation::String)
 			{
-				const auto StringValue = JsonValue->AsString();
-				const TCHAR* Buffer = *StringValue;
-				UObject* TargetObject = nullptr;
-				if (FObjectPropertyBase::ParseObjectPropertyValue(
-						InterfaceProperty,
-						nullptr,
-						UObject::StaticClass(),
-						PPF_SerializedAsImportText,
-						Buffer,
-						TargetObject)
-					== false)
+				const FString& StringValue = Reader.GetValueAsString();
+				if (Property->ImportText_Direct(*StringValue, OutValue, nullptr, PPF_SerializedAsImportText) == nullptr)
 				{
 					UE_LOG(
 						LogJsonDataAsset,
 						Error,
 						TEXT("JsonValueToUProperty - Unable to import JSON string into %s property %s"),
-						*InterfaceProperty->InterfaceClass->GetAuthoredName(),
+						*ObjectProperty->PropertyClass->GetAuthoredName(),
 						*Property->GetAuthoredName());
-					if (OutFailReason)
-					{
-						*OutFailReason = FText::Format(
-							INVTEXT("Unable to import JSON string into {0} property {1}"),
-							FText::FromString(*InterfaceProperty->InterfaceClass->GetAuthoredName()),
-							FText::FromString(Property->GetAuthoredName()));
-					}
 					return false;
 				}
 
-				while (auto* Redirector = Cast<UObjectRedirector>(TargetObject))
-				{
-					TargetObject = Redirector->DestinationObject;
-				}
-
-				FScriptInterface LoadedValue;
-				if (TargetObject)
-				{
-					if (TargetObject->GetClass()->ImplementsInterface(InterfaceProperty->InterfaceClass))
-					{
-						LoadedValue.SetObject(TargetObject);
-						LoadedValue.SetInterface(TargetObject->GetInterfaceAddress(InterfaceProperty->InterfaceClass));
-					}
-					else
-					{
-						UE_LOG(
-							LogJsonDataAsset,
-							Error,
-							TEXT("JsonValueToUProperty - Unable to import JSON string into %s property %s because "
-								 "target object '%s' does not implement required interface."),
-							*InterfaceProperty->InterfaceClass->GetAuthoredName(),
-							*Property->GetAuthoredName(),
-							*TargetObject->GetPathName());
-						if (OutFailReason)
-						{
-							*OutFailReason = FText::Format(
-								INVTEXT("Unable to import JSON string into {0} property {1} because target object '%s' "
-										"does not implement required interface"),
-								FText::FromString(InterfaceProperty->InterfaceClass->GetAuthoredName()),
-								FText::FromString(Property->GetAuthoredName()),
-								FText::FromString(TargetObject->GetPathName()));
-						}
-
-						// Don't return false here, that is not a fatal error.
-					}
-				}
-
-				InterfaceProperty->SetPropertyValue(OutValue, LoadedValue);
-			}
-			else
-			{
-				UE_LOG(
-					LogJsonDataAsset,
-					Error,
-					TEXT("JsonValueToUProperty - Unable to import JSON string into %s property %s because we expect "
-						 "interface pointers to be serialized as a string."),
-					*InterfaceProperty->InterfaceClass->GetAuthoredName(),
-					*Property->GetAuthoredName());
-				if (OutFailReason)
+				// GRIMLORE Start jreich: Fixed hard refs to objects not resolving redirectors when loading
+				while (auto* Redirector = Cast<UObjectRedirector>(ObjectProperty->GetObjectPropertyValue(OutValue)))
 				{
-					*OutFailReason = FText::Format(
-						INVTEXT("Unable to import JSON string into {0} property {1} because we expect interface "
-								"pointers to be serialized as a string."),
-						FText::FromString(*InterfaceProperty->InterfaceClass->GetAuthoredName()),
-						FText::FromString(Property->GetAuthoredName()));
+					ObjectProperty->SetObjectPropertyValue(OutValue, Redirector->DestinationObject);
 				}
-				return false;
+				// GRIMLORE End
+				return true;
 			}
 		}
-		// GRIMLORE End
-		else
+		else if (
+			Notation == EJsonNotation::String && Property->IsA<FStructProperty>() == false
+			&& Property->IsA<FInterfaceProperty>() == false && Property->IsA<FArrayProperty>() == false
+			&& Property->IsA<FMapProperty>() == false && Property->IsA<FSetProperty>() == false)
 		{
-			// Default to expect a string for everything else
-			if (Property->ImportText_Direct(*JsonValue->AsString(), OutValue, nullptr, PPF_SerializedAsImportText)
+			// Default to expect a string for everything else (names, soft object paths, etc)
+			if (Property->ImportText_Direct(*Reader.GetValueAsString(), OutValue, nullptr, PPF_SerializedAsImportText)
 				== nullptr)
 			{
 				UE_LOG(
@@ -1623,327 +2783,412 @@ struct FJsonLibraryImportHelper
 					Error,
 					TEXT("JsonValueToUProperty - Unable to import JSON string into property %s"),
 					*Property->GetAuthoredName());
-				if (OutFailReason)
-				{
-					*OutFailReason = FText::Format(
-						INVTEXT("Unable to import JSON string into property {0}"),
-						FText::FromString(Property->GetAuthoredName()));
-				}
 				return false;
 			}
+			return true;
 		}
 
-		return true;
+		return ReadScalarValueViaDom(Notation, Property, OutValue, ContainerStruct, Container, CheckFlags, SkipFlags);
 	}
-};
 
-bool FJsonLibraryImportHelper::JsonValueToFPropertyWithContainer(
-	const TSharedPtr<FJsonValue>& JsonValue,
-	FProperty* Property,
-	void* OutValue,
-	const UStruct* ContainerStruct,
-	void* Container,
-	const FArchive& VersionLoadingArchive,
-	int64 CheckFlags,
-	int64 SkipFlags,
-	const bool bStrictMode,
-	FText* OutFailReason)
-{
-	if (!JsonValue.IsValid())
+	bool ReadArrayIntoArray(
+		FArrayProperty* ArrayProperty,
+		void* OutValue,
+		const UStruct* ContainerStruct,
+		void* Container,
+		int64 CheckFlags,
+		int64 SkipFlags)
 	{
-		UE_LOG(LogJsonDataAsset, Error, TEXT("JsonValueToUProperty - Invalid JSON value"));
-		if (OutFailReason)
+		FScriptArrayHelper Helper(ArrayProperty, OutValue);
+
+		// Re-use existing elements like TArray::SetNum would, so null elements keep their previous value.
+		int32 NumElements = 0;
+		EJsonNotation Notation;
+		while (ReadNext(OUT Notation))
 		{
-			*OutFailReason = INVTEXT("Invalid JSON value");
+			if (Notation == EJsonNotation::ArrayEnd)
+			{
+				Helper.Resize(NumElements);
+				return true;
+			}
+
+			const int32 ElementIndex = NumElements++;
+			if (ElementIndex >= Helper.Num())
+			{
+				Helper.AddValue();
+			}
+
+			if (Notation == EJsonNotation::Null)
+			{
+				continue;
+			}
+
+			if (!ReadValueIntoProperty(
+					Notation,
+					ArrayProperty->Inner,
+					Helper.GetRawPtr(ElementIndex),
+					ContainerStruct,
+					Container,
+					CheckFlags & (~CPF_ParmFlags),
+					SkipFlags))
+			{
+				UE_LOG(
+					LogJsonDataAsset,
+					Error,
+					TEXT("JsonValueToUProperty - Unable to import Array element %d for property %s"),
+					ElementIndex,
+					*ArrayProperty->GetAuthoredName());
+				return false;
+			}
 		}
 		return false;
 	}
 
-	const bool bArrayOrSetProperty = Property->IsA<FArrayProperty>() || Property->IsA<FSetProperty>();
-	const bool bJsonArray = JsonValue->Type == EJson::Array;
-
-	if (!bJsonArray)
+	bool ReadArrayIntoSet(
+		FSetProperty* SetProperty,
+		void* OutValue,
+		const UStruct* ContainerStruct,
+		void* Container,
+		int64 CheckFlags,
+		int64 SkipFlags)
 	{
-		if (bArrayOrSetProperty)
+		FScriptSetHelper Helper(SetProperty, OutValue);
+		Helper.EmptyElements();
+
+		int32 ElementIndex = 0;
+		EJsonNotation Notation;
+		while (ReadNext(OUT Notation))
 		{
-			UE_LOG(LogJsonDataAsset, Error, TEXT("JsonValueToUProperty - Expecting JSON array"));
-			if (OutFailReason)
+			if (Notation == EJsonNotation::ArrayEnd)
 			{
-				*OutFailReason = INVTEXT("Expecting JSON array");
+				Helper.Rehash();
+				return true;
 			}
-			return false;
-		}
 
-		if (Property->ArrayDim != 1)
-		{
-			if (bStrictMode)
+			if (Notation == EJsonNotation::Null)
+			{
+				++ElementIndex;
+				continue;
+			}
+
+			const int32 NewIndex = Helper.AddDefaultValue_Invalid_NeedsRehash();
+			if (!ReadValueIntoProperty(
+					Notation,
+					SetProperty->ElementProp,
+					Helper.GetElementPtr(NewIndex),
+					ContainerStruct,
+					Container,
+					CheckFlags & (~CPF_ParmFlags),
+					SkipFlags))
 			{
 				UE_LOG(
 					LogJsonDataAsset,
 					Error,
-					TEXT("JsonValueToUProperty - Property %s is not an array but has %d elements"),
-					*Property->GetAuthoredName(),
-					Property->ArrayDim);
-				if (OutFailReason)
-				{
-					*OutFailReason = FText::Format(
-						INVTEXT("Property {0} is not an array but has {1} elements"),
-						FText::FromString(Property->GetAuthoredName()),
-						FText::AsNumber(Property->ArrayDim));
-				}
+					TEXT("JsonValueToUProperty - Unable to import Set element %d for property %s"),
+					ElementIndex,
+					*SetProperty->GetAuthoredName());
 				return false;
 			}
-
-			UE_LOG(
-				LogJsonDataAsset,
-				Warning,
-				TEXT("Ignoring excess properties when deserializing %s"),
-				*Property->GetAuthoredName());
+			++ElementIndex;
 		}
-
-		return ConvertScalarJsonValueToFPropertyWithContainer(
-			JsonValue,
-			Property,
-			OutValue,
-			ContainerStruct,
-			Container,
-			VersionLoadingArchive,
-			CheckFlags,
-			SkipFlags,
-			bStrictMode,
-			OutFailReason);
+		return false;
 	}
 
-	// In practice, the ArrayDim == 1 check ought to be redundant, since nested arrays of FProperties are not
-	// supported
-	if (bArrayOrSetProperty && Property->ArrayDim == 1)
+	bool ReadObjectIntoMap(
+		FMapProperty* MapProperty,
+		void* OutValue,
+		const UStruct* ContainerStruct,
+		void* Container,
+		int64 CheckFlags,
+		int64 SkipFlags)
 	{
-		// Read into TArray
-		return ConvertScalarJsonValueToFPropertyWithContainer(
-			JsonValue,
-			Property,
-			OutValue,
-			ContainerStruct,
-			Container,
-			VersionLoadingArchive,
-			CheckFlags,
-			SkipFlags,
-			bStrictMode,
-			OutFailReason);
-	}
-
-	// We're deserializing a JSON array
-	const auto& ArrayValue = JsonValue->AsArray();
+		FScriptMapHelper Helper(MapProperty, OutValue);
+		Helper.EmptyValues();
+
+		// Keys are imported into a temporary value first, so duplicate keys can be detected before adding a pair.
+		// The map stays hashed the whole time, because FindMapIndexWithKey and FindOrAdd rely on it.
+		FProperty* KeyProp = MapProperty->KeyProp;
+		void* TempKey = FMemory::Malloc(KeyProp->GetSize(), KeyProp->GetMinAlignment());
+		KeyProp->InitializeValue(TempKey);
+		ON_SCOPE_EXIT
+		{
+			KeyProp->DestroyValue(TempKey);
+			FMemory::Free(TempKey);
+		};
 
-	// GRIMLORE Start dlehn: Manually handle import for gameplay tag containers because the unreal ones don't
-	// properly implement it.
-	if (const auto StructProperty = CastField<FStructProperty>(Property))
-	{
-		if (StructProperty->Struct->IsChildOf(FGameplayTagContainer::StaticStruct()))
+		EJsonNotation Notation;
+		while (ReadNext(OUT Notation))
 		{
-			auto& TagContainer = *static_cast<FGameplayTagContainer*>(OutValue);
-			TagContainer.Reset();
-			const auto& JsonArray = JsonValue->AsArray();
-			for (const auto& JsonTagValue : JsonArray)
+			if (Notation == EJsonNotation::ObjectEnd)
 			{
-				FGameplayTag Tag;
-				if (UGameplayTagsManager::Get().ImportSingleGameplayTag(Tag, FName(*JsonTagValue->AsString()), true)
-					&& Tag.IsValid())
-				{
-					TagContainer.AddTag(Tag);
-				}
+				return true;
+			}
+
+			if (Notation == EJsonNotation::Null)
+			{
+				continue;
+			}
+
+			// Copy the key before reading nested values overrides the reader's identifier.
+			const FString Key = Reader.GetIdentifier();
+			KeyProp->ClearValue(TempKey);
+
+			// Keys are always strings, so we can use the DOM helper without allocating more than a single value.
+			if (!DomHelper.JsonValueToFPropertyWithContainer(
+					MakeShared<FJsonValueString>(Key),
+					KeyProp,
+					TempKey,
+					ContainerStruct,
+					Container,
+					VersionLoadingArchive,
+					CheckFlags & (~CPF_ParmFlags),
+					SkipFlags,
+					false,
+					nullptr))
+			{
+				UE_LOG(
+					LogJsonDataAsset,
+					Error,
+					TEXT("JsonValueToUProperty - Unable to import Map element %s key for property %s"),
+					*Key,
+					*MapProperty->GetAuthoredName());
+				return false;
+			}
+
+			// Duplicate keys (in the file or after key conversion) overwrite the previous value like in the DOM path.
+			void* ValuePtr = nullptr;
+			const int32 ExistingIndex = Helper.FindMapIndexWithKey(TempKey);
+			if (ExistingIndex != INDEX_NONE)
+			{
+				ValuePtr = Helper.GetValuePtr(ExistingIndex);
+				MapProperty->ValueProp->ClearValue(ValuePtr);
+			}
+			else
+			{
+				ValuePtr = Helper.FindOrAdd(TempKey);
+			}
+
+			if (!ReadValueIntoProperty(
+					Notation,
+					MapProperty->ValueProp,
+					ValuePtr,
+					ContainerStruct,
+					Container,
+					CheckFlags & (~CPF_ParmFlags),
+					SkipFlags))
+			{
+				UE_LOG(
+					LogJsonDataAsset,
+					Error,
+					TEXT("JsonValueToUProperty - Unable to import Map element %s value for property %s"),
+					*Key,
+					*MapProperty->GetAuthoredName());
+				return false;
 			}
-			return true;
 		}
+		return false;
 	}
-	// GRIMLORE End
 
-	if (bStrictMode && (Property->ArrayDim != ArrayValue.Num()))
+	/** Streaming equivalent of FJsonLibraryImportHelper::JsonValueToFPropertyWithContainer */
+	bool ReadValueIntoProperty(
+		EJsonNotation Notation,
+		FProperty* Property,
+		void* OutValue,
+		const UStruct* ContainerStruct,
+		void* Container,
+		int64 CheckFlags,
+		int64 SkipFlags,
+		EJsonImportPropertyType PropertyType = EJsonImportPropertyType::Unknown)
 	{
-		UE_LOG(
-			LogJsonDataAsset,
-			Error,
-			TEXT("JsonValueToUProperty - JSON array size is incorrect (has %d elements, but needs %d)"),
-			ArrayValue.Num(),
-			Property->ArrayDim);
-		if (OutFailReason)
+		if (PropertyType == EJsonImportPropertyType::Unknown)
 		{
-			*OutFailReason = FText::Format(
-				INVTEXT("JSON array size is incorrect (has {0} elements, but needs {1})"),
-				FText::AsNumber(ArrayValue.Num()),
-				FText::AsNumber(Property->ArrayDim));
+			PropertyType = GetJsonImportPropertyType(Property);
 		}
-		return false;
-	}
+		const bool bArrayOrSetProperty =
+			PropertyType == EJsonImportPropertyType::Array || PropertyType == EJsonImportPropertyType::Set;
+		if (Notation != EJsonNotation::ArrayStart)
+		{
+			if (bArrayOrSetProperty)
+			{
+				UE_LOG(LogJsonDataAsset, Error, TEXT("JsonValueToUProperty - Expecting JSON array"));
+				return false;
+			}
 
-	if (Property->ArrayDim < ArrayValue.Num())
-	{
-		UE_LOG(
-			LogJsonDataAsset,
-			Warning,
-			TEXT("Ignoring excess properties when deserializing %s"),
-			*Property->GetAuthoredName());
-	}
+			if (Property->ArrayDim != 1)
+			{
+				UE_LOG(
+					LogJsonDataAsset,
+					Warning,
+					TEXT("Ignoring excess properties when deserializing %s"),
+					*Property->GetAuthoredName());
+			}
 
-	// Read into native array
-	const int32 ItemsToRead = FMath::Clamp(ArrayValue.Num(), 0, Property->ArrayDim);
-	for (int Index = 0; Index != ItemsToRead; ++Index)
-	{
-		if (!ConvertScalarJsonValueToFPropertyWithContainer(
-				ArrayValue[Index],
+			return ReadScalarValueIntoProperty(
+				Notation,
 				Property,
-				StaticCast<char*>(OutValue) + Index * Property->ElementSize,
+				OutValue,
 				ContainerStruct,
 				Container,
-				VersionLoadingArchive,
 				CheckFlags,
-				SkipFlags,
-				bStrictMode,
-				OutFailReason))
+				SkipFlags);
+		}
+
+		if (bArrayOrSetProperty && Property->ArrayDim == 1)
+		{
+			// Read into TArray / TSet
+			return ReadScalarValueIntoProperty(
+				Notation,
+				Property,
+				OutValue,
+				ContainerStruct,
+				Container,
+				CheckFlags,
+				SkipFlags);
+		}
+
+		// GRIMLORE Start dlehn: Manually handle import for gameplay tag containers because the unreal ones don't
+		// properly implement it.
+		if (PropertyType == EJsonImportPropertyType::GameplayTagContainer)
 		{
+			auto& TagContainer = *static_cast<FGameplayTagContainer*>(OutValue);
+			DomHelper.GameplayTagBuffer.Reset();
+			while (ReadNext(OUT Notation))
+			{
+				if (Notation == EJsonNotation::ArrayEnd)
+				{
+					DomHelper.MoveGameplayTagBufferToContainer(TagContainer);
+					return true;
+				}
+
+				if (Notation == EJsonNotation::String)
+				{
+					DomHelper.AddToGameplayTagBuffer(Reader.GetValueAsString());
+				}
+				else if (SkipValue(Notation) == false)
+				{
+					TagContainer.Reset();
+					return false;
+				}
+			}
+			TagContainer.Reset();
 			return false;
 		}
-	}
-	return true;
-}
+		// GRIMLORE End
 
-bool FJsonLibraryImportHelper::JsonAttributesToUStructWithContainer(
-	const TMap<FString, TSharedPtr<FJsonValue>>& JsonAttributes,
-	const UStruct* StructDefinition,
-	void* OutStruct,
-	const UStruct* ContainerStruct,
-	void* Container,
-	const FArchive& VersionLoadingArchive,
-	int64 CheckFlags,
-	int64 SkipFlags,
-	const bool bStrictMode,
-	FText* OutFailReason)
-{
-	DECLARE_CYCLE_STAT(
-		TEXT("JsonAttributesToUStructWithContainer"),
-		STAT_JsonAttributesToUStructWithContainer,
-		STATGROUP_OUUJsonData);
+		// Read into native array
+		int32 Index = 0;
+		while (ReadNext(OUT Notation))
+		{
+			if (Notation == EJsonNotation::ArrayEnd)
+			{
+				return true;
+			}
 
-	if (StructDefinition == FJsonObjectWrapper::StaticStruct())
-	{
-		// Just copy it into the object
-		FJsonObjectWrapper* ProxyObject = StaticCast<FJsonObjectWrapper*>(OutStruct);
-		ProxyObject->JsonObject = MakeShared<FJsonObject>();
-		ProxyObject->JsonObject->Values = JsonAttributes;
-		return true;
+			if (Index >= Property->ArrayDim)
+			{
+				UE_CLOG(
+					Index == Property->ArrayDim,
+					LogJsonDataAsset,
+					Warning,
+					TEXT("Ignoring excess properties when deserializing %s"),
+					*Property->GetAuthoredName());
+				if (SkipValue(Notation) == false)
+				{
+					return false;
+				}
+			}
+			else if (!ReadScalarValueIntoProperty(
+						 Notation,
+						 Property,
+						 StaticCast<char*>(OutValue) + Index * Property->ElementSize,
+						 ContainerStruct,
+						 Container,
+						 CheckFlags,
+						 SkipFlags))
+			{
+				return false;
+			}
+			++Index;
+		}
+		return false;
 	}
 
-	int32 NumUnclaimedProperties = JsonAttributes.Num();
-	if (NumUnclaimedProperties <= 0)
+	/**
+	 * Streaming equivalent of FJsonLibraryImportHelper::JsonAttributesToUStructWithContainer.
+	 * Expects the object start token to be consumed already and reads everything up to and including the object end.
+	 */
+	bool ReadObjectIntoStruct(
+		const UStruct* StructDefinition,
+		void* OutStruct,
+		const UStruct* ContainerStruct,
+		void* Container,
+		int64 CheckFlags,
+		int64 SkipFlags)
 	{
-		return true;
-	}
+		DECLARE_CYCLE_STAT(TEXT("ReadObjectIntoStruct"), STAT_ReadObjectIntoStruct, STATGROUP_OUUJsonData);
 
-	// GRIMLORE Start dlehn: Check property redirects in case the property has been renamed.
-	for (const auto& AttribEntry : JsonAttributes)
-	{
-		const FName PropertyName(AttribEntry.Key);
-		auto Property = StructDefinition->FindPropertyByName(PropertyName);
-		if (Property == nullptr)
+		if (StructDefinition == FJsonObjectWrapper::StaticStruct())
 		{
-			const FCoreRedirectObjectName
-				RedirectName(PropertyName, StructDefinition->GetFName(), StructDefinition->GetOutermost()->GetFName());
-
-			const auto RedirectedName =
-				FCoreRedirects::GetRedirectedName(ECoreRedirectFlags::Type_Property, RedirectName);
-			if (RedirectedName.ObjectName != PropertyName)
+			// Just copy it into the object
+			const auto JsonValue = ReadValue(EJsonNotation::ObjectStart);
+			if (JsonValue.IsValid() == false)
 			{
-				Property = StructDefinition->FindPropertyByName(RedirectedName.ObjectName);
+				return false;
 			}
+			FJsonObjectWrapper* ProxyObject = StaticCast<FJsonObjectWrapper*>(OutStruct);
+			ProxyObject->JsonObject = JsonValue->AsObject();
+			return true;
 		}
 
-		if (Property == nullptr)
+		auto& ImportPlanCache = FJsonImportPlanCache::Get();
+		bool bHasAnyAttributes = false;
+		EJsonNotation Notation;
+		while (ReadNext(OUT Notation))
 		{
-			// Should we log a warning/error if we still have properties in the JSON data that aren't in the struct
-			// definition in strict mode?
-			continue;
-		}
+			if (Notation == EJsonNotation::ObjectEnd)
+			{
+				// Same as the DOM import: Empty json objects don't trigger any post import fixups.
+				if (bHasAnyAttributes)
+				{
+					FJsonLibraryImportHelper::PostImportStruct(StructDefinition, OutStruct, VersionLoadingArchive);
+				}
+				return true;
+			}
+			bHasAnyAttributes = true;
 
-		if (CheckFlags != 0 && !Property->HasAnyPropertyFlags(CheckFlags))
-		{
-			continue;
-		}
-		if (Property->HasAnyPropertyFlags(SkipFlags))
-		{
-			continue;
-		}
+			const auto PropertyPlan = ImportPlanCache.FindPropertyPlan(StructDefinition, Reader.GetIdentifier());
+			if (PropertyPlan.ShouldImport(CheckFlags, SkipFlags) == false || Notation == EJsonNotation::Null)
+			{
+				if (SkipValue(Notation) == false)
+				{
+					return false;
+				}
+				continue;
+			}
 
-		const auto JsonValue = &AttribEntry.Value;
-		if (JsonValue->IsValid() && !(*JsonValue)->IsNull())
-		{
+			const auto Property = PropertyPlan.Property;
 			void* Value = Property->ContainerPtrToValuePtr<uint8>(OutStruct);
-			if (!JsonValueToFPropertyWithContainer(
-					*JsonValue,
+			if (!ReadValueIntoProperty(
+					Notation,
 					Property,
 					Value,
 					ContainerStruct,
 					Container,
-					VersionLoadingArchive,
 					CheckFlags,
 					SkipFlags,
-					bStrictMode,
-					OutFailReason))
+					PropertyPlan.Type))
 			{
 				UE_LOG(
 					LogJsonDataAsset,
 					Error,
 					TEXT("JsonObjectToUStruct - Unable to import JSON value into property %s"),
-					*PropertyName.ToString());
-				if (OutFailReason)
-				{
-					*OutFailReason = FText::Format(
-						INVTEXT("Unable to import JSON value into property {0}\n{1}"),
-						FText::FromName(PropertyName),
-						*OutFailReason);
-				}
+					*Property->GetName());
 				return false;
 			}
 		}
+		return false;
 	}
-	// GRIMLORE End
-
-	// GRIMLORE Start dlehn: Ensure objects loaded from json receive PostLoad calls
-	if (StructDefinition->IsChildOf<UObject>())
-	{
-		const auto pObject = StaticCast<UObject*>(OutStruct);
-		if (pObject->HasAnyFlags(RF_NeedPostLoad) == false)
-		{
-			pObject->SetFlags(RF_NeedPostLoad);
-			pObject->ConditionalPostLoad();
-		}
-	}
-	else if (const auto ScriptStruct = Cast<UScriptStruct>(StructDefinition))
-	{
-		if (const auto StructOps = ScriptStruct->GetCppStructOps())
-		{
-			if (StructOps->HasPostSerialize())
-			{
-				StructOps->PostSerialize(VersionLoadingArchive, OutStruct);
-			}
-		}
-	}
-
-	// Fix for gameplay tag container's ImportTextItem function not being called because they have no matching
-	// ExportTextItem function. So we have to manually do what they would otherwise do during import.
-	if (StructDefinition->IsChildOf(FGameplayTagContainer::StaticStruct()))
-	{
-		auto& TagContainer = *StaticCast<FGameplayTagContainer*>(OutStruct);
-		// Remove invalid tags. Unfortunately there is no public function to remove all invalid tags at once.
-		while (TagContainer.RemoveTag(FGameplayTag(), true))
-		{
-		}
-		TagContainer.FillParentTags();
-	}
-
-	// GRIMLORE End
-
-	return true;
-}
+};
 
 TSharedPtr<FJsonObject> UOUUJsonLibrary::UStructToJsonObject(
 	const void* Data,
@@ -2031,6 +3276,40 @@ FString UOUUJsonLibrary::UObjectToJsonString(
 	return Helper.ConvertObjectToString<bPrettyPrint>(Object);
 }
 
+bool UOUUJsonLibrary::UObjectToJsonWriter(
+	const UObject* Object,
+	TJsonWriter<UTF8CHAR>& JsonWriter,
+	const FString& Identifier,
+	FOUUJsonLibraryObjectFilter SubObjectFilter,
+	int64 CheckFlags /* = 0 */,
+	int64 SkipFlags /* = 0 */)
+{
+	DECLARE_CYCLE_STAT(TEXT("UOUUJsonLibrary::UObjectToJsonWriter"), STAT_UObjectToJsonWriter, STATGROUP_OUUJsonData);
+
+	if (!IsValid(Object))
+	{
+		UE_LOG(LogJsonDataAsset, Error, TEXT("Failed to write invalid object TO Json writer"));
+		return false;
+	}
+
+	FJsonLibraryStreamingExportHelper Helper{JsonWriter, CheckFlags, SkipFlags, SubObjectFilter};
+	if (!Helper.WriteObject(Identifier.IsEmpty() ? nullptr : &Identifier, Object))
+	{
+		UE_LOG(LogJsonDataAsset, Warning, TEXT("UObjectToJsonWriter - Unable to write out JSON"));
+		return false;
+	}
+	return true;
+}
+
+void UOUUJsonLibrary::JsonValueToJsonWriter(
+	const TSharedPtr<FJsonValue>& JsonValue,
+	TJsonWriter<UTF8CHAR>& JsonWriter,
+	const FString& Identifier)
+{
+	FJsonLibraryStreamingExportHelper Helper{JsonWriter, 0, 0, FOUUJsonLibraryObjectFilter()};
+	Helper.WriteJsonValue(Identifier.IsEmpty() ? nullptr : &Identifier, JsonValue);
+}
+
 bool UOUUJsonLibrary::JsonStringToUObject(
 	UObject* Object,
 	FString String,
@@ -2059,8 +3338,26 @@ bool UOUUJsonLibrary::JsonStringToUObject(
 		return false;
 	}
 
-	TSharedPtr<FJsonObject> JsonObject;
 	const TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(String);
+	if (OUU::JsonData::Runtime::Private::CVar_StreamingImport.GetValueOnAnyThread())
+	{
+		// Stream the json tokens directly into the object instead of building a json object first.
+		EJsonNotation Notation;
+		if (!JsonReader->ReadNext(OUT Notation) || Notation != EJsonNotation::ObjectStart)
+		{
+			UE_LOG(LogJsonDataAsset, Warning, TEXT("JsonStringToUObject - Unable to parse json=[%s]"), *String);
+			return false;
+		}
+
+		if (!JsonReaderToUStruct(*JsonReader, Object->GetClass(), Object, VersionLoadingArchive, CheckFlags, SkipFlags))
+		{
+			UE_LOG(LogJsonDataAsset, Warning, TEXT("JsonStringToUObject - Unable to deserialize. json=[%s]"), *String);
+			return false;
+		}
+		return true;
+	}
+
+	TSharedPtr<FJsonObject> JsonObject;
 	if (!FJsonSerializer::Deserialize(JsonReader, JsonObject) || !JsonObject.IsValid())
 	{
 		UE_LOG(LogJsonDataAsset, Warning, TEXT("JsonStringToUObject - Unable to parse json=[%s]"), *String);
@@ -2126,3 +3423,42 @@ bool UOUUJsonLibrary::JsonObjectToUObject(
 		CheckFlags,
 		SkipFlags);
 }
+
+bool UOUUJsonLibrary::JsonReaderToUStruct(
+	TJsonReader<>& JsonReader,
+	const UStruct* StructDefinition,
+	void* OutStruct,
+	const FArchive& VersionLoadingArchive,
+	int64 CheckFlags /* = 0 */,
+	int64 SkipFlags /* = 0 */)
+{
+	DECLARE_CYCLE_STAT(TEXT("UOUUJsonLibrary::JsonReaderToUStruct"), STAT_JsonReaderToUStruct, STATGROUP_OUUJsonData);
+
+	if (!OutStruct || !IsValid(StructDefinition))
+	{
+		UE_LOG(LogJsonDataAsset, Error, TEXT("Failed to convert json tokens into invalid struct"));
+		return false;
+	}
+
+	FJsonLibraryStreamingImportHelper Helper{JsonReader, VersionLoadingArchive};
+	if (!Helper.ReadObjectIntoStruct(StructDefinition, OutStruct, StructDefinition, OutStruct, CheckFlags, SkipFlags))
+	{
+		UE_LOG(LogJsonDataAsset, Warning, TEXT("JsonReaderToUStruct - Unable to deserialize json tokens."));
+		return false;
+	}
+	return true;
+}
+
+TSharedPtr<FJsonValue> UOUUJsonLibrary::JsonReaderToJsonValue(TJsonReader<>& JsonReader, EJsonNotation CurrentNotation)
+{
+	FArchive UnusedArchive;
+	FJsonLibraryStreamingImportHelper Helper{JsonReader, UnusedArchive};
+	return Helper.ReadValue(CurrentNotation);
+}
+
+bool UOUUJsonLibrary::SkipJsonReaderValue(TJsonReader<>& JsonReader, EJsonNotation CurrentNotation)
+{
+	FArchive UnusedArchive;
+	FJsonLibraryStreamingImportHelper Helper{JsonReader, UnusedArchive};
+	return Helper.SkipValue(CurrentNotation);
+}
@@ -0,0 +1,400 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#include "JsonLibraryImportPlan.h"
+
+#include "GameplayTagContainer.h"
+#include "GameplayTagsModule.h"
+#include "Misc/ScopeRWLock.h"
+#include "UObject/CoreRedirects.h"
+#include "UObject/Package.h"
+#include "UObject/TextProperty.h"
+#include "UObject/UObjectGlobals.h"
+
+#if WITH_EDITOR
+	#include "Engine/UserDefinedEnum.h"
+	#include "Kismet2/EnumEditorUtils.h"
+	#include "Misc/ITransaction.h"
+#endif
+
+namespace OUU::JsonData::Runtime::Private
+{
+	EJsonImportPropertyType GetJsonImportPropertyType(const FProperty* Property)
+	{
+		if (Property == nullptr)
+		{
+			return EJsonImportPropertyType::Unknown;
+		}
+		if (Property->IsA<FEnumProperty>())
+		{
+			return EJsonImportPropertyType::Enum;
+		}
+		if (Property->IsA<FNumericProperty>())
+		{
+			return EJsonImportPropertyType::Numeric;
+		}
+		if (Property->IsA<FBoolProperty>())
+		{
+			return EJsonImportPropertyType::Bool;
+		}
+		if (Property->IsA<FStrProperty>())
+		{
+			return EJsonImportPropertyType::String;
+		}
+		if (Property->IsA<FTextProperty>())
+		{
+			return EJsonImportPropertyType::Text;
+		}
+		if (Property->IsA<FArrayProperty>())
+		{
+			return EJsonImportPropertyType::Array;
+		}
+		if (Property->IsA<FSetProperty>())
+		{
+			return EJsonImportPropertyType::Set;
+		}
+		if (Property->IsA<FMapProperty>())
+		{
+			return EJsonImportPropertyType::Map;
+		}
+		if (const auto StructProperty = CastField<const FStructProperty>(Property))
+		{
+			return StructProperty->Struct->IsChildOf(FGameplayTagContainer::StaticStruct())
+				? EJsonImportPropertyType::GameplayTagContainer
+				: EJsonImportPropertyType::Struct;
+		}
+		if (Property->IsA<FObjectProperty>())
+		{
+			return EJsonImportPropertyType::Object;
+		}
+		if (Property->IsA<FInterfaceProperty>())
+		{
+			return EJsonImportPropertyType::Interface;
+		}
+		return EJsonImportPropertyType::Other;
+	}
+
+	FJsonImportPlanCache& FJsonImportPlanCache::Get()
+	{
+		static FJsonImportPlanCache Instance;
+		return Instance;
+	}
+
+	void FJsonImportPlanCache::Startup()
+	{
+		ReloadCompleteHandle =
+			FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([this](EReloadCompleteReason) { Invalidate(); });
+#if WITH_EDITOR
+		ObjectsReinstancedHandle = FCoreUObjectDelegates::OnObjectsReinstanced.AddLambda(
+			[this](const TMap<UObject*, UObject*>&) { Invalidate(); });
+#endif
+		PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddRaw(
+			this,
+			&FJsonImportPlanCache::HandlePostGarbageCollect);
+	}
+
+	void FJsonImportPlanCache::Shutdown()
+	{
+		FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+#if WITH_EDITOR
+		FCoreUObjectDelegates::OnObjectsReinstanced.Remove(ObjectsReinstancedHandle);
+#endif
+		FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+		Invalidate();
+	}
+
+	FJsonImportPropertyPlan FJsonImportPlanCache::FindPropertyPlan(
+		const UStruct* StructDefinition,
+		const FString& JsonKey)
+	{
+		const FObjectKey StructKey(StructDefinition);
+		{
+			FReadScopeLock ReadLock(Lock);
+			if (const auto* StructPlan = PlansByStruct.Find(StructKey))
+			{
+				if (StructPlan->ChildPropertiesHead == StructDefinition->ChildProperties)
+				{
+					if (const auto* PropertyPlan = StructPlan->PropertiesByJsonKey.Find(JsonKey))
+					{
+						return *PropertyPlan;
+					}
+				}
+			}
+		}
+
+		const auto PropertyPlan = ResolvePropertyPlan(StructDefinition, JsonKey);
+
+		FWriteScopeLock WriteLock(Lock);
+		auto& StructPlan = PlansByStruct.FindOrAdd(StructKey);
+		if (StructPlan.ChildPropertiesHead != StructDefinition->ChildProperties)
+		{
+			// Struct was regenerated since the plan was cached. All cached properties may be stale.
+			StructPlan.ChildPropertiesHead = StructDefinition->ChildProperties;
+			StructPlan.PropertiesByJsonKey.Reset();
+		}
+		StructPlan.PropertiesByJsonKey.Add(JsonKey, PropertyPlan);
+		return PropertyPlan;
+	}
+
+	void FJsonImportPlanCache::Invalidate()
+	{
+		FWriteScopeLock WriteLock(Lock);
+		PlansByStruct.Empty();
+	}
+
+	FJsonImportPropertyPlan FJsonImportPlanCache::ResolvePropertyPlan(
+		const UStruct* StructDefinition,
+		const FString& JsonKey)
+	{
+		const FName PropertyName(JsonKey);
+
+		// GRIMLORE Start dlehn: Check property redirects in case the property has been renamed.
+		auto Property = StructDefinition->FindPropertyByName(PropertyName);
+		if (Property == nullptr)
+		{
+			const FCoreRedirectObjectName
+				RedirectName(PropertyName, StructDefinition->GetFName(), StructDefinition->GetOutermost()->GetFName());
+
+			const auto RedirectedName =
+				FCoreRedirects::GetRedirectedName(ECoreRedirectFlags::Type_Property, RedirectName);
+			if (RedirectedName.ObjectName != PropertyName)
+			{
+				Property = StructDefinition->FindPropertyByName(RedirectedName.ObjectName);
+			}
+		}
+		// GRIMLORE End
+
+		FJsonImportPropertyPlan Result;
+		Result.Property = Property;
+		Result.Type = GetJsonImportPropertyType(Property);
+		return Result;
+	}
+
+	void FJsonImportPlanCache::HandlePostGarbageCollect()
+	{
+		// Drop plans of structs that were garbage collected (e.g. unloaded blueprint classes).
+		FWriteScopeLock WriteLock(Lock);
+		for (auto It = PlansByStruct.CreateIterator(); It; ++It)
+		{
+			if (It->Key.ResolveObjectPtr() == nullptr)
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+#if WITH_EDITOR
+	// User defined enums are changed in-place by the enum editor, which only notifies its own listeners.
+	class FJsonEnumNameCache::FUserDefinedEnumListener : public FEnumEditorUtils::INotifyOnEnumChanged
+	{
+	public:
+		explicit FUserDefinedEnumListener(FJsonEnumNameCache& InCache) : Cache(InCache) {}
+
+		// - FEnumEditorUtils::INotifyOnEnumChanged
+		void PreChange(const UUserDefinedEnum* Enum, FEnumEditorUtils::EEnumEditorChangeInfo Info) override {}
+		void PostChange(const UUserDefinedEnum* Enum, FEnumEditorUtils::EEnumEditorChangeInfo Info) override
+		{
+			Cache.Invalidate(Enum);
+		}
+		// --
+
+	private:
+		FJsonEnumNameCache& Cache;
+	};
+#endif
+
+	FJsonEnumNameCache::~FJsonEnumNameCache() = default;
+
+	FJsonEnumNameCache& FJsonEnumNameCache::Get()
+	{
+		static FJsonEnumNameCache Instance;
+		return Instance;
+	}
+
+	void FJsonEnumNameCache::Startup()
+	{
+		ReloadCompleteHandle =
+			FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([this](EReloadCompleteReason) { Invalidate(); });
+#if WITH_EDITOR
+		ObjectsReinstancedHandle = FCoreUObjectDelegates::OnObjectsReinstanced.AddLambda(
+			[this](const TMap<UObject*, UObject*>&) { Invalidate(); });
+		// Enums may be changed in-place. Invalidate after the change, so lookups in between can't cache old names.
+		ObjectTransactedHandle = FCoreUObjectDelegates::OnObjectTransacted.AddLambda(
+			[this](UObject* Object, const FTransactionObjectEvent&) {
+				if (const auto* Enum = Cast<UEnum>(Object))
+				{
+					Invalidate(Enum);
+				}
+			});
+		ObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddLambda(
+			[this](UObject* Object, const FPropertyChangedEvent&) {
+				if (const auto* Enum = Cast<UEnum>(Object))
+				{
+					Invalidate(Enum);
+				}
+			});
+		UserDefinedEnumListener = MakeUnique<FUserDefinedEnumListener>(*this);
+#endif
+		PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddRaw(
+			this,
+			&FJsonEnumNameCache::HandlePostGarbageCollect);
+	}
+
+	void FJsonEnumNameCache::Shutdown()
+	{
+		FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+#if WITH_EDITOR
+		FCoreUObjectDelegates::OnObjectsReinstanced.Remove(ObjectsReinstancedHandle);
+		FCoreUObjectDelegates::OnObjectTransacted.Remove(ObjectTransactedHandle);
+		FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(ObjectPropertyChangedHandle);
+		UserDefinedEnumListener.Reset();
+#endif
+		FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+		Invalidate();
+	}
+
+	int64 FJsonEnumNameCache::GetValueByAuthoredName(const UEnum* Enum, const FString& Name)
+	{
+		const FObjectKey EnumKey(Enum);
+		{
+			FReadScopeLock ReadLock(Lock);
+			if (const auto* EnumNames = NamesByEnum.Find(EnumKey))
+			{
+				if (const auto* pValue = EnumNames->ValuesByAuthoredName.Find(Name))
+				{
+					return *pValue;
+				}
+			}
+		}
+
+		const int64 Value = Enum->GetValueByName(FName(*Name), EGetByNameFlags::CheckAuthoredName);
+		if (Value == INDEX_NONE)
+			return Value;
+
+		FWriteScopeLock WriteLock(Lock);
+		NamesByEnum.FindOrAdd(EnumKey).ValuesByAuthoredName.Add(Name, Value);
+		return Value;
+	}
+
+	FString FJsonEnumNameCache::GetAuthoredNameStringByValue(const UEnum* Enum, int64 Value)
+	{
+		const FObjectKey EnumKey(Enum);
+		{
+			FReadScopeLock ReadLock(Lock);
+			if (const auto* EnumNames = NamesByEnum.Find(EnumKey))
+			{
+				if (const auto* pName = EnumNames->AuthoredNamesByValue.Find(Value))
+				{
+					return *pName;
+				}
+			}
+		}
+
+		FString Name = Enum->GetAuthoredNameStringByValue(Value);
+		if (Enum->IsValidEnumValue(Value) == false)
+			return Name;
+
+		FWriteScopeLock WriteLock(Lock);
+		NamesByEnum.FindOrAdd(EnumKey).AuthoredNamesByValue.Add(Value, Name);
+		return Name;
+	}
+
+	void FJsonEnumNameCache::Invalidate()
+	{
+		FWriteScopeLock WriteLock(Lock);
+		NamesByEnum.Empty();
+	}
+
+	void FJsonEnumNameCache::Invalidate(const UEnum* Enum)
+	{
+		FWriteScopeLock WriteLock(Lock);
+		NamesByEnum.Remove(FObjectKey(Enum));
+	}
+
+	void FJsonEnumNameCache::HandlePostGarbageCollect()
+	{
+		// Drop names of enums that were garbage collected (e.g. unloaded user defined enums).
+		FWriteScopeLock WriteLock(Lock);
+		for (auto It = NamesByEnum.CreateIterator(); It; ++It)
+		{
+			if (It->Key.ResolveObjectPtr() == nullptr)
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	FJsonGameplayTagCache& FJsonGameplayTagCache::Get()
+	{
+		static FJsonGameplayTagCache Instance;
+		return Instance;
+	}
+
+	void FJsonGameplayTagCache::Startup()
+	{
+		// Tags may be added, removed or redirected, e.g. when tag sources are edited in the editor.
+		TagTreeChangedHandle = IGameplayTagsModule::OnGameplayTagTreeChanged.AddRaw(
+			this,
+			&FJsonGameplayTagCache::Invalidate);
+	}
+
+	void FJsonGameplayTagCache::Shutdown()
+	{
+		IGameplayTagsModule::OnGameplayTagTreeChanged.Remove(TagTreeChangedHandle);
+		Invalidate();
+	}
+
+	void FJsonGameplayTagCache::BeginSession()
+	{
+		FWriteScopeLock WriteLock(Lock);
+		++SessionDepth;
+	}
+
+	void FJsonGameplayTagCache::EndSession()
+	{
+		FWriteScopeLock WriteLock(Lock);
+		if (ensure(SessionDepth > 0))
+		{
+			--SessionDepth;
+		}
+		if (SessionDepth == 0)
+		{
+			TagsByString.Empty();
+		}
+	}
+
+	bool FJsonGameplayTagCache::Find(const FString& TagString, FGameplayTag& OutTag) const
+	{
+		FReadScopeLock ReadLock(Lock);
+		if (const auto* pTag = TagsByString.Find(TagString))
+		{
+			OutTag = *pTag;
+			return true;
+		}
+		return false;
+	}
+
+	void FJsonGameplayTagCache::Add(const FString& TagString, const FGameplayTag& Tag)
+	{
+		FWriteScopeLock WriteLock(Lock);
+		if (SessionDepth > 0)
+		{
+			TagsByString.Add(TagString, Tag);
+		}
+	}
+
+	void FJsonGameplayTagCache::Invalidate()
+	{
+		FWriteScopeLock WriteLock(Lock);
+		TagsByString.Empty();
+	}
+
+	FScopedJsonGameplayTagSession::FScopedJsonGameplayTagSession()
+	{
+		FJsonGameplayTagCache::Get().BeginSession();
+	}
+
+	FScopedJsonGameplayTagSession::~FScopedJsonGameplayTagSession()
+	{
+		FJsonGameplayTagCache::Get().EndSession();
+	}
+} // namespace OUU::JsonData::Runtime::Private
@@ -0,0 +1,194 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "GameplayTagContainer.h"
+#include "UObject/ObjectKey.h"
+
+// Cached reflection lookups for json import and export.
+// Not in Public/ folder, because they should only be used directly by the system internal code.
+namespace OUU::JsonData::Runtime::Private
+{
+	/**
+	 * Coarse property type that is relevant for json import dispatch.
+	 * Precomputed once per property, so imports don't have to repeat the CastField / IsChildOf checks.
+	 */
+	enum class EJsonImportPropertyType : uint8
+	{
+		Unknown,
+		Other,
+		Enum,
+		Numeric,
+		Bool,
+		String,
+		Text,
+		Array,
+		Set,
+		Map,
+		Struct,
+		GameplayTagContainer,
+		Object,
+		Interface
+	};
+
+	EJsonImportPropertyType GetJsonImportPropertyType(const FProperty* Property);
+
+	/** Resolved import target of a single json key. */
+	struct FJsonImportPropertyPlan
+	{
+		// Null if the key does not match any property of the struct (also after applying property redirects).
+		FProperty* Property = nullptr;
+		EJsonImportPropertyType Type = EJsonImportPropertyType::Unknown;
+
+		bool IsArrayOrSet() const
+		{
+			return Type == EJsonImportPropertyType::Array || Type == EJsonImportPropertyType::Set;
+		}
+
+		// Same filter that the json importers apply to every property.
+		bool ShouldImport(int64 CheckFlags, int64 SkipFlags) const
+		{
+			return Property && (CheckFlags == 0 || Property->HasAnyPropertyFlags(CheckFlags))
+				&& Property->HasAnyPropertyFlags(SkipFlags) == false;
+		}
+	};
+
+	/**
+	 * Per-struct cache that maps json keys to resolved properties ("import plans").
+	 * Keys are resolved lazily on first use including property redirects. Misses are cached as well, so
+	 * outdated keys in json files don't cause repeated redirect lookups.
+	 * The cache is flushed on hot reload and whenever objects are reinstanced (e.g. after blueprint compilation).
+	 * Thread-safe.
+	 */
+	class FJsonImportPlanCache
+	{
+	public:
+		static FJsonImportPlanCache& Get();
+
+		// Register for reload/reinstancing delegates. Called by the runtime module.
+		void Startup();
+		void Shutdown();
+
+		FJsonImportPropertyPlan FindPropertyPlan(const UStruct* StructDefinition, const FString& JsonKey);
+
+		void Invalidate();
+
+	private:
+		struct FStructImportPlan
+		{
+			// Head of the property list at the time of caching.
+			// Used to detect user defined structs that were regenerated in-place.
+			const FField* ChildPropertiesHead = nullptr;
+			TMap<FString, FJsonImportPropertyPlan> PropertiesByJsonKey;
+		};
+
+		FRWLock Lock;
+		TMap<FObjectKey, FStructImportPlan> PlansByStruct;
+
+		FDelegateHandle ReloadCompleteHandle;
+		FDelegateHandle ObjectsReinstancedHandle;
+		FDelegateHandle PostGarbageCollectHandle;
+
+		static FJsonImportPropertyPlan ResolvePropertyPlan(const UStruct* StructDefinition, const FString& JsonKey);
+
+		void HandlePostGarbageCollect();
+	};
+
+	/**
+	 * Per-enum cache of the lookups between authored enum names and values.
+	 * UEnum::GetValueByName needs a new FName per call and both directions scan all enum entries. The results of the
+	 * UEnum functions are cached lazily, so the lookup semantics stay the same, including core redirects. Misses are
+	 * not cached, because they are keyed by arbitrary strings and values from json files.
+	 * The cache is flushed on hot reload, whenever objects are reinstanced and after an enum was changed in the editor
+	 * (user defined enum edits, property changes, undo and redo). Thread-safe.
+	 */
+	class FJsonEnumNameCache
+	{
+	public:
+		~FJsonEnumNameCache();
+
+		static FJsonEnumNameCache& Get();
+
+		// Register for reload/reinstancing delegates. Called by the runtime module.
+		void Startup();
+		void Shutdown();
+
+		// Same as UEnum::GetValueByName(FName(*Name), EGetByNameFlags::CheckAuthoredName)
+		int64 GetValueByAuthoredName(const UEnum* Enum, const FString& Name);
+
+		// Same as UEnum::GetAuthoredNameStringByValue(Value)
+		FString GetAuthoredNameStringByValue(const UEnum* Enum, int64 Value);
+
+		void Invalidate();
+		void Invalidate(const UEnum* Enum);
+
+	private:
+		struct FEnumNames
+		{
+			// Case insensitive like the FName comparison of UEnum::GetValueByName.
+			TMap<FString, int64> ValuesByAuthoredName;
+			TMap<int64, FString> AuthoredNamesByValue;
+		};
+
+		FRWLock Lock;
+		TMap<FObjectKey, FEnumNames> NamesByEnum;
+
+		FDelegateHandle ReloadCompleteHandle;
+		FDelegateHandle ObjectsReinstancedHandle;
+		FDelegateHandle ObjectTransactedHandle;
+		FDelegateHandle ObjectPropertyChangedHandle;
+		FDelegateHandle PostGarbageCollectHandle;
+
+#if WITH_EDITOR
+		class FUserDefinedEnumListener;
+		TUniquePtr<FUserDefinedEnumListener> UserDefinedEnumListener;
+#endif
+
+		void HandlePostGarbageCollect();
+	};
+
+	/**
+	 * Gameplay tags by tag string that were resolved during an import session (see FScopedJsonGameplayTagSession).
+	 * Tag heavy data repeats the same tags in many assets and each ImportSingleGameplayTag call also checks redirects.
+	 * Invalid tag strings are cached as invalid tags, which is bounded by the session. Outside of sessions, tags are
+	 * only cached per JsonObjectToUStruct call.
+	 * The cache is flushed when the gameplay tag tree changes and when the outermost session ends. Thread-safe.
+	 * Exported for the specs in OUUJsonDataTests.
+	 */
+	class OUUJSONDATARUNTIME_API FJsonGameplayTagCache
+	{
+	public:
+		static FJsonGameplayTagCache& Get();
+
+		// Register for gameplay tag tree changes. Called by the runtime module.
+		void Startup();
+		void Shutdown();
+
+		void BeginSession();
+		void EndSession();
+
+		// Returns false if no session is active or the tag string was not resolved in the current session yet.
+		bool Find(const FString& TagString, FGameplayTag& OutTag) const;
+		// Does nothing outside of sessions.
+		void Add(const FString& TagString, const FGameplayTag& Tag);
+
+		void Invalidate();
+
+	private:
+		mutable FRWLock Lock;
+		int32 SessionDepth = 0;
+		TMap<FString, FGameplayTag> TagsByString;
+
+		FDelegateHandle TagTreeChangedHandle;
+	};
+
+	// Shares resolved gameplay tags between all imports in the scope, e.g. ImportAllAssets or reimports of changed
+	// files.
+	struct OUUJSONDATARUNTIME_API FScopedJsonGameplayTagSession
+	{
+		FScopedJsonGameplayTagSession();
+		~FScopedJsonGameplayTagSession();
+	};
+} // namespace OUU::JsonData::Runtime::Private
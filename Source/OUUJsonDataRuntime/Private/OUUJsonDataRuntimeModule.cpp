@@ -2,7 +2,11 @@
 
 #include "CoreMinimal.h"
 
+#include "JsonDataAssetDiffReimport.h"
+#include "JsonDataAssetResidency.h"
 #include "JsonDataAssetSubsystem.h"
+#include "JsonDataSourceControlQueue.h"
+#include "JsonLibraryImportPlan.h"
 #include "LogJsonDataAsset.h"
 #include "Modules/ModuleManager.h"
 
@@ -13,6 +17,22 @@ class FOUUJsonDataRuntimeModule : public IModuleInterface
 	{
 		FCoreDelegates::OnPostEngineInit.AddLambda(
 			[]() { UJsonDataAssetSubsystem::Get().AddPluginDataRoot(TEXT("OUUJsonDataAssets")); });
+
+		OUU::JsonData::Runtime::Private::FJsonImportPlanCache::Get().Startup();
+		OUU::JsonData::Runtime::Private::FJsonEnumNameCache::Get().Startup();
+		OUU::JsonData::Runtime::Private::FJsonGameplayTagCache::Get().Startup();
+		OUU::JsonData::Runtime::Private::FJsonDataAssetResidencyManager::Get().Startup();
+		OUU::JsonData::Runtime::Private::FJsonDataAssetDiffReimport::Get().Startup();
+	}
+
+	void ShutdownModule() override
+	{
+		OUU::JsonData::Runtime::Private::FJsonImportPlanCache::Get().Shutdown();
+		OUU::JsonData::Runtime::Private::FJsonEnumNameCache::Get().Shutdown();
+		OUU::JsonData::Runtime::Private::FJsonGameplayTagCache::Get().Shutdown();
+		OUU::JsonData::Runtime::Private::FJsonDataAssetResidencyManager::Get().Shutdown();
+		OUU::JsonData::Runtime::Private::FJsonDataAssetDiffReimport::Get().Shutdown();
+		OUU::JsonData::Runtime::Private::FJsonDataSourceControlQueue::Get().Shutdown();
 	}
 };
 
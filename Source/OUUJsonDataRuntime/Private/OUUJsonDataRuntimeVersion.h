@@ -24,6 +24,9 @@ public:
 		// Any future version introduced here will invalidate the json data cache and lead to a full cache refresh.
 		TimeAndVersionCacheInvalidation,
 
+		// This change replaced the time stamp based cache invalidation with content hashes (see import manifest).
+		ContentHashCacheInvalidation,
+
 		// -----<new versions can be added above this line>-------------------------------------------------
 		VersionPlusOne,
 		LatestVersion = VersionPlusOne - 1
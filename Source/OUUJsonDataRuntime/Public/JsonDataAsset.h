@@ -20,6 +20,7 @@
 #include "JsonDataAsset.generated.h"
 
 class UJsonDataAsset;
+struct FJsonDataCustomVersions;
 
 UENUM(BlueprintType)
 enum class EJsonDataAccessMode : uint8
@@ -42,6 +43,7 @@ class OUUJSONDATARUNTIME_API UJsonDataAsset : public UDataAsset
 	GENERATED_BODY()
 
 	friend FJsonDataAssetPath;
+	friend class UJsonDataAssetSubsystem;
 
 	using FCustomVersionMap = TMap<FGuid, int32>;
 
@@ -93,6 +95,12 @@ public:
 
 	/**
 	 * Called after importing json data, can be used to fix up legacy data.
+	 * JsonObject always contains the complete data.
+	 * By default, every import resets all properties to class defaults first. If ouu.JsonData.DiffReimport is
+	 * enabled, reimports only reset and import the properties whose json values changed since the last import. All
+	 * other properties keep their current values, including values that a previous PostLoadJsonData() call derived
+	 * from the json data. Overrides must produce the same result in both cases, e.g. by writing derived properties
+	 * unconditionally instead of only adjusting values that are still at their class defaults.
 	 * @returns if loading was successful.
 	 */
 	virtual bool PostLoadJsonData(
@@ -109,9 +117,42 @@ protected:
 	// during any Serialize calls will be added automatically)
 	virtual TSet<FGuid> GetAdditionalRelevantCustomVersions() const;
 
+	/**
+	 * If true, property data is streamed from the json file directly into this object without building a json object
+	 * first. This greatly reduces memory usage and import time for large assets, but PostLoadJsonData() receives an
+	 * empty json object. Only return true if your PostLoadJsonData() override does not rely on the json object.
+	 * Only affects synchronous loads. Async and bulk imports parse the file on worker threads.
+	 */
+	virtual bool SupportsStreamingImport() const;
+
 private:
 	// The actual loading logic that takes care of creating UObjects. Call the json property load internally.
 	static UJsonDataAsset* LoadJsonDataAsset_Internal(FJsonDataAssetPath Path, UJsonDataAsset* ExistingDataAsset);
+	// Game thread part of loading: Create (or re-use) the UObject and import an already parsed json object into it.
+	// If StreamingJsonString is set, JsonObject only contains the header fields and property data is streamed.
+	static UJsonDataAsset* ImportJsonDataAsset_Internal(
+		const FJsonDataAssetPath& Path,
+		UJsonDataAsset* ExistingDataAsset,
+		const FString& LoadPath,
+		const TSharedRef<FJsonObject>& JsonObject,
+		const FString* StreamingJsonString = nullptr);
+	// Streaming variant of ImportJson(): Header fields are read from HeaderObject, 'Data' is streamed from JsonString.
+	bool ImportJsonStreamed(
+		const TSharedRef<FJsonObject>& HeaderObject,
+		const FString& JsonString,
+		bool bCheckClassMatches);
+	// Validate the header information (class, engine version) shared by all import variants.
+	bool ImportJsonHeader(
+		const FJsonObject& JsonObject,
+		bool bCheckClassMatches,
+		FEngineVersion& OutEngineVersion,
+		FJsonDataCustomVersions& OutCustomVersions);
+	// Reset object properties to class defaults before importing property data.
+	void ResetToClassDefaults();
+	// Header information (class, engine version, custom versions) shared by all export variants.
+	TSharedRef<FJsonObject> ExportJsonHeader() const;
+	// Streaming variant of ExportJsonFile() for cooked content: Writes all properties directly into the file.
+	bool ExportJsonFileStreamed(const FString& SavePath) const;
 	// Resolve a loaded object path, fixing up redirectors as required.
 	template <typename ObjectT = UObject>
 	static ObjectT* ResolveObjectPath(const FString& Path, const bool AllowLoading);
@@ -46,6 +46,19 @@ namespace OUU::JsonData::Runtime
 	OUUJSONDATARUNTIME_API bool ShouldWriteToCookedContent();
 	OUUJSONDATARUNTIME_API void CheckJsonPaths();
 
+	/**
+	 * Defers the source control operations of json file exports and deletes until the outermost scope ends.
+	 * They are then submitted as asynchronous multi-file operations. Use around bulk operations on json assets.
+	 * Operations outside of any scope are still collected until the end of the frame.
+	 */
+	struct OUUJSONDATARUNTIME_API FScopedSourceControlBatch
+	{
+		UE_NONCOPYABLE(FScopedSourceControlBatch);
+
+		FScopedSourceControlBatch();
+		~FScopedSourceControlBatch();
+	};
+
 	namespace Private
 	{
 		// not API exposed, because it's only for internal use
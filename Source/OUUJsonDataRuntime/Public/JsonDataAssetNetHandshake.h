@@ -0,0 +1,51 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Components/ActorComponent.h"
+
+#include "JsonDataAssetNetHandshake.generated.h"
+
+USTRUCT()
+struct FJsonDataAssetPathIndexChecksum
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	FName RootName;
+
+	UPROPERTY()
+	uint32 Checksum = 0;
+};
+
+/**
+ * Exchanges the checksums of the json data asset path index tables between server and client, so both peers know
+ * whether they can use fast net serialization (path indices) for the connection or if they have to fall back to
+ * serializing full paths (e.g. because the client has local mods).
+ * Automatically added to all remote player controllers on the server if fast net serialization is enabled.
+ */
+UCLASS()
+class OUUJSONDATARUNTIME_API UJsonDataAssetNetHandshakeComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UJsonDataAssetNetHandshakeComponent();
+
+	// - UActorComponent
+	void BeginPlay() override;
+	// --
+
+private:
+	UFUNCTION(Server, Reliable)
+	void ServerReceivePathIndexChecksums(const TArray<FJsonDataAssetPathIndexChecksum>& ClientChecksums);
+
+	UFUNCTION(Client, Reliable)
+	void ClientReceivePathIndexChecksums(const TArray<FJsonDataAssetPathIndexChecksum>& ServerChecksums);
+
+	static TArray<FJsonDataAssetPathIndexChecksum> GetLocalChecksums();
+	void StoreRemoteChecksums(const TArray<FJsonDataAssetPathIndexChecksum>& RemoteChecksums) const;
+};
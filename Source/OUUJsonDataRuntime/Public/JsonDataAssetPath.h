@@ -4,12 +4,15 @@
 
 #include "CoreMinimal.h"
 
+#include "Tasks/Task.h"
 #include "Templates/SubclassOf.h"
 
 #include "JsonDataAssetPath.generated.h"
 
 class UJsonDataAsset;
 
+DECLARE_DELEGATE_OneParam(FOnJsonDataAssetLoaded, UJsonDataAsset* /* LoadedAsset */);
+
 /**
  * Paths to json data assets.
  * This is the primary means by which references to json data content are serialized and resolved.
@@ -83,6 +86,16 @@ public:
 		PRAGMA_ENABLE_DEPRECATION_WARNINGS
 	}
 
+	/**
+	 * Try to resolve the path in memory, LOAD asset ASYNCHRONOUSLY if not found.
+	 * Reading and parsing the json file happens on a worker thread. Only object creation and property import are
+	 * performed on the game thread. Referenced assets are still resolved synchronously during property import.
+	 * The callback is always executed on the game thread. It receives nullptr if the asset failed to load.
+	 */
+	void LoadAsync(
+		FOnJsonDataAssetLoaded Callback,
+		UE::Tasks::ETaskPriority Priority = UE::Tasks::ETaskPriority::BackgroundNormal) const;
+
 	/** Try to resolve the path in memory, LOAD asset if not found. ALWAYS reload members from json source. */
 	UJsonDataAsset* ForceReload() const;
 
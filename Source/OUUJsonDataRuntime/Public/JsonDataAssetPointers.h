@@ -89,6 +89,11 @@ public:
 	/** Synchronously load (if necessary) and return the object represented by this pointer */
 	UJsonDataAsset* LoadSynchronous() const;
 
+	/** Asynchronously load (if necessary) the object represented by this pointer. Callback runs on game thread. */
+	void LoadAsync(
+		FOnJsonDataAssetLoaded Callback,
+		UE::Tasks::ETaskPriority Priority = UE::Tasks::ETaskPriority::BackgroundNormal) const;
+
 	bool ImportTextItem(const TCHAR*& Buffer, int32 PortFlags, UObject* Parent, FOutputDevice* ErrorText);
 	bool ExportTextItem(
 		FString& ValueStr,
@@ -171,6 +176,19 @@ public:
 		return Cast<T>(FSoftJsonDataAssetPtr::LoadSynchronous());
 	}
 
+	/** Asynchronously load (if necessary) the object represented by this pointer. Callback runs on game thread. */
+	template <typename = void>
+	void LoadAsync(
+		TDelegate<void(T*)> Callback,
+		UE::Tasks::ETaskPriority Priority = UE::Tasks::ETaskPriority::BackgroundNormal) const
+	{
+		FSoftJsonDataAssetPtr::LoadAsync(
+			FOnJsonDataAssetLoaded::CreateLambda([Callback = MoveTemp(Callback)](UJsonDataAsset* LoadedAsset) {
+				Callback.ExecuteIfBound(Cast<T>(LoadedAsset));
+			}),
+			Priority);
+	}
+
 	FORCEINLINE friend uint32 GetTypeHash(const TSoftJsonDataAssetPtr& Other)
 	{
 		return GetTypeHash(static_cast<const FSoftJsonDataAssetPtr&>(Other));
@@ -245,6 +263,10 @@ public:
 		{
 			HardReference = Path.LoadSynchronous();
 		}
+		else
+		{
+			NotifyAccessed(HardReference);
+		}
 
 		return HardReference;
 	}
@@ -307,6 +329,9 @@ private:
 	FJsonDataAssetPath Path;
 	UPROPERTY(Transient)
 	mutable UJsonDataAsset* HardReference = nullptr;
+
+	// Mark the asset as recently used for the residency budget (see ouu.JsonData.ResidencyBudgetMB).
+	static void NotifyAccessed(UJsonDataAsset* Asset);
 };
 
 OUU_DECLARE_JSON_DATA_ASSET_PTR_TRAITS(FJsonDataAssetPtr);
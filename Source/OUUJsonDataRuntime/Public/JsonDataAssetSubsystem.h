@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 
+#include "Containers/Ticker.h"
 #include "Engine.h"
 #include "JsonDataAsset.h"
 #include "JsonDataAssetPath.h"
@@ -11,7 +12,39 @@
 
 #include "JsonDataAssetSubsystem.generated.h"
 
+class AGameModeBase;
+class APlayerController;
 class ITargetPlatform;
+class UNetConnection;
+class UPackageMap;
+
+namespace OUU::JsonData::Runtime::Private
+{
+	class FJsonDataMetaDataCacheBinary;
+	class FJsonDataSourceWatcher;
+}
+
+// Asset registry tags of a json data asset (e.g. properties with AssetRegistrySearchable meta data).
+USTRUCT()
+struct FJsonDataAssetSearchableTags
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	TMap<FName, FString> Values;
+};
+
+// Json data assets that a json data asset references directly.
+USTRUCT()
+struct FJsonDataAssetDependencies
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	TArray<FJsonDataAssetPath> Paths;
+};
 
 USTRUCT()
 struct FJsonDataAssetPaths
@@ -21,6 +54,14 @@ struct FJsonDataAssetPaths
 public:
 	UPROPERTY()
 	TArray<FJsonDataAssetPath> Paths;
+
+	// Searchable tags of the assets with the same index in Paths.
+	UPROPERTY()
+	TArray<FJsonDataAssetSearchableTags> SearchableTags;
+
+	// Json data asset dependencies of the assets with the same index in Paths.
+	UPROPERTY()
+	TArray<FJsonDataAssetDependencies> Dependencies;
 };
 
 USTRUCT()
@@ -58,8 +99,17 @@ public:
 
 	/**
 	 * Serialize the given path over the network.
+	 * Uses fast net serialization (path indices) if the package map belongs to a connection whose remote peer has the
+	 * same path index table (see UJsonDataAssetNetHandshakeComponent) or if there is no connection.
 	 */
-	static void NetSerializePath(FJsonDataAssetPath& Path, FArchive& Ar);
+	static void NetSerializePath(FJsonDataAssetPath& Path, FArchive& Ar, UPackageMap* PackageMap = nullptr);
+
+	// Checksums of the path index table that is used for fast net serialization, per root.
+	const TMap<FName, uint32>& GetPathIndexChecksums() const { return PathIndexChecksumsByRoot; }
+
+	// Store the path index checksums of the remote peer of a connection. Enables fast net serialization for the
+	// connection if they match the local checksums.
+	void SetRemotePathIndexChecksums(UNetConnection* Connection, const TMap<FName, uint32>& RemoteChecksums);
 
 	/**
 	 * Import all .json into UJsonDataAssets.
@@ -69,19 +119,101 @@ public:
 	UFUNCTION()
 	void ImportAllAssets(bool bOnlyMissing);
 
+	/**
+	 * Import all .json files inside a package folder of a single root (e.g. /JsonData/Plugins/MyPlugin/Weapons) and
+	 * its subfolders. Same as ImportAllAssets, but leaves the files outside of the folder untouched.
+	 */
+	void ImportAssetsInFolder(const FString& PackageFolder, bool bOnlyMissing);
+
 	/**
 	 * Rescan all json data asset files on disk.
 	 */
 	void RescanAllAssets();
 
-	// Get all json data assets of the given class.
+	// Called after a json file was written by an asset export, so the source watcher does not reimport it.
+	void NotifySourceFileWritten(const FString& FilePath);
+
+	// Get all json data assets of the given class. Thread-safe.
 	UFUNCTION(BlueprintCallable)
 	TArray<FJsonDataAssetPath> GetJsonAssetsByClass(
 		TSoftClassPtr<UJsonDataAsset> Class,
 		const bool bSearchSubClasses = false) const;
 
+	/**
+	 * Get all json data assets of the given class without copying them. Game thread only.
+	 * Cooked builds build a contiguous list of all assets of the class (and its subclasses) when the class is first
+	 * queried, based on a class hierarchy index that is built once after startup. The editor caches the asset
+	 * registry results until the next json data asset is added, removed or renamed.
+	 * Lifetime: The view stays valid until the end of the current frame, also if json data assets are added while
+	 * iterating it (e.g. by loading assets that were not imported yet), or until the subsystem is deinitialized.
+	 * Don't store it beyond the current scope and don't pass it to other threads.
+	 */
+	TConstArrayView<FJsonDataAssetPath> GetJsonAssetsByClassView(
+		const FTopLevelAssetPath& ClassPath,
+		const bool bSearchSubClasses = false) const;
+
+	/**
+	 * Get all json data assets of the given class with a searchable tag value that matches the predicate, without
+	 * loading any of the assets. Tags are the values of properties that are marked with AssetRegistrySearchable meta
+	 * data. The editor queries the asset registry, cooked builds read them from the meta data cache.
+	 * Example - all weapons with Tier >= 3:
+	 *		FindJsonAssetsByTag(WeaponClass, true, "Tier", [](const FString& V) { return FCString::Atoi(*V) >= 3; })
+	 */
+	TArray<FJsonDataAssetPath> FindJsonAssetsByTag(
+		const FTopLevelAssetPath& ClassPath,
+		const bool bSearchSubClasses,
+		const FName& Tag,
+		TFunctionRef<bool(const FString& Value)> Predicate) const;
+
+	// Get all json data assets of the given class with the given searchable tag value, without loading any of them.
+	UFUNCTION(BlueprintCallable)
+	TArray<FJsonDataAssetPath> FindJsonAssetsByTagValue(
+		TSoftClassPtr<UJsonDataAsset> Class,
+		const FName Tag,
+		const FString& Value,
+		const bool bSearchSubClasses = false) const;
+
+	#if WITH_EDITOR
+	/**
+	 * Collect the searchable tags of an asset that are written to the meta data cache during cook: Only asset registry
+	 * tags of properties with AssetRegistrySearchable meta data, not any other tags the asset class may add.
+	 */
+	static void GetSearchableTags(const UJsonDataAsset& Asset, FJsonDataAssetSearchableTags& OutTags);
+	#endif
+
+	/**
+	 * Get a json data asset and all json data assets it references directly or indirectly, breadth first starting
+	 * with the asset itself. Cooked builds read the reference graph from the meta data cache, the editor queries the
+	 * asset registry. Returns an empty array if the asset is unknown.
+	 */
+	TArray<FJsonDataAssetPath> GetJsonDependencyClosure(const FJsonDataAssetPath& Path) const;
+
+	/**
+	 * Load a json data asset asynchronously: The source file is read and parsed on a worker thread, object creation
+	 * and property import happen on the game thread. Multiple requests for the same path are merged.
+	 * Prefer FJsonDataAssetPath::LoadAsync(), which skips the request if the asset is already loaded.
+	 */
+	void RequestAsyncLoad(
+		const FJsonDataAssetPath& Path,
+		FOnJsonDataAssetLoaded Callback,
+		UE::Tasks::ETaskPriority Priority = UE::Tasks::ETaskPriority::BackgroundNormal);
+
+	/**
+	 * Read and parse the json files of an asset and of all json data assets it depends on (see
+	 * GetJsonDependencyClosure) on worker threads, without creating any objects. Later loads of any of these assets,
+	 * e.g. LoadSynchronous() of the root or of a FJsonDataAssetPtr inside it, take the parsed json from memory.
+	 * Assets that are already loaded are skipped. Prefetched files that are not loaded within
+	 * ouu.JsonData.PrefetchLifetime seconds are dropped again.
+	 */
+	void PrefetchDependencyClosure(
+		const FJsonDataAssetPath& Path,
+		UE::Tasks::ETaskPriority Priority = UE::Tasks::ETaskPriority::BackgroundNormal);
+
 private:
-	void ImportAllAssets(const FName& RootName, bool bOnlyMissing);
+	// Import all .json files in the given directory (and its subdirectories) that belongs to the root.
+	void ImportAssetsInDirectory(const FName& RootName, const FString& JsonDir, bool bOnlyMissing);
+
+	void FinishAsyncLoad(const FJsonDataAssetPath& Path, UJsonDataAsset* LoadedAsset);
 
 public:
 	/**
@@ -139,6 +271,43 @@ private:
 
 	void PostEngineInit();
 
+	// Rebuild path lookups, checksums and net state after AllJsonDataAssetsByIndex changed.
+	void UpdatePathIndex();
+	// Insert/remove a single path into/from the sorted AllJsonDataAssetsByIndex. Returns false if nothing changed.
+	bool AddToPathIndex(const FName& PackagePath);
+	bool RemoveFromPathIndex(const FName& PackagePath);
+	/**
+	 * Add (true) or remove (false) paths to/from the path index. Peers that completed the handshake decode path indices
+	 * with the table they verified, so changes are deferred while any connection uses fast net serialization and
+	 * applied with the next call once none does (or by the next full rescan).
+	 */
+	void ApplyPathIndexChanges(const TMap<FName, bool>& PathIndexChanges);
+	bool IsFastNetSerializationInUse() const;
+	// Reimport changed json files and add/remove new/deleted files to/from the path index.
+	void HandleSourceFilesChanged(const TArray<FString>& ChangedFiles);
+
+	// Map all classes to the classes in the meta data cache that are derived from them.
+	// ClassIndexLock must be locked for writing.
+	void BuildClassHierarchyIndex() const;
+	// Find or build the asset list of a class. ClassIndexLock must be locked for writing.
+	TConstArrayView<FJsonDataAssetPath> FindOrAddClassIndexPaths(
+		const FTopLevelAssetPath& ClassPath,
+		const bool bSearchSubClasses) const;
+	void GetMetaDataCacheClasses(TArray<FTopLevelAssetPath>& OutClassPaths) const;
+	void AppendMetaDataCachePaths(const FTopLevelAssetPath& ClassPath, TArray<FJsonDataAssetPath>& OutPaths) const;
+	#if WITH_EDITOR
+	void HandleAssetRegistryAssetsChanged(const FAssetData& AssetData);
+	void HandleAssetRegistryAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+	// Reset the class index, but keep the previous lists alive until the next tick for outstanding views.
+	void InvalidateClassIndex();
+	#endif
+
+	void HandleGameModePostLogin(AGameModeBase* GameMode, APlayerController* NewPlayer);
+
+	// Whether paths may be serialized as indices for the connection that the package map belongs to.
+	bool CanUseFastNetSerialization(UPackageMap* PackageMap) const;
+	void UpdateRemotePathIndexMatch(const TWeakObjectPtr<UNetConnection>& Connection);
+
 	#if WITH_EDITOR
 	void HandlePreBeginPIE(const bool bIsSimulating);
 
@@ -151,8 +320,9 @@ private:
 		TConstArrayView<const ITargetPlatform*> InTargetPlatforms,
 		TArray<FName>& InOutPackagesToCook,
 		TArray<FName>& InOutPackagesToNeverCook);
+	// Collect and export the json assets of all roots for cooking.
 	void ModifyCookInternal(
-		const FName& RootName,
+		TConstArrayView<FName> RootNames,
 		const bool bIterateCook,
 		const bool bCookDeveloperContent,
 		const bool bCookJsonDataDependencies,
@@ -180,8 +350,47 @@ private:
 	// number of bits needed in UJsonDataAssetSubsystem::RescanAllAssets.
 	int64 PathIndexNetSerializeBits = 31;
 
+	// Checksum of the package paths of each root in AllJsonDataAssetsByIndex.
+	TMap<FName, uint32> PathIndexChecksumsByRoot;
+
+	struct FRemotePathIndexState
+	{
+		TMap<FName, uint32> ChecksumsByRoot;
+		bool bMatchesLocalPathIndex = false;
+	};
+	// Path index state of remote peers that completed the handshake. Other connections use full path serialization.
+	TMap<TWeakObjectPtr<UNetConnection>, FRemotePathIndexState> RemotePathIndexStates;
+	// Path index changes of the source watcher that are waiting for fast net serialization to be no longer in use.
+	TMap<FName, bool> DeferredPathIndexChanges;
+
 	TArray<FName> AllPluginRootNames;
 	TArray<FName> AllRootNames;
 
 	FJsonDataAssetMetaDataCache AssetMetaDataCache;
+	// Cooked builds prefer the binary meta data cache. AssetMetaDataCache is only loaded if there is none.
+	TSharedPtr<OUU::JsonData::Runtime::Private::FJsonDataMetaDataCacheBinary> AssetMetaDataCacheBinary;
+
+	// Guards the lazily built class index below, because GetJsonAssetsByClass may be called from any thread.
+	mutable FRWLock ClassIndexLock;
+	// Assets per class with and without subclasses. Built lazily, so const lookup functions can fill them.
+	mutable TMap<FTopLevelAssetPath, TArray<FJsonDataAssetPath>> AssetPathsByClassHierarchy;
+	mutable TMap<FTopLevelAssetPath, TArray<FJsonDataAssetPath>> AssetPathsByClass;
+	// Classes in the meta data cache by all of their ancestor classes (and themselves).
+	mutable TMap<FTopLevelAssetPath, TArray<FTopLevelAssetPath>> MetaDataCacheClassesByAncestor;
+	mutable bool bClassHierarchyIndexBuilt = false;
+	#if WITH_EDITOR
+	// Class index lists that were invalidated this frame. Views from GetJsonAssetsByClassView may still point to them.
+	TArray<TMap<FTopLevelAssetPath, TArray<FJsonDataAssetPath>>> RetiredClassIndexPaths;
+	FTSTicker::FDelegateHandle RetiredClassIndexTickerHandle;
+	#endif
+	// Direct json dependencies of all assets. Only built if dependencies are queried without a binary meta data cache.
+	mutable TMap<FJsonDataAssetPath, TArray<FJsonDataAssetPath>> MetaDataCacheDependencies;
+
+	// Watches the json source directories of all roots for changes. Only valid if the watcher is enabled.
+	TSharedPtr<OUU::JsonData::Runtime::Private::FJsonDataSourceWatcher> SourceWatcher;
+	// Time stamps of json files that were exported by the editor or game itself, by normalized full path.
+	TMap<FString, FDateTime> WrittenSourceFileTimeStamps;
+
+	// Callbacks of async loads that are currently in flight, keyed by the path that is being loaded.
+	TMap<FJsonDataAssetPath, TArray<FOnJsonDataAssetLoaded>> PendingAsyncLoads;
 };
@@ -33,6 +33,8 @@ public:
 
 	FCustomVersionContainer ToCustomVersionContainer() const;
 
+	bool Equals(const FJsonDataCustomVersions& Other) const;
+
 private:
 	UPROPERTY(EditAnywhere)
 	TMap<FGuid, int32> VersionsByGuid;
@@ -6,6 +6,8 @@
 
 #include "Dom/JsonObject.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonWriter.h"
 
 #include "JsonLibrary.generated.h"
 
@@ -84,6 +86,27 @@ public:
 		int64 SkipFlags = 0,
 		bool bOnlyModifiedProperties = false);
 
+	/**
+	 * Streaming alternative to UObjectToJsonObject: Writes the properties of the object as json object directly into
+	 * the writer without building a json object first.
+	 * Always exports all properties, because delta serialization (bOnlyModifiedProperties) can't be streamed.
+	 * @param	Identifier		Field name of the object if the writer is inside of a json object, empty otherwise.
+	 * @returns false if a property could not be exported. The writer contains incomplete json in that case.
+	 */
+	static bool UObjectToJsonWriter(
+		const UObject* Object,
+		TJsonWriter<UTF8CHAR>& JsonWriter,
+		const FString& Identifier,
+		FOUUJsonLibraryObjectFilter SubObjectFilter,
+		int64 CheckFlags = 0,
+		int64 SkipFlags = 0);
+
+	// Write a json value (including all nested values) into the writer.
+	static void JsonValueToJsonWriter(
+		const TSharedPtr<FJsonValue>& JsonValue,
+		TJsonWriter<UTF8CHAR>& JsonWriter,
+		const FString& Identifier);
+
 	UFUNCTION(BlueprintCallable)
 	static bool JsonStringToUObject(
 		UObject* Object,
@@ -117,6 +140,34 @@ public:
 		const FArchive& VersionLoadingArchive,
 		int64 CheckFlags = 0,
 		int64 SkipFlags = 0);
+
+	/**
+	 * Streaming alternative to JsonObjectToUStruct: Reads json tokens from the reader and writes them directly into the
+	 * struct memory without building a json object first.
+	 * The reader must be positioned right after the object start token of the struct data (i.e. the last ReadNext call
+	 * returned EJsonNotation::ObjectStart). Reads everything up to and including the matching object end token.
+	 * If reading fails mid-way, the struct may be partially imported.
+	 */
+	static bool JsonReaderToUStruct(
+		TJsonReader<>& JsonReader,
+		const UStruct* StructDefinition,
+		void* OutStruct,
+		const FArchive& VersionLoadingArchive,
+		int64 CheckFlags = 0,
+		int64 SkipFlags = 0);
+
+	/**
+	 * Read the value of the token that was last read from the reader (including all nested values) into a json value.
+	 * @returns nullptr if the json is malformed.
+	 */
+	static TSharedPtr<FJsonValue> JsonReaderToJsonValue(TJsonReader<>& JsonReader, EJsonNotation CurrentNotation);
+
+	/**
+	 * Skip the value of the token that was last read from the reader (including all nested values) without building
+	 * any json values.
+	 * @returns false if the json is malformed.
+	 */
+	static bool SkipJsonReaderValue(TJsonReader<>& JsonReader, EJsonNotation CurrentNotation);
 };
 
 template <typename StructT>
@@ -1,5 +1,6 @@
 // Copyright (c) 2023 Jonas Reich & Contributors
 
+using System.IO;
 using UnrealBuildTool;
 
 public class OUUJsonDataTests : OUUJsonDataModuleRules
@@ -16,9 +17,13 @@ public class OUUJsonDataTests : OUUJsonDataModuleRules
 			"Engine",
 			"SlateCore",
 			"Json",
+			"GameplayTags",
 
 			// OUU Plugins
 			"OUUJsonDataRuntime",
 		});
+
+		// Specs of internal file formats (e.g. the binary meta data cache) need the private runtime headers.
+		PrivateIncludePaths.Add(Path.Combine(ModuleDirectory, "..", "OUUJsonDataRuntime", "Private"));
 	}
 }
@@ -0,0 +1,141 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "JsonDataAsset.h"
+
+#include "BenchmarkJsonDataAsset.generated.h"
+
+UENUM()
+enum class EBenchmarkJsonDataEnum : uint8
+{
+	Alpha,
+	Beta,
+	Gamma,
+	Delta
+};
+
+USTRUCT()
+struct FBenchmarkJsonDataScalars
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY(EditAnywhere)
+	int32 Integer = 0;
+
+	UPROPERTY(EditAnywhere)
+	float Float = 0.f;
+
+	UPROPERTY(EditAnywhere)
+	bool bBool = false;
+
+	UPROPERTY(EditAnywhere)
+	FString String;
+
+	UPROPERTY(EditAnywhere)
+	FName Name;
+
+	UPROPERTY(EditAnywhere)
+	EBenchmarkJsonDataEnum Enum = EBenchmarkJsonDataEnum::Alpha;
+};
+
+// Tree node for the deep struct shape. Nesting depth is only limited by the generator settings.
+USTRUCT()
+struct FBenchmarkJsonDataNode
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY(EditAnywhere)
+	FBenchmarkJsonDataScalars Scalars;
+
+	UPROPERTY(EditAnywhere)
+	TArray<FBenchmarkJsonDataNode> Children;
+};
+
+UCLASS(DefaultToInstanced, EditInlineNew)
+class UBenchmarkJsonDataAsset_InstancedObject : public UObject
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY(EditAnywhere)
+	FBenchmarkJsonDataScalars Scalars;
+};
+
+/**
+ * Json data asset for benchmarks with one group of properties per dataset shape (see FJsonDataBenchmarkSettings).
+ * Properties of shapes that are not generated keep their default values and are not exported.
+ */
+UCLASS(Hidden)
+class UBenchmarkJsonDataAsset : public UJsonDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	// - Flat scalars
+	UPROPERTY(EditAnywhere)
+	int32 Integer = 0;
+
+	UPROPERTY(EditAnywhere)
+	int64 Integer64 = 0;
+
+	UPROPERTY(EditAnywhere)
+	float Float = 0.f;
+
+	UPROPERTY(EditAnywhere)
+	double Double = 0.0;
+
+	UPROPERTY(EditAnywhere)
+	bool bBool = false;
+
+	UPROPERTY(EditAnywhere)
+	FString String;
+
+	UPROPERTY(EditAnywhere)
+	FName Name;
+
+	UPROPERTY(EditAnywhere)
+	FText Text;
+
+	UPROPERTY(EditAnywhere)
+	EBenchmarkJsonDataEnum Enum = EBenchmarkJsonDataEnum::Alpha;
+
+	UPROPERTY(EditAnywhere)
+	FVector Vector = FVector::ZeroVector;
+
+	UPROPERTY(EditAnywhere)
+	FLinearColor Color = FLinearColor::Black;
+	// --
+
+	// - Deep structs
+	UPROPERTY(EditAnywhere)
+	FBenchmarkJsonDataNode DeepStruct;
+	// --
+
+	// - Large arrays
+	UPROPERTY(EditAnywhere)
+	TArray<int32> IntegerArray;
+
+	UPROPERTY(EditAnywhere)
+	TArray<FBenchmarkJsonDataScalars> StructArray;
+	// --
+
+	// - Maps
+	UPROPERTY(EditAnywhere)
+	TMap<FString, int32> IntegerMap;
+
+	UPROPERTY(EditAnywhere)
+	TMap<FName, FBenchmarkJsonDataScalars> StructMap;
+	// --
+
+	// - Instanced objects
+	UPROPERTY(EditAnywhere, Instanced)
+	TArray<UBenchmarkJsonDataAsset_InstancedObject*> InstancedObjects;
+	// --
+
+	// - Cross-asset references
+	UPROPERTY(EditAnywhere)
+	TArray<FJsonDataAssetPath> References;
+	// --
+};
@@ -0,0 +1,46 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#include "GenerateJsonDataBenchmarkCommandlet.h"
+
+#include "JsonDataBenchmarkGenerator.h"
+#include "LogJsonDataAsset.h"
+#include "Misc/Parse.h"
+
+UGenerateJsonDataBenchmarkCommandlet::UGenerateJsonDataBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UGenerateJsonDataBenchmarkCommandlet::Main(const FString& Params)
+{
+	OUU::JsonData::Tests::FJsonDataBenchmarkSettings Settings;
+	Settings.ParseParams(*Params);
+
+	if (FParse::Param(*Params, TEXT("Clean")))
+	{
+		OUU::JsonData::Tests::DeleteBenchmarkAssets(Settings);
+		UE_LOG(LogJsonDataAsset, Display, TEXT("Deleted json benchmark assets in %s"), *Settings.GetSourceDirectory());
+		return 0;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	const int64 TotalBytes = OUU::JsonData::Tests::WriteBenchmarkAssets(Settings);
+	if (TotalBytes < 0)
+	{
+		return 1;
+	}
+
+	UE_LOG(
+		LogJsonDataAsset,
+		Display,
+		TEXT("Generated %i json benchmark assets (%.2f MB) in %s in %.2fs (%s)"),
+		Settings.NumAssets,
+		static_cast<double>(TotalBytes) / (1024.0 * 1024.0),
+		*Settings.GetSourceDirectory(),
+		FPlatformTime::Seconds() - StartTime,
+		*Settings.ToString());
+	return 0;
+}
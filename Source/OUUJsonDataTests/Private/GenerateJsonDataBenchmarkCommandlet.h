@@ -0,0 +1,28 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Commandlets/Commandlet.h"
+
+#include "GenerateJsonDataBenchmarkCommandlet.generated.h"
+
+/**
+ * Write a synthetic dataset of json data assets for benchmarks.
+ * Usage: -run=GenerateJsonDataBenchmark [-NumAssets=N] [-Shapes=FlatScalars,DeepStructs,...] [-Clean]
+ * See FJsonDataBenchmarkSettings::ParseParams() for all options.
+ * -Clean deletes the dataset instead of generating it.
+ */
+UCLASS()
+class UGenerateJsonDataBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UGenerateJsonDataBenchmarkCommandlet();
+
+	// - UCommandlet
+	int32 Main(const FString& Params) override;
+	// --
+};
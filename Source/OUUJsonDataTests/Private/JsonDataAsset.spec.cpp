@@ -2,13 +2,27 @@
 
 #include "JsonDataAsset.h"
 
+#include "JsonDataAssetDiffReimport.h"
 #include "JsonDataAssetGlobals.h"
+#include "JsonDataAssetSubsystem.h"
+#include "JsonDataCustomVersions.h"
+#include "GameplayTagsModule.h"
 #include "JsonDataTestMacros.h"
+#include "JsonLibrary.h"
+#include "JsonLibraryImportPlan.h"
+#include "NativeGameplayTags.h"
+#include "Serialization/MemoryWriter.h"
 #include "TestJsonDataAsset.h"
 #include "UObject/Package.h"
 
 #if WITH_AUTOMATION_WORKER
 
+using OUU::JsonData::Runtime::Private::FJsonDataAssetDiffReimport;
+using OUU::JsonData::Runtime::Private::FJsonGameplayTagCache;
+using OUU::JsonData::Runtime::Private::FScopedJsonGameplayTagSession;
+
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_JsonDataTests_Parent_Child, "OUUJsonDataTests.Parent.Child");
+
 BEGIN_DEFINE_SPEC(
 	FJsonDataAssetSpec,
 	"OpenUnrealUtilities.JsonData.Asset",
@@ -172,6 +186,74 @@ BEGIN_DEFINE_SPEC(
 		}
 	}
 
+	// Asset and cvar state of the DiffReimport specs
+	UTestJsonDataAsset* DiffReimportAsset = nullptr;
+	bool bPreviousDiffReimport = false;
+
+	static FJsonDataAssetDiffReimport::FImportHashes HashTestJson(const FJsonObject& JsonObject)
+	{
+		return FJsonDataAssetDiffReimport::HashJson(
+			UTestJsonDataAsset::StaticClass(),
+			JsonObject,
+			*JsonObject.GetObjectField(TEXT("Data")));
+	}
+
+	// Track the hashes of the json object as if it was imported into DiffReimportAsset.
+	void SetImportedJson(const FJsonObject& JsonObject) const
+	{
+		FJsonDataAssetDiffReimport::Get().SetImportHashes(*DiffReimportAsset, HashTestJson(JsonObject));
+	}
+
+	bool FindChangedProperties(
+		const FJsonObject& JsonObject,
+		TArray<FProperty*>& OutChangedProperties,
+		TSharedPtr<FJsonObject>& OutChangedData) const
+	{
+		return FJsonDataAssetDiffReimport::Get().FindChangedProperties(
+			*DiffReimportAsset,
+			HashTestJson(JsonObject),
+			*JsonObject.GetObjectField(TEXT("Data")),
+			OUT OutChangedProperties,
+			OUT OutChangedData);
+	}
+
+	static FProperty* FindTestProperty(FName PropertyName)
+	{
+		return FindFProperty<FProperty>(UTestJsonDataAsset::StaticClass(), PropertyName);
+	}
+
+	// Import the tag strings into the GameplayTags property of a new asset.
+	UTestJsonDataAsset* ImportGameplayTags(const TArray<FString>& TagStrings)
+	{
+		TArray<TSharedPtr<FJsonValue>> TagValues;
+		for (const auto& TagString : TagStrings)
+		{
+			TagValues.Add(MakeShared<FJsonValueString>(TagString));
+		}
+		const auto DataObject = MakeShared<FJsonObject>();
+		DataObject->SetArrayField("gameplayTags", TagValues);
+		const auto JsonObject = MakeTestJsonObject();
+		JsonObject->SetObjectField("Data", DataObject);
+
+		auto* TestAsset = NewObject<UTestJsonDataAsset>();
+		TestAsset->ImportJson(JsonObject);
+		return TestAsset;
+	}
+
+	void TestOnlyChildTagSet(const UTestJsonDataAsset* TestAsset)
+	{
+		const FGameplayTag ChildTag = TAG_JsonDataTests_Parent_Child;
+		const FGameplayTag ParentTag = ChildTag.RequestDirectParent();
+		if (SPEC_TEST_NOT_NULL(TestAsset))
+		{
+			SPEC_TEST_EQUAL(TestAsset->GameplayTags.Num(), 1);
+			SPEC_TEST_TRUE(TestAsset->GameplayTags.HasTagExact(ChildTag));
+			// Parent tags must be filled, so queries for parents match.
+			SPEC_TEST_TRUE(TestAsset->GameplayTags.HasTag(ParentTag));
+			SPEC_TEST_FALSE(TestAsset->GameplayTags.HasTagExact(ParentTag));
+		}
+	}
+
 END_DEFINE_SPEC(FJsonDataAssetSpec)
 
 void FJsonDataAssetSpec::Define()
@@ -299,6 +381,301 @@ void FJsonDataAssetSpec::Define()
 		});
 	});
 
+	Describe("DiffReimport", [this]() {
+		BeforeEach([this]() {
+			auto* CVar = IConsoleManager::Get().FindConsoleVariable(TEXT("ouu.JsonData.DiffReimport"));
+			bPreviousDiffReimport = CVar->GetBool();
+			CVar->Set(true, ECVF_SetByCode);
+
+			DiffReimportAsset = NewObject<UTestJsonDataAsset>();
+			// Unsaved changes always cause full imports.
+			DiffReimportAsset->GetPackage()->SetDirtyFlag(false);
+		});
+
+		AfterEach([this]() {
+			FJsonDataAssetDiffReimport::Get().ResetImportHashes(*DiffReimportAsset);
+			DiffReimportAsset = nullptr;
+
+			auto* CVar = IConsoleManager::Get().FindConsoleVariable(TEXT("ouu.JsonData.DiffReimport"));
+			CVar->Set(bPreviousDiffReimport, ECVF_SetByCode);
+		});
+
+		It("should only find the properties whose json values changed", [this]() {
+			const auto JsonObject = MakeTestJsonObject();
+			JsonObject->SetObjectField("Data", MakeDataJsonObject_AllValues());
+			SetImportedJson(*JsonObject);
+
+			const auto ChangedDataObject = MakeDataJsonObject_AllValues();
+			ChangedDataObject->SetStringField("string", "Changed String");
+			JsonObject->SetObjectField("Data", ChangedDataObject);
+
+			TArray<FProperty*> ChangedProperties;
+			TSharedPtr<FJsonObject> ChangedData;
+			if (SPEC_TEST_TRUE(FindChangedProperties(*JsonObject, OUT ChangedProperties, OUT ChangedData)))
+			{
+				if (SPEC_TEST_EQUAL(ChangedProperties.Num(), 1))
+				{
+					SPEC_TEST_EQUAL(ChangedProperties[0], FindTestProperty(TEXT("String")));
+				}
+				if (SPEC_TEST_NOT_NULL(ChangedData.Get()))
+				{
+					SPEC_TEST_EQUAL(ChangedData->Values.Num(), 1);
+					SPEC_TEST_EQUAL(ChangedData->GetStringField(TEXT("string")), TEXT("Changed String"));
+				}
+			}
+		});
+
+		It("should reset properties whose json values were removed without importing them", [this]() {
+			const auto JsonObject = MakeTestJsonObject();
+			JsonObject->SetObjectField("Data", MakeDataJsonObject_AllValues());
+			SetImportedJson(*JsonObject);
+
+			const auto ChangedDataObject = MakeDataJsonObject_AllValues();
+			ChangedDataObject->RemoveField("struct");
+			JsonObject->SetObjectField("Data", ChangedDataObject);
+
+			TArray<FProperty*> ChangedProperties;
+			TSharedPtr<FJsonObject> ChangedData;
+			if (SPEC_TEST_TRUE(FindChangedProperties(*JsonObject, OUT ChangedProperties, OUT ChangedData)))
+			{
+				if (SPEC_TEST_EQUAL(ChangedProperties.Num(), 1))
+				{
+					SPEC_TEST_EQUAL(ChangedProperties[0], FindTestProperty(TEXT("Struct")));
+				}
+				if (SPEC_TEST_NOT_NULL(ChangedData.Get()))
+				{
+					SPEC_TEST_EQUAL(ChangedData->Values.Num(), 0);
+				}
+			}
+		});
+
+		It("should require a full import if the asset was never imported", [this]() {
+			const auto JsonObject = MakeTestJsonObject();
+			JsonObject->SetObjectField("Data", MakeDataJsonObject_AllValues());
+
+			TArray<FProperty*> ChangedProperties;
+			TSharedPtr<FJsonObject> ChangedData;
+			SPEC_TEST_FALSE(FindChangedProperties(*JsonObject, OUT ChangedProperties, OUT ChangedData));
+		});
+
+		It("should require a full import if the header changed", [this]() {
+			const auto JsonObject = MakeTestJsonObject();
+			JsonObject->SetObjectField("Data", MakeDataJsonObject_AllValues());
+			SetImportedJson(*JsonObject);
+
+			JsonObject->SetStringField("EngineVersion", "5.3.0-0+++UE5+Release-5.3");
+
+			TArray<FProperty*> ChangedProperties;
+			TSharedPtr<FJsonObject> ChangedData;
+			SPEC_TEST_FALSE(FindChangedProperties(*JsonObject, OUT ChangedProperties, OUT ChangedData));
+		});
+
+		It("should require a full import if json fields that don't belong to any property changed", [this]() {
+			const auto JsonObject = MakeTestJsonObject();
+			const auto DataObject = MakeDataJsonObject_AllValues();
+			DataObject->SetStringField("legacyField", "Legacy Value");
+			JsonObject->SetObjectField("Data", DataObject);
+			SetImportedJson(*JsonObject);
+
+			DataObject->SetStringField("legacyField", "Changed Legacy Value");
+
+			TArray<FProperty*> ChangedProperties;
+			TSharedPtr<FJsonObject> ChangedData;
+			SPEC_TEST_FALSE(FindChangedProperties(*JsonObject, OUT ChangedProperties, OUT ChangedData));
+		});
+
+		It("should require a full import if instanced sub-object properties changed", [this]() {
+			const auto JsonObject = MakeTestJsonObject();
+			const auto DataObject = MakeDataJsonObject_AllValues();
+			JsonObject->SetObjectField("Data", DataObject);
+			SetImportedJson(*JsonObject);
+
+			auto InstancedObject = MakeShared<FJsonObject>();
+			InstancedObject->SetStringField("_ClassName", "/Script/OUUJsonDataTests.TestJsonDataAsset_InstancedObject");
+			InstancedObject->SetNumberField("integer", 5);
+			DataObject->SetObjectField("instancedObject", InstancedObject);
+
+			TArray<FProperty*> ChangedProperties;
+			TSharedPtr<FJsonObject> ChangedData;
+			SPEC_TEST_FALSE(FindChangedProperties(*JsonObject, OUT ChangedProperties, OUT ChangedData));
+		});
+
+		It("should require a full import if the asset has unsaved changes", [this]() {
+			const auto JsonObject = MakeTestJsonObject();
+			JsonObject->SetObjectField("Data", MakeDataJsonObject_AllValues());
+			SetImportedJson(*JsonObject);
+
+			DiffReimportAsset->GetPackage()->SetDirtyFlag(true);
+
+			TArray<FProperty*> ChangedProperties;
+			TSharedPtr<FJsonObject> ChangedData;
+			SPEC_TEST_FALSE(FindChangedProperties(*JsonObject, OUT ChangedProperties, OUT ChangedData));
+			DiffReimportAsset->GetPackage()->SetDirtyFlag(false);
+		});
+
+		It("should reset removed values and keep unchanged values on reimport", [this]() {
+			const auto JsonObject = MakeTestJsonObject();
+			JsonObject->SetObjectField("Data", MakeDataJsonObject_AllValues());
+			DiffReimportAsset->ImportJson(JsonObject);
+
+			const auto ChangedDataObject = MakeDataJsonObject_AllValues();
+			ChangedDataObject->RemoveField("string");
+			JsonObject->SetObjectField("Data", ChangedDataObject);
+			DiffReimportAsset->ImportJson(JsonObject);
+
+			SPEC_TEST_EQUAL(DiffReimportAsset->String, "Original String (Member)");
+			DiffReimportAsset->String = "Overridden String";
+			TestAllValuesSet(DiffReimportAsset);
+		});
+	});
+
+	Describe("GameplayTags", [this]() {
+		It("should remove invalid tags and fill parent tags", [this]() {
+			const auto* TestAsset = ImportGameplayTags(
+				{TEXT("OUUJsonDataTests.Parent.Child"), TEXT("OUUJsonDataTests.Invalid")});
+			TestOnlyChildTagSet(TestAsset);
+		});
+
+		It("should share resolved tags between imports of a session", [this]() {
+			FScopedJsonGameplayTagSession ScopedSession;
+			TestOnlyChildTagSet(ImportGameplayTags({TEXT("OUUJsonDataTests.Parent.Child")}));
+			TestOnlyChildTagSet(
+				ImportGameplayTags({TEXT("OUUJsonDataTests.Invalid"), TEXT("OUUJsonDataTests.Parent.Child")}));
+
+			FGameplayTag CachedTag;
+			SPEC_TEST_TRUE(FJsonGameplayTagCache::Get().Find(TEXT("OUUJsonDataTests.Parent.Child"), OUT CachedTag));
+			SPEC_TEST_TRUE(CachedTag == TAG_JsonDataTests_Parent_Child.GetTag());
+		});
+
+		It("should not keep resolved tags outside of sessions", [this]() {
+			{
+				FScopedJsonGameplayTagSession ScopedSession;
+				ImportGameplayTags({TEXT("OUUJsonDataTests.Parent.Child")});
+			}
+			ImportGameplayTags({TEXT("OUUJsonDataTests.Invalid")});
+
+			FGameplayTag CachedTag;
+			SPEC_TEST_FALSE(FJsonGameplayTagCache::Get().Find(TEXT("OUUJsonDataTests.Parent.Child"), OUT CachedTag));
+			SPEC_TEST_FALSE(FJsonGameplayTagCache::Get().Find(TEXT("OUUJsonDataTests.Invalid"), OUT CachedTag));
+		});
+
+		It("should forget resolved tags when the gameplay tag tree changes", [this]() {
+			FScopedJsonGameplayTagSession ScopedSession;
+			// Tag that was invalid when it was resolved, but was added to the tree since.
+			FJsonGameplayTagCache::Get().Add(TEXT("OUUJsonDataTests.Parent.Child"), FGameplayTag());
+			IGameplayTagsModule::OnGameplayTagTreeChanged.Broadcast();
+
+			TestOnlyChildTagSet(ImportGameplayTags({TEXT("OUUJsonDataTests.Parent.Child")}));
+		});
+	});
+
+	Describe("JsonStringToUObject", [this]() {
+		It("should stream all values into the object without a json object", [this]() {
+			FString JsonString;
+			const auto JsonWriter = TJsonWriterFactory<>::Create(OUT & JsonString);
+			FJsonSerializer::Serialize(MakeDataJsonObject_AllValues(), JsonWriter);
+
+			auto* TestAsset = NewObject<UTestJsonDataAsset>();
+			SPEC_TEST_TRUE(UOUUJsonLibrary::JsonStringToUObject(TestAsset, JsonString, FJsonDataCustomVersions()));
+
+			TestAllValuesSet(TestAsset);
+		});
+	});
+
+	Describe("UObjectToJsonWriter", [this]() {
+		It("should write the same json as a full json object export", [this]() {
+			const auto JsonObject = MakeTestJsonObject();
+			JsonObject->SetObjectField("Data", MakeDataJsonObject_AllValues());
+			auto* TestAsset = NewObject<UTestJsonDataAsset>();
+			TestAsset->ImportJson(JsonObject);
+
+			constexpr int64 CheckFlags = 0;
+			constexpr int64 SkipFlags = CPF_Transient;
+
+			TArray<uint8> StreamedJson;
+			{
+				FMemoryWriter Writer(StreamedJson);
+				const auto JsonWriter = TJsonWriterFactory<UTF8CHAR>::Create(&Writer);
+				SPEC_TEST_TRUE(UOUUJsonLibrary::UObjectToJsonWriter(TestAsset, *JsonWriter, "", {}, CheckFlags, SkipFlags));
+				JsonWriter->Close();
+			}
+
+			TArray<uint8> DomJson;
+			{
+				FMemoryWriter Writer(DomJson);
+				const auto JsonWriter = TJsonWriterFactory<UTF8CHAR>::Create(&Writer);
+				const auto DataObject = UOUUJsonLibrary::UObjectToJsonObject(TestAsset, {}, CheckFlags, SkipFlags, false);
+				FJsonSerializer::Serialize(DataObject.ToSharedRef(), JsonWriter);
+			}
+
+			SPEC_TEST_TRUE(StreamedJson == DomJson);
+		});
+	});
+
+	Describe("FindJsonAssetsByTag", [this]() {
+		It("should find loaded assets by searchable tag values", [this]() {
+			const auto NoValuesSetPath =
+				FJsonDataAssetPath::FromPackagePath(UTestJsonDataAsset::GetTestPath_NoValuesSet());
+			const auto AllValuesSetPath =
+				FJsonDataAssetPath::FromPackagePath(UTestJsonDataAsset::GetTestPath_AllValuesSet());
+			SPEC_TEST_NOT_NULL(NoValuesSetPath.LoadSynchronous());
+			SPEC_TEST_NOT_NULL(AllValuesSetPath.LoadSynchronous());
+
+			const auto Results = UJsonDataAssetSubsystem::Get().FindJsonAssetsByTag(
+				UTestJsonDataAsset::StaticClass()->GetClassPathName(),
+				false,
+				TEXT("Tier"),
+				[](const FString& Value) { return FCString::Atoi(*Value) >= 3; });
+			SPEC_TEST_TRUE(Results.Contains(AllValuesSetPath));
+			SPEC_TEST_FALSE(Results.Contains(NoValuesSetPath));
+		});
+
+		It("should find loaded assets by exact searchable tag values", [this]() {
+			const auto NoValuesSetPath =
+				FJsonDataAssetPath::FromPackagePath(UTestJsonDataAsset::GetTestPath_NoValuesSet());
+			const auto AllValuesSetPath =
+				FJsonDataAssetPath::FromPackagePath(UTestJsonDataAsset::GetTestPath_AllValuesSet());
+			SPEC_TEST_NOT_NULL(NoValuesSetPath.LoadSynchronous());
+			SPEC_TEST_NOT_NULL(AllValuesSetPath.LoadSynchronous());
+
+			const auto Results = UJsonDataAssetSubsystem::Get().FindJsonAssetsByTagValue(
+				UTestJsonDataAsset::StaticClass(),
+				TEXT("Tier"),
+				TEXT("0"));
+			SPEC_TEST_TRUE(Results.Contains(NoValuesSetPath));
+			SPEC_TEST_FALSE(Results.Contains(AllValuesSetPath));
+		});
+
+		It("should not find assets by tags that don't exist", [this]() {
+			SPEC_TEST_NOT_NULL(
+				FJsonDataAssetPath::FromPackagePath(UTestJsonDataAsset::GetTestPath_NoValuesSet()).LoadSynchronous());
+
+			const auto Results = UJsonDataAssetSubsystem::Get().FindJsonAssetsByTagValue(
+				UTestJsonDataAsset::StaticClass(),
+				TEXT("NotATag"),
+				TEXT("0"));
+			SPEC_TEST_EQUAL(Results.Num(), 0);
+		});
+	});
+
+#if WITH_EDITOR
+	Describe("GetSearchableTags", [this]() {
+		It("should only collect the values of searchable properties", [this]() {
+			auto* TestAsset = NewObject<UTestJsonDataAsset>();
+			TestAsset->Tier = 2;
+
+			FJsonDataAssetSearchableTags Tags;
+			UJsonDataAssetSubsystem::GetSearchableTags(*TestAsset, OUT Tags);
+			SPEC_TEST_EQUAL(Tags.Values.Num(), 1);
+			const auto* Tier = Tags.Values.Find(TEXT("Tier"));
+			if (SPEC_TEST_NOT_NULL(Tier))
+			{
+				SPEC_TEST_EQUAL(*Tier, TEXT("2"));
+			}
+		});
+	});
+#endif
+
 	Describe("ExportJson", [this]() {
 		It("should return empty data object for object with default values", [this]() {
 			const auto LoadPath = UTestJsonDataAsset::GetTestPath_NoValuesSet();
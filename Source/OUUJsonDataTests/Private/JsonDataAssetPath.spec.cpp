@@ -153,6 +153,25 @@ void FJsonDataAssetPathSpec::Define()
 		});
 	});
 
+	Describe("LoadAsync", [this]() {
+		LatentIt("should pass nullptr to callback on null path", [this](const FDoneDelegate& Done) {
+			Path = FJsonDataAssetPath();
+			Path.LoadAsync(FOnJsonDataAssetLoaded::CreateLambda([this, Done](UJsonDataAsset* LoadedObject) {
+				SPEC_TEST_NULL(LoadedObject);
+				Done.Execute();
+			}));
+		});
+
+		LatentIt("should pass valid ptr to callback on valid path", [this](const FDoneDelegate& Done) {
+			Path = FJsonDataAssetPath::FromPackagePath(UTestJsonDataAsset::GetTestPath());
+			Path.LoadAsync(FOnJsonDataAssetLoaded::CreateLambda([this, Done](UJsonDataAsset* LoadedObject) {
+				SPEC_TEST_NOT_NULL(LoadedObject);
+				SPEC_TEST_EQUAL(LoadedObject, Path.ResolveObject());
+				Done.Execute();
+			}));
+		});
+	});
+
 	Describe("ResolveObject", [this]() {
 		It("should return nullptr on null path", [this]() {
 			Path = FJsonDataAssetPath();
@@ -0,0 +1,171 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#include "BenchmarkJsonDataAsset.h"
+#include "JsonDataAssetSubsystem.h"
+#include "JsonDataBenchmarkGenerator.h"
+#include "JsonDataTestMacros.h"
+#include "LogJsonDataAsset.h"
+#include "Misc/CommandLine.h"
+#include "Serialization/JsonSerializer.h"
+#include "UObject/Package.h"
+#include "UObject/StrongObjectPtr.h"
+
+#if WITH_AUTOMATION_WORKER
+
+using OUU::JsonData::Tests::EJsonDataBenchmarkShape;
+using OUU::JsonData::Tests::FJsonDataBenchmarkSettings;
+
+/**
+ * Throughput benchmarks on synthetic datasets (see FJsonDataBenchmarkSettings).
+ * Results are reported as info messages and in the log, so they can be tracked between plugin versions.
+ * Dataset settings can be overridden via command line, e.g. -NumAssets=2000 -ArraySize=1024
+ */
+BEGIN_DEFINE_SPEC(
+	FJsonDataBenchmarkSpec,
+	"OpenUnrealUtilities.JsonData.Benchmark",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+	static FJsonDataBenchmarkSettings MakeSettings(EJsonDataBenchmarkShape Shapes)
+	{
+		FJsonDataBenchmarkSettings Settings;
+		Settings.ParseParams(FCommandLine::Get());
+		Settings.Shapes = Shapes;
+		return Settings;
+	}
+
+	static int64 GetUtf8Size(const FString& String) { return FTCHARToUTF8(*String, String.Len()).Length(); }
+
+	static FString SerializeJson(const TSharedRef<FJsonObject>& JsonObject)
+	{
+		FString JsonString;
+		const TSharedRef<TJsonWriter<>> JsonWriter = TJsonWriterFactory<>::Create(OUT & JsonString);
+		FJsonSerializer::Serialize(JsonObject, JsonWriter);
+		return JsonString;
+	}
+
+	void ReportThroughput(
+		const FString& Operation,
+		const FJsonDataBenchmarkSettings& Settings,
+		int32 NumAssets,
+		int64 NumBytes,
+		double Seconds)
+	{
+		Seconds = FMath::Max(Seconds, UE_SMALL_NUMBER);
+		const double NumMegabytes = static_cast<double>(NumBytes) / (1024.0 * 1024.0);
+		const FString Message = FString::Printf(
+			TEXT("%s: %i assets, %.2f MB in %.3fs -> %.1f assets/s, %.2f MB/s (%s)"),
+			*Operation,
+			NumAssets,
+			NumMegabytes,
+			Seconds,
+			NumAssets / Seconds,
+			NumMegabytes / Seconds,
+			*Settings.ToString());
+		AddInfo(Message);
+		UE_LOG(LogJsonDataAsset, Display, TEXT("[Benchmark] %s"), *Message);
+	}
+
+END_DEFINE_SPEC(FJsonDataBenchmarkSpec)
+
+void FJsonDataBenchmarkSpec::Define()
+{
+	const TPair<FString, EJsonDataBenchmarkShape> Shapes[] = {
+		{TEXT("FlatScalars"), EJsonDataBenchmarkShape::FlatScalars},
+		{TEXT("DeepStructs"), EJsonDataBenchmarkShape::DeepStructs},
+		{TEXT("LargeArrays"), EJsonDataBenchmarkShape::LargeArrays},
+		{TEXT("Maps"), EJsonDataBenchmarkShape::Maps},
+		{TEXT("InstancedObjects"), EJsonDataBenchmarkShape::InstancedObjects},
+		{TEXT("References"), EJsonDataBenchmarkShape::References},
+		{TEXT("All"), EJsonDataBenchmarkShape::All}};
+
+	for (const auto& Shape : Shapes)
+	{
+		Describe(Shape.Key, [this, Shape]() {
+			It("should report ImportJson and ExportJson throughput", [this, Shape]() {
+				const auto Settings = MakeSettings(Shape.Value);
+
+				TArray<TSharedRef<FJsonObject>> JsonObjects;
+				TArray<TStrongObjectPtr<UBenchmarkJsonDataAsset>> Assets;
+				int64 NumImportedBytes = 0;
+				for (int32 AssetIndex = 0; AssetIndex < Settings.NumAssets; ++AssetIndex)
+				{
+					const auto& JsonObject =
+						JsonObjects.Add_GetRef(OUU::JsonData::Tests::GenerateBenchmarkAssetJson(Settings, AssetIndex));
+					NumImportedBytes += GetUtf8Size(SerializeJson(JsonObject));
+					Assets.Emplace(NewObject<UBenchmarkJsonDataAsset>(GetTransientPackage(), NAME_None, RF_Transient));
+				}
+
+				bool bAllImported = true;
+				const double ImportStartTime = FPlatformTime::Seconds();
+				for (int32 AssetIndex = 0; AssetIndex < Settings.NumAssets; ++AssetIndex)
+				{
+					bAllImported &= Assets[AssetIndex]->ImportJson(JsonObjects[AssetIndex]);
+				}
+				const double ImportSeconds = FPlatformTime::Seconds() - ImportStartTime;
+				SPEC_TEST_TRUE(bAllImported);
+				ReportThroughput(TEXT("ImportJson"), Settings, Settings.NumAssets, NumImportedBytes, ImportSeconds);
+
+				TArray<FString> ExportedStrings;
+				ExportedStrings.Reserve(Settings.NumAssets);
+				const double ExportStartTime = FPlatformTime::Seconds();
+				for (const auto& Asset : Assets)
+				{
+					ExportedStrings.Add(SerializeJson(Asset->ExportJson()));
+				}
+				const double ExportSeconds = FPlatformTime::Seconds() - ExportStartTime;
+
+				int64 NumExportedBytes = 0;
+				for (const auto& ExportedString : ExportedStrings)
+				{
+					NumExportedBytes += GetUtf8Size(ExportedString);
+				}
+				ReportThroughput(TEXT("ExportJson"), Settings, Settings.NumAssets, NumExportedBytes, ExportSeconds);
+
+				for (const auto& Asset : Assets)
+				{
+					Asset->MarkAsGarbage();
+				}
+			});
+		});
+	}
+
+	Describe("Subsystem", [this]() {
+		It("should report ImportAssetsInFolder throughput", [this]() {
+			const auto Settings = MakeSettings(EJsonDataBenchmarkShape::All);
+			const int64 NumBytes = OUU::JsonData::Tests::WriteBenchmarkAssets(Settings);
+			if (SPEC_TEST_TRUE(NumBytes >= 0) == false)
+			{
+				OUU::JsonData::Tests::DeleteBenchmarkAssets(Settings);
+				return;
+			}
+
+			auto& Subsystem = UJsonDataAssetSubsystem::Get();
+
+			// Only import (and save) the benchmark folder, so json files of the host project are neither touched nor
+			// part of the measurement.
+			const double ImportStartTime = FPlatformTime::Seconds();
+			Subsystem.ImportAssetsInFolder(Settings.PackageFolder, false);
+			ReportThroughput(
+				TEXT("ImportAssetsInFolder"),
+				Settings,
+				Settings.NumAssets,
+				NumBytes,
+				FPlatformTime::Seconds() - ImportStartTime);
+
+			// Remove the dataset again, so it doesn't slow down editor startup.
+			OUU::JsonData::Tests::DeleteBenchmarkAssets(Settings);
+			for (int32 AssetIndex = 0; AssetIndex < Settings.NumAssets; ++AssetIndex)
+			{
+				const auto Path = FJsonDataAssetPath::FromPackagePath(Settings.GetPackagePath(AssetIndex));
+				if (auto* Asset = Path.ResolveObject())
+				{
+					Asset->ClearFlags(RF_Public | RF_Standalone);
+					Asset->MarkAsGarbage();
+				}
+			}
+			Subsystem.RescanAllAssets();
+		});
+	});
+}
+
+#endif
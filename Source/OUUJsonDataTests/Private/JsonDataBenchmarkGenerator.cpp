@@ -0,0 +1,284 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#include "JsonDataBenchmarkGenerator.h"
+
+#include "BenchmarkJsonDataAsset.h"
+#include "HAL/FileManager.h"
+#include "JsonDataAssetGlobals.h"
+#include "LogJsonDataAsset.h"
+#include "Math/RandomStream.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+#include "UObject/Package.h"
+
+namespace OUU::JsonData::Tests
+{
+	namespace Private
+	{
+		struct FShapeName
+		{
+			EJsonDataBenchmarkShape Shape;
+			const TCHAR* Name;
+		};
+
+		// Prefix of the generated asset names. Only files with this prefix are deleted again.
+		const TCHAR* AssetNamePrefix = TEXT("BenchmarkAsset_");
+
+		constexpr FShapeName ShapeNames[] = {
+			{EJsonDataBenchmarkShape::FlatScalars, TEXT("FlatScalars")},
+			{EJsonDataBenchmarkShape::DeepStructs, TEXT("DeepStructs")},
+			{EJsonDataBenchmarkShape::LargeArrays, TEXT("LargeArrays")},
+			{EJsonDataBenchmarkShape::Maps, TEXT("Maps")},
+			{EJsonDataBenchmarkShape::InstancedObjects, TEXT("InstancedObjects")},
+			{EJsonDataBenchmarkShape::References, TEXT("References")},
+			{EJsonDataBenchmarkShape::All, TEXT("All")}};
+
+		void FillScalars(FBenchmarkJsonDataScalars& Scalars, FRandomStream& Random)
+		{
+			// Never generate default values, so all properties are exported.
+			Scalars.Integer = Random.RandRange(1, 1000000);
+			Scalars.Float = Random.FRandRange(1.f, 1000.f);
+			Scalars.bBool = true;
+			Scalars.String = FString::Printf(TEXT("String_%08x"), Random.GetUnsignedInt());
+			Scalars.Name = FName(*FString::Printf(TEXT("Name_%i"), Random.RandRange(0, 1023)));
+			Scalars.Enum = static_cast<EBenchmarkJsonDataEnum>(Random.RandRange(1, 3));
+		}
+
+		void FillNode(FBenchmarkJsonDataNode& Node, int32 Depth, FRandomStream& Random)
+		{
+			FillScalars(Node.Scalars, Random);
+			if (Depth <= 1)
+				return;
+
+			Node.Children.SetNum(2);
+			for (auto& Child : Node.Children)
+			{
+				FillNode(Child, Depth - 1, Random);
+			}
+		}
+	} // namespace Private
+
+	EJsonDataBenchmarkShape ParseJsonDataBenchmarkShapes(const FString& ShapesString)
+	{
+		TArray<FString> ShapeStrings;
+		ShapesString.ParseIntoArray(OUT ShapeStrings, TEXT(","));
+
+		EJsonDataBenchmarkShape Result = EJsonDataBenchmarkShape::None;
+		for (const auto& ShapeString : ShapeStrings)
+		{
+			for (const auto& ShapeName : Private::ShapeNames)
+			{
+				if (ShapeString.TrimStartAndEnd().Equals(ShapeName.Name, ESearchCase::IgnoreCase))
+				{
+					Result |= ShapeName.Shape;
+				}
+			}
+		}
+		return Result;
+	}
+
+	FString LexToString(EJsonDataBenchmarkShape Shapes)
+	{
+		if (Shapes == EJsonDataBenchmarkShape::All)
+			return TEXT("All");
+
+		TArray<FString> ShapeStrings;
+		for (const auto& ShapeName : Private::ShapeNames)
+		{
+			if (ShapeName.Shape != EJsonDataBenchmarkShape::All && EnumHasAnyFlags(Shapes, ShapeName.Shape))
+			{
+				ShapeStrings.Add(ShapeName.Name);
+			}
+		}
+		return ShapeStrings.Num() > 0 ? FString::Join(ShapeStrings, TEXT(",")) : TEXT("None");
+	}
+
+	void FJsonDataBenchmarkSettings::ParseParams(const TCHAR* Params)
+	{
+		FParse::Value(Params, TEXT("NumAssets="), OUT NumAssets);
+		FParse::Value(Params, TEXT("ArraySize="), OUT ArraySize);
+		FParse::Value(Params, TEXT("MapSize="), OUT MapSize);
+		FParse::Value(Params, TEXT("StructDepth="), OUT StructDepth);
+		FParse::Value(Params, TEXT("NumInstancedObjects="), OUT NumInstancedObjects);
+		FParse::Value(Params, TEXT("NumReferences="), OUT NumReferences);
+		FParse::Value(Params, TEXT("Seed="), OUT Seed);
+
+		FString PackageFolderParam;
+		if (FParse::Value(Params, TEXT("PackageFolder="), OUT PackageFolderParam))
+		{
+			PackageFolderParam.RemoveFromEnd(TEXT("/"));
+			if (OUU::JsonData::Runtime::PackageIsJsonData(PackageFolderParam))
+			{
+				PackageFolder = PackageFolderParam;
+			}
+			else
+			{
+				UE_LOG(
+					LogJsonDataAsset,
+					Error,
+					TEXT("Benchmark package folder %s is not in the /JsonData/ content root. Using %s instead."),
+					*PackageFolderParam,
+					*PackageFolder);
+			}
+		}
+
+		FString ShapesString;
+		if (FParse::Value(Params, TEXT("Shapes="), OUT ShapesString, false))
+		{
+			Shapes = ParseJsonDataBenchmarkShapes(ShapesString);
+		}
+	}
+
+	FString FJsonDataBenchmarkSettings::ToString() const
+	{
+		return FString::Printf(
+			TEXT("NumAssets=%i Shapes=%s ArraySize=%i MapSize=%i StructDepth=%i NumInstancedObjects=%i "
+				 "NumReferences=%i Seed=%i"),
+			NumAssets,
+			*LexToString(Shapes),
+			ArraySize,
+			MapSize,
+			StructDepth,
+			NumInstancedObjects,
+			NumReferences,
+			Seed);
+	}
+
+	FString FJsonDataBenchmarkSettings::GetPackagePath(int32 AssetIndex) const
+	{
+		return FString::Printf(TEXT("%s/%s%05i"), *PackageFolder, Private::AssetNamePrefix, AssetIndex);
+	}
+
+	FString FJsonDataBenchmarkSettings::GetSourceDirectory() const
+	{
+		return FPaths::GetPath(
+			OUU::JsonData::Runtime::PackageToSourceFull(GetPackagePath(0), EJsonDataAccessMode::Write));
+	}
+
+	void FillBenchmarkAsset(
+		UBenchmarkJsonDataAsset& Asset,
+		const FJsonDataBenchmarkSettings& Settings,
+		int32 AssetIndex)
+	{
+		FRandomStream Random(HashCombine(GetTypeHash(Settings.Seed), GetTypeHash(AssetIndex)));
+
+		if (EnumHasAnyFlags(Settings.Shapes, EJsonDataBenchmarkShape::FlatScalars))
+		{
+			Asset.Integer = Random.RandRange(1, 1000000);
+			Asset.Integer64 = static_cast<int64>(Random.GetUnsignedInt()) << 16;
+			Asset.Float = Random.FRandRange(1.f, 1000.f);
+			Asset.Double = Random.FRandRange(1.f, 1000.f) * 1000.0;
+			Asset.bBool = true;
+			Asset.String = FString::Printf(TEXT("String_%08x"), Random.GetUnsignedInt());
+			Asset.Name = FName(*FString::Printf(TEXT("Name_%i"), Random.RandRange(0, 1023)));
+			Asset.Text = FText::FromString(FString::Printf(TEXT("Text_%08x"), Random.GetUnsignedInt()));
+			Asset.Enum = static_cast<EBenchmarkJsonDataEnum>(Random.RandRange(1, 3));
+			Asset.Vector = FVector(Random.FRand(), Random.FRand(), Random.FRand()) * 100.0 + FVector::OneVector;
+			Asset.Color = FLinearColor(Random.FRand(), Random.FRand(), Random.FRand(), 1.f);
+		}
+
+		if (EnumHasAnyFlags(Settings.Shapes, EJsonDataBenchmarkShape::DeepStructs))
+		{
+			Private::FillNode(Asset.DeepStruct, Settings.StructDepth, Random);
+		}
+
+		if (EnumHasAnyFlags(Settings.Shapes, EJsonDataBenchmarkShape::LargeArrays))
+		{
+			Asset.IntegerArray.SetNum(Settings.ArraySize);
+			for (auto& Integer : Asset.IntegerArray)
+			{
+				Integer = Random.RandRange(0, 1000000);
+			}
+
+			Asset.StructArray.SetNum(Settings.ArraySize);
+			for (auto& Scalars : Asset.StructArray)
+			{
+				Private::FillScalars(Scalars, Random);
+			}
+		}
+
+		if (EnumHasAnyFlags(Settings.Shapes, EJsonDataBenchmarkShape::Maps))
+		{
+			for (int32 i = 0; i < Settings.MapSize; ++i)
+			{
+				Asset.IntegerMap.Add(FString::Printf(TEXT("Key_%i"), i), Random.RandRange(0, 1000000));
+				Private::FillScalars(Asset.StructMap.Add(FName(TEXT("Key"), i)), Random);
+			}
+		}
+
+		if (EnumHasAnyFlags(Settings.Shapes, EJsonDataBenchmarkShape::InstancedObjects))
+		{
+			for (int32 i = 0; i < Settings.NumInstancedObjects; ++i)
+			{
+				auto* InstancedObject = NewObject<UBenchmarkJsonDataAsset_InstancedObject>(&Asset);
+				Private::FillScalars(InstancedObject->Scalars, Random);
+				Asset.InstancedObjects.Add(InstancedObject);
+			}
+		}
+
+		if (EnumHasAnyFlags(Settings.Shapes, EJsonDataBenchmarkShape::References) && Settings.NumAssets > 0)
+		{
+			for (int32 i = 0; i < Settings.NumReferences; ++i)
+			{
+				const int32 ReferencedIndex = Random.RandRange(0, Settings.NumAssets - 1);
+				Asset.References.Add(FJsonDataAssetPath::FromPackagePath(Settings.GetPackagePath(ReferencedIndex)));
+			}
+		}
+	}
+
+	TSharedRef<FJsonObject> GenerateBenchmarkAssetJson(const FJsonDataBenchmarkSettings& Settings, int32 AssetIndex)
+	{
+		auto* Asset = NewObject<UBenchmarkJsonDataAsset>(GetTransientPackage(), NAME_None, RF_Transient);
+		FillBenchmarkAsset(*Asset, Settings, AssetIndex);
+		auto JsonObject = Asset->ExportJson();
+		Asset->MarkAsGarbage();
+		return JsonObject;
+	}
+
+	int64 WriteBenchmarkAssets(const FJsonDataBenchmarkSettings& Settings)
+	{
+		// Remove files of previous runs that may have generated more assets.
+		DeleteBenchmarkAssets(Settings);
+
+		int64 TotalBytes = 0;
+		for (int32 AssetIndex = 0; AssetIndex < Settings.NumAssets; ++AssetIndex)
+		{
+			const auto JsonObject = GenerateBenchmarkAssetJson(Settings, AssetIndex);
+			FString JsonString;
+			const TSharedRef<TJsonWriter<>> JsonWriter = TJsonWriterFactory<>::Create(OUT & JsonString);
+			FJsonSerializer::Serialize(JsonObject, JsonWriter);
+
+			const FString FilePath = OUU::JsonData::Runtime::PackageToSourceFull(
+				Settings.GetPackagePath(AssetIndex),
+				EJsonDataAccessMode::Write);
+			if (FFileHelper::SaveStringToFile(JsonString, *FilePath, FFileHelper::EEncodingOptions::ForceUTF8) == false)
+			{
+				UE_LOG(LogJsonDataAsset, Error, TEXT("Failed to write benchmark asset %s"), *FilePath);
+				return -1;
+			}
+			TotalBytes += IFileManager::Get().FileSize(*FilePath);
+		}
+		return TotalBytes;
+	}
+
+	void DeleteBenchmarkAssets(const FJsonDataBenchmarkSettings& Settings)
+	{
+		// Never delete directories recursively: The package folder is user supplied and may contain other files.
+		const FString SourceDirectory = Settings.GetSourceDirectory();
+		TArray<FString> FileNames;
+		IFileManager::Get().FindFiles(
+			OUT FileNames,
+			*(SourceDirectory / FString::Printf(TEXT("%s*.json"), Private::AssetNamePrefix)),
+			true,
+			false);
+		for (const auto& FileName : FileNames)
+		{
+			IFileManager::Get().Delete(*(SourceDirectory / FileName), false, true);
+		}
+
+		// Fails if the directory still contains other files.
+		IFileManager::Get().DeleteDirectory(*SourceDirectory, false, false);
+	}
+} // namespace OUU::JsonData::Tests
@@ -0,0 +1,87 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Dom/JsonObject.h"
+
+class UBenchmarkJsonDataAsset;
+
+// Synthetic json data asset datasets for benchmarks.
+// Used by the GenerateJsonDataBenchmark commandlet and the benchmark specs.
+namespace OUU::JsonData::Tests
+{
+	// Property groups of UBenchmarkJsonDataAsset that are filled with data.
+	enum class EJsonDataBenchmarkShape : uint8
+	{
+		None = 0,
+		FlatScalars = 1 << 0,
+		DeepStructs = 1 << 1,
+		LargeArrays = 1 << 2,
+		Maps = 1 << 3,
+		InstancedObjects = 1 << 4,
+		References = 1 << 5,
+		All = FlatScalars | DeepStructs | LargeArrays | Maps | InstancedObjects | References
+	};
+	ENUM_CLASS_FLAGS(EJsonDataBenchmarkShape);
+
+	// Parse a comma separated list of shape names, e.g. "FlatScalars,Maps". Unknown names are ignored.
+	EJsonDataBenchmarkShape ParseJsonDataBenchmarkShapes(const FString& ShapesString);
+	FString LexToString(EJsonDataBenchmarkShape Shapes);
+
+	struct FJsonDataBenchmarkSettings
+	{
+		int32 NumAssets = 200;
+		EJsonDataBenchmarkShape Shapes = EJsonDataBenchmarkShape::All;
+
+		// Number of elements of each large array.
+		int32 ArraySize = 256;
+		// Number of entries of each map.
+		int32 MapSize = 64;
+		// Nesting depth of the deep struct. Each node has two children, so keep this low.
+		int32 StructDepth = 6;
+		int32 NumInstancedObjects = 16;
+		// Number of references to other assets of the same dataset.
+		int32 NumReferences = 8;
+
+		// Datasets with the same settings are identical.
+		int32 Seed = 0;
+
+		// Package path of the directory that contains the generated assets. Must be in the /JsonData/ content root.
+		// Other files in the directory are never touched.
+		FString PackageFolder = TEXT("/JsonData/Plugins/OUUJsonDataAssets/Benchmark");
+
+		/**
+		 * Override settings from command line style parameters, e.g.
+		 * -NumAssets=1000 -Shapes=FlatScalars,Maps -ArraySize=1024 -MapSize=128 -StructDepth=8
+		 * -NumInstancedObjects=32 -NumReferences=4 -Seed=1 -PackageFolder=/JsonData/Benchmark
+		 */
+		void ParseParams(const TCHAR* Params);
+
+		FString ToString() const;
+
+		FString GetPackagePath(int32 AssetIndex) const;
+		// Full path of the source directory that the generated files are written to.
+		FString GetSourceDirectory() const;
+	};
+
+	// Fill the properties of the configured shapes with deterministic pseudo random data.
+	void FillBenchmarkAsset(
+		UBenchmarkJsonDataAsset& Asset,
+		const FJsonDataBenchmarkSettings& Settings,
+		int32 AssetIndex);
+
+	// Json object of a generated asset, as it would be exported by the editor. Game thread only.
+	TSharedRef<FJsonObject> GenerateBenchmarkAssetJson(const FJsonDataBenchmarkSettings& Settings, int32 AssetIndex);
+
+	/**
+	 * Generate all assets of the dataset and write them into the source directory. Game thread only.
+	 * @returns the total size of the written files in bytes or -1 if any file could not be written.
+	 */
+	int64 WriteBenchmarkAssets(const FJsonDataBenchmarkSettings& Settings);
+
+	// Delete the generated files of the dataset (BenchmarkAsset_*.json) and the source directory if it's empty
+	// afterwards. Other files in the source directory and its subdirectories are kept.
+	void DeleteBenchmarkAssets(const FJsonDataBenchmarkSettings& Settings);
+} // namespace OUU::JsonData::Tests
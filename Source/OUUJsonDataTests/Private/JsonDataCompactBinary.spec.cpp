@@ -0,0 +1,104 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#include "JsonDataCompactBinary.h"
+
+#include "JsonDataTestMacros.h"
+#include "Serialization/JsonSerializer.h"
+
+#if WITH_AUTOMATION_WORKER
+
+using OUU::JsonData::Runtime::Private::CompactBinaryToJsonObject;
+using OUU::JsonData::Runtime::Private::JsonObjectToCompactBinary;
+
+BEGIN_DEFINE_SPEC(
+	FJsonDataCompactBinarySpec,
+	"OpenUnrealUtilities.JsonData.CompactBinary",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+	static TSharedPtr<FJsonObject> RoundTrip(const FJsonObject& JsonObject)
+	{
+		TArray<uint8> Buffer;
+		JsonObjectToCompactBinary(JsonObject, OUT Buffer);
+		return CompactBinaryToJsonObject(MakeMemoryView(Buffer));
+	}
+
+	static TSharedPtr<FJsonObject> ParseJson(const FString& JsonString)
+	{
+		TSharedPtr<FJsonObject> JsonObject;
+		FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(JsonString), OUT JsonObject);
+		return JsonObject;
+	}
+
+	static FString ToJsonString(const TSharedPtr<FJsonObject>& JsonObject)
+	{
+		FString JsonString;
+		FJsonSerializer::Serialize(JsonObject.ToSharedRef(), TJsonWriterFactory<>::Create(OUT & JsonString));
+		return JsonString;
+	}
+
+	void TestRoundTrip(const FString& JsonString)
+	{
+		const auto JsonObject = ParseJson(JsonString);
+		if (SPEC_TEST_NOT_NULL(JsonObject.Get()))
+		{
+			const auto RoundTripObject = RoundTrip(*JsonObject);
+			if (SPEC_TEST_NOT_NULL(RoundTripObject.Get()))
+			{
+				SPEC_TEST_TRUE(FJsonValue::CompareEqual(
+					FJsonValueObject(JsonObject),
+					FJsonValueObject(RoundTripObject)));
+				SPEC_TEST_EQUAL(ToJsonString(RoundTripObject), ToJsonString(JsonObject));
+			}
+		}
+	}
+
+END_DEFINE_SPEC(FJsonDataCompactBinarySpec)
+
+void FJsonDataCompactBinarySpec::Define()
+{
+	Describe("JsonObjectToCompactBinary and CompactBinaryToJsonObject", [this]() {
+		It("should round-trip empty objects", [this]() { TestRoundTrip(TEXT("{}")); });
+
+		It("should round-trip strings and booleans", [this]() {
+			TestRoundTrip(TEXT(R"({"string": "Text with \"quotes\" and \u00fcmlauts", "empty": "", "true": true,
+				"false": false})"));
+		});
+
+		It("should round-trip integer and floating point numbers", [this]() {
+			TestRoundTrip(TEXT(R"({"zero": 0, "integer": 42, "negative": -17, "large": 9007199254740992,
+				"fraction": 0.1, "negativeFraction": -3.25, "exponent": 1.5e300})"));
+		});
+
+		It("should round-trip null values in objects and arrays", [this]() {
+			TestRoundTrip(TEXT(R"({"null": null, "array": [null, 1, null]})"));
+		});
+
+		It("should round-trip nested arrays and objects", [this]() {
+			TestRoundTrip(TEXT(R"({"object": {"nested": {"array": [[1, 2], [], [{"key": "value"}, {}]]}},
+				"arrayOfObjects": [{"a": 1}, {"b": [true, null, "c"]}]})"));
+		});
+
+		It("should keep the order of object fields", [this]() {
+			const auto JsonObject = ParseJson(TEXT(R"({"b": 1, "a": 2, "c": 3})"));
+			if (SPEC_TEST_NOT_NULL(JsonObject.Get()))
+			{
+				const auto RoundTripObject = RoundTrip(*JsonObject);
+				if (SPEC_TEST_NOT_NULL(RoundTripObject.Get()))
+				{
+					TArray<FString> Keys;
+					RoundTripObject->Values.GetKeys(OUT Keys);
+					SPEC_TEST_EQUAL(FString::Join(Keys, TEXT(",")), TEXT("b,a,c"));
+				}
+			}
+		});
+
+		It("should reject invalid buffers", [this]() {
+			TArray<uint8> Buffer;
+			JsonObjectToCompactBinary(*ParseJson(TEXT(R"({"string": "value"})")), OUT Buffer);
+			Buffer.SetNum(Buffer.Num() / 2);
+			SPEC_TEST_NULL(CompactBinaryToJsonObject(MakeMemoryView(Buffer)).Get());
+		});
+	});
+}
+
+#endif
@@ -0,0 +1,274 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#include "JsonDataMetaDataCacheBinary.h"
+
+#include "JsonDataAssetSubsystem.h"
+#include "HAL/FileManager.h"
+#include "JsonDataTestMacros.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#if WITH_AUTOMATION_WORKER
+
+using OUU::JsonData::Runtime::Private::FJsonDataMetaDataCacheBinary;
+
+BEGIN_DEFINE_SPEC(
+	FJsonDataMetaDataCacheBinarySpec,
+	"OpenUnrealUtilities.JsonData.MetaDataCacheBinary",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+	// Layout of the file version 3 (see FJsonDataMetaDataCacheBinary::FHeader and the table entries).
+	static constexpr int32 HeaderSize = 7 * sizeof(int32);
+	static constexpr int32 ClassEntrySize = 4 * sizeof(int32);
+	static constexpr int32 StringEntrySize = 2 * sizeof(int32);
+	static constexpr int32 IndexRangeSize = 2 * sizeof(int32);
+	static constexpr int32 TagEntrySize = 2 * StringEntrySize;
+	static constexpr int32 VersionOffset = sizeof(uint32);
+
+	const FTopLevelAssetPath WeaponClass{TEXT("/Script/OUUJsonDataTests.TestWeapon")};
+	const FTopLevelAssetPath ArmorClass{TEXT("/Script/OUUJsonDataTests.TestArmor")};
+
+	const FJsonDataAssetPath Sword = FJsonDataAssetPath::FromPackagePath(TEXT("/JsonData/Tests/Sword"));
+	const FJsonDataAssetPath Axe = FJsonDataAssetPath::FromPackagePath(TEXT("/JsonData/Tests/Axe"));
+	const FJsonDataAssetPath Helmet = FJsonDataAssetPath::FromPackagePath(TEXT("/JsonData/Tests/Helmet"));
+	const FJsonDataAssetPath NotCooked = FJsonDataAssetPath::FromPackagePath(TEXT("/JsonData/Tests/NotCooked"));
+
+	FString FilePath;
+	// Number of entries in the tables of the file written by WriteTestCache
+	int32 NumClasses = 0;
+	int32 NumPaths = 0;
+	int32 NumTags = 0;
+
+	static FString JoinPaths(const TArray<FJsonDataAssetPath>& Paths)
+	{
+		return FString::JoinBy(Paths, TEXT(", "), [](const FJsonDataAssetPath& Path) { return Path.GetPackagePath(); });
+	}
+
+	using FTagInitializer = TPairInitializer<const FName&, const FString&>;
+
+	static FJsonDataAssetSearchableTags MakeTags(std::initializer_list<FTagInitializer> Tags)
+	{
+		FJsonDataAssetSearchableTags Result;
+		Result.Values = Tags;
+		return Result;
+	}
+
+	static FJsonDataAssetDependencies MakeDependencies(std::initializer_list<FJsonDataAssetPath> Paths)
+	{
+		FJsonDataAssetDependencies Result;
+		Result.Paths.Append(Paths);
+		return Result;
+	}
+
+	bool WriteTestCache()
+	{
+		FJsonDataAssetMetaDataCache MetaDataCache;
+
+		auto& Weapons = MetaDataCache.PathsByClass.Add(WeaponClass);
+		Weapons.Paths = {Sword, Axe};
+		Weapons.SearchableTags = {
+			MakeTags({{TEXT("Tier"), TEXT("1")}}),
+			MakeTags({{TEXT("Tier"), TEXT("3")}, {TEXT("Hands"), TEXT("2")}})};
+		// Cycle and a dependency on an asset that is not part of the cache
+		Weapons.Dependencies = {MakeDependencies({Axe}), MakeDependencies({Helmet, NotCooked})};
+
+		auto& Armor = MetaDataCache.PathsByClass.Add(ArmorClass);
+		Armor.Paths = {Helmet};
+		Armor.SearchableTags = {MakeTags({{TEXT("Tier"), TEXT("3")}})};
+		Armor.Dependencies = {MakeDependencies({Sword})};
+
+		NumClasses = 2;
+		NumPaths = 3;
+		NumTags = 4;
+		return FJsonDataMetaDataCacheBinary::Write(MetaDataCache, FilePath);
+	}
+
+	// Modify the written file in place
+	bool PatchFile(TFunctionRef<void(TArray<uint8>& FileData)> Patch) const
+	{
+		TArray<uint8> FileData;
+		if (FFileHelper::LoadFileToArray(OUT FileData, *FilePath) == false)
+			return false;
+
+		Patch(FileData);
+		return FFileHelper::SaveArrayToFile(FileData, *FilePath);
+	}
+
+	static void WriteInt32(TArray<uint8>& FileData, int32 Offset, int32 Value)
+	{
+		FMemory::Memcpy(FileData.GetData() + Offset, &Value, sizeof(int32));
+	}
+
+	int32 GetDependencyRangesOffset() const
+	{
+		// Classes, paths, sorted path indices, tag ranges and tags come before the dependency ranges.
+		return HeaderSize + NumClasses * ClassEntrySize + NumPaths * StringEntrySize + NumPaths * sizeof(int32)
+			+ NumPaths * IndexRangeSize + NumTags * TagEntrySize;
+	}
+
+END_DEFINE_SPEC(FJsonDataMetaDataCacheBinarySpec)
+
+void FJsonDataMetaDataCacheBinarySpec::Define()
+{
+	BeforeEach([this]() {
+		FilePath = FPaths::AutomationTransientDir() / TEXT("JsonDataMetaDataCacheBinarySpec.bin");
+		WriteTestCache();
+	});
+
+	AfterEach([this]() { IFileManager::Get().Delete(*FilePath); });
+
+	Describe("Write and Open", [this]() {
+		It("should read back all classes", [this]() {
+			FJsonDataMetaDataCacheBinary Cache;
+			if (SPEC_TEST_TRUE(Cache.Open(FilePath)))
+			{
+				TArray<FTopLevelAssetPath> ClassPaths;
+				Cache.GetClassPaths(OUT ClassPaths);
+				SPEC_TEST_EQUAL(ClassPaths.Num(), 2);
+				SPEC_TEST_TRUE(ClassPaths.Contains(WeaponClass));
+				SPEC_TEST_TRUE(ClassPaths.Contains(ArmorClass));
+			}
+		});
+
+		It("should read back the asset paths of a class in their original order", [this]() {
+			FJsonDataMetaDataCacheBinary Cache;
+			if (SPEC_TEST_TRUE(Cache.Open(FilePath)))
+			{
+				TArray<FJsonDataAssetPath> Paths;
+				Cache.AppendAssetPaths(WeaponClass, OUT Paths);
+				SPEC_TEST_EQUAL(JoinPaths(Paths), JoinPaths({Sword, Axe}));
+				SPEC_TEST_EQUAL(Paths[0].GetAssetName(), Sword.GetAssetName());
+			}
+		});
+
+		It("should not append any paths for unknown classes", [this]() {
+			FJsonDataMetaDataCacheBinary Cache;
+			if (SPEC_TEST_TRUE(Cache.Open(FilePath)))
+			{
+				TArray<FJsonDataAssetPath> Paths;
+				Cache.AppendAssetPaths(FTopLevelAssetPath(TEXT("/Script/OUUJsonDataTests.Unknown")), OUT Paths);
+				SPEC_TEST_EQUAL(Paths.Num(), 0);
+			}
+		});
+
+		It("should find assets by searchable tag values", [this]() {
+			FJsonDataMetaDataCacheBinary Cache;
+			if (SPEC_TEST_TRUE(Cache.Open(FilePath)))
+			{
+				TArray<FJsonDataAssetPath> Paths;
+				Cache.AppendAssetPathsByTag(
+					WeaponClass,
+					TEXT("Tier"),
+					[](const FString& Value) { return FCString::Atoi(*Value) >= 3; },
+					OUT Paths);
+				SPEC_TEST_EQUAL(JoinPaths(Paths), JoinPaths({Axe}));
+			}
+		});
+
+		It("should match tag names case-insensitive", [this]() {
+			FJsonDataMetaDataCacheBinary Cache;
+			if (SPEC_TEST_TRUE(Cache.Open(FilePath)))
+			{
+				TArray<FJsonDataAssetPath> Paths;
+				Cache.AppendAssetPathsByTag(
+					WeaponClass,
+					TEXT("hands"),
+					[](const FString& Value) { return Value == TEXT("2"); },
+					OUT Paths);
+				SPEC_TEST_EQUAL(JoinPaths(Paths), JoinPaths({Axe}));
+			}
+		});
+
+		It("should resolve dependency closures across classes and cycles breadth first", [this]() {
+			FJsonDataMetaDataCacheBinary Cache;
+			if (SPEC_TEST_TRUE(Cache.Open(FilePath)))
+			{
+				TArray<FJsonDataAssetPath> Paths;
+				SPEC_TEST_TRUE(Cache.GetDependencyClosure(Sword, OUT Paths));
+				SPEC_TEST_EQUAL(JoinPaths(Paths), JoinPaths({Sword, Axe, Helmet}));
+			}
+		});
+
+		It("should not find dependency closures of assets that are not in the cache", [this]() {
+			FJsonDataMetaDataCacheBinary Cache;
+			if (SPEC_TEST_TRUE(Cache.Open(FilePath)))
+			{
+				TArray<FJsonDataAssetPath> Paths;
+				SPEC_TEST_FALSE(Cache.GetDependencyClosure(NotCooked, OUT Paths));
+				SPEC_TEST_EQUAL(Paths.Num(), 0);
+			}
+		});
+	});
+
+	Describe("Open corrupt files", [this]() {
+		It("should reject files with an invalid magic", [this]() {
+			AddExpectedError(TEXT("has an invalid header or outdated version"));
+			PatchFile([](TArray<uint8>& FileData) { WriteInt32(FileData, 0, 0); });
+
+			FJsonDataMetaDataCacheBinary Cache;
+			SPEC_TEST_FALSE(Cache.Open(FilePath));
+		});
+
+		It("should reject files of older versions", [this]() {
+			AddExpectedError(
+				TEXT("has an invalid header or outdated version"),
+				EAutomationExpectedErrorFlags::Contains,
+				2);
+			for (int32 OldVersion = 1; OldVersion < 3; ++OldVersion)
+			{
+				PatchFile([OldVersion](TArray<uint8>& FileData) { WriteInt32(FileData, VersionOffset, OldVersion); });
+
+				FJsonDataMetaDataCacheBinary Cache;
+				SPEC_TEST_FALSE(Cache.Open(FilePath));
+			}
+		});
+
+		It("should reject truncated files", [this]() {
+			AddExpectedError(TEXT("is truncated"));
+			PatchFile([](TArray<uint8>& FileData) { FileData.Pop(); });
+
+			FJsonDataMetaDataCacheBinary Cache;
+			SPEC_TEST_FALSE(Cache.Open(FilePath));
+		});
+
+		It("should reject files that are smaller than the header", [this]() {
+			AddExpectedError(TEXT("is truncated"));
+			PatchFile([](TArray<uint8>& FileData) { FileData.SetNum(HeaderSize - 1); });
+
+			FJsonDataMetaDataCacheBinary Cache;
+			SPEC_TEST_FALSE(Cache.Open(FilePath));
+		});
+
+		It("should reject class entries with out of bounds path ranges", [this]() {
+			AddExpectedError(TEXT("has an out of bounds class entry"));
+			// NumPaths of the first class
+			PatchFile([](TArray<uint8>& FileData) {
+				WriteInt32(FileData, HeaderSize + StringEntrySize + sizeof(int32), 1000);
+			});
+
+			FJsonDataMetaDataCacheBinary Cache;
+			SPEC_TEST_FALSE(Cache.Open(FilePath));
+		});
+
+		It("should skip out of bounds dependency ranges", [this]() {
+			AddExpectedError(TEXT("has an out of bounds dependency"));
+			PatchFile([this](TArray<uint8>& FileData) {
+				const int32 DependencyRangesOffset = GetDependencyRangesOffset();
+				for (int32 PathIndex = 0; PathIndex < NumPaths; ++PathIndex)
+				{
+					WriteInt32(FileData, DependencyRangesOffset + PathIndex * IndexRangeSize, 1000);
+				}
+			});
+
+			FJsonDataMetaDataCacheBinary Cache;
+			if (SPEC_TEST_TRUE(Cache.Open(FilePath)))
+			{
+				TArray<FJsonDataAssetPath> Paths;
+				SPEC_TEST_TRUE(Cache.GetDependencyClosure(Sword, OUT Paths));
+				SPEC_TEST_EQUAL(JoinPaths(Paths), JoinPaths({Sword}));
+			}
+		});
+	});
+}
+
+#endif
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 
+#include "GameplayTagContainer.h"
 #include "JsonDataAsset.h"
 
 #include "TestJsonDataAsset.generated.h"
@@ -72,6 +73,18 @@ public:
 	UPROPERTY(EditAnywhere, Instanced)
 	TArray<UTestJsonDataAsset_InstancedObject*> ArrayOfInstancedObjects;
 
+	// Searchable tag for the tag queries of UJsonDataAssetSubsystem
+	UPROPERTY(EditAnywhere, AssetRegistrySearchable)
+	int32 Tier = 0;
+
+	// Gameplay tag containers are imported manually (see FJsonLibraryImportHelper)
+	UPROPERTY(EditAnywhere)
+	FGameplayTagContainer GameplayTags;
+
+	// - UJsonDataAsset
+	bool SupportsStreamingImport() const override { return true; }
+	// --
+
 	// Get path to any test asset (no requirements to contained data)
 	static FString GetTestPath() { return GetTestPath_NoValuesSet(); }
 